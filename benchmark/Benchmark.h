@@ -0,0 +1,46 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Keep a value alive so the compiler cannot remove the computation
+
+template <class T> inline void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "g"(&value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+// Best wall time of several runs (in milliseconds)
+
+template <class Fn> double measure(Fn fn, const int runs = 5) {
+  double best = 0;
+
+  for (int i = 0; i < runs; i++) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+
+    double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+    best = i == 0 ? ms : std::min(best, ms);
+  }
+
+  return best;
+}
+
+// Print one benchmark result
+
+inline void report(const std::string &name, const double ms) {
+  std::cout << std::left << std::setw(48) << name << std::right
+            << std::setw(12) << std::fixed << std::setprecision(3) << ms
+            << " ms" << std::endl;
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include <Benchmark.h>
+#include <ConcurrentOrderedList.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Several threads on one shared set of small keys, a given percentage of
+// the operations are updates (remove the key, or insert it when missing)
+
+const int key_range = 64;
+
+template <class Op>
+double mixed(const int threads, const int operations, const int writes,
+             Op op) {
+  return measure(
+      [&]() {
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++)
+          pool.emplace_back([&op, t, operations, writes]() {
+            std::mt19937 rng(t + 1);
+            for (int i = 0; i < operations; i++)
+              op(static_cast<int>(rng() % key_range),
+                 static_cast<int>(rng() % 100) < writes);
+          });
+
+        for (std::thread &thread : pool)
+          thread.join();
+      },
+      3);
+}
+
+void compare(const int threads, const int operations, const int writes) {
+  ConcurrentOrderedList<int> list;
+  std::set<int> set;
+  std::shared_mutex mutex;
+  for (int key = 0; key < key_range; key += 2) {
+    list.insert(key);
+    set.insert(key);
+  }
+
+  std::atomic<long long> found(0);
+
+  auto list_op = [&](int key, bool update) {
+    if (!update)
+      found += list.contains(key);
+    else if (!list.remove(key))
+      list.insert(key);
+  };
+  auto set_op = [&](int key, bool update) {
+    if (!update) {
+      std::shared_lock<std::shared_mutex> lock(mutex);
+      found += set.count(key);
+    } else {
+      std::unique_lock<std::shared_mutex> lock(mutex);
+      if (set.erase(key) == 0)
+        set.insert(key);
+    }
+  };
+
+  std::string mix = std::to_string(100 - writes) + "/" +
+                    std::to_string(writes) + " read/write";
+  report("ConcurrentOrderedList<int> " + mix,
+         mixed(threads, operations, writes, list_op));
+  report("std::set<int> + std::shared_mutex " + mix,
+         mixed(threads, operations, writes, set_op));
+  do_not_optimize(found);
+}
+
+int main() {
+  int cores = static_cast<int>(std::thread::hardware_concurrency());
+  int threads = std::max(2, std::min(4, cores));
+  std::cout << "\n" << threads << " threads, 200000 operations each, "
+            << key_range << " keys" << std::endl;
+
+  for (int writes : {0, 10, 50})
+    compare(threads, 200000, writes);
+
+  return 0;
+}
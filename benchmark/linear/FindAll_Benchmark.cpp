@@ -0,0 +1,43 @@
+#include <Benchmark.h>
+#include <DynamicArray.h>
+
+#include <vector>
+
+// find_all (iterator vector) vs compact results (indexes, bitmap, visitor)
+
+int main() {
+  const int size = 10000000;
+  std::vector<int> vec(size);
+  for (int i = 0; i < size; i++)
+    vec[i] = i % 4;
+
+  DynamicArray<int> d(vec);
+  long long result = 0;
+
+  report("find_all() -> vector<Iterator<int>>", measure([&]() {
+           std::vector<Iterator<int>> found = d.find_all(0);
+           result = static_cast<long long>(found.size());
+           do_not_optimize(found);
+         }));
+
+  report("find_all_indices() -> vector<int>", measure([&]() {
+           std::vector<int> found = d.find_all_indices(0);
+           result = static_cast<long long>(found.size());
+           do_not_optimize(found);
+         }));
+
+  report("match_mask() -> MatchMask", measure([&]() {
+           MatchMask found = d.match_mask(0);
+           result = found.count();
+           do_not_optimize(found);
+         }));
+
+  report("for_each_match() (no results)", measure([&]() {
+           long long count = 0;
+           d.for_each_match(0, [&count](const int, const int &) { count++; });
+           result = count;
+           do_not_optimize(result);
+         }));
+
+  return 0;
+}
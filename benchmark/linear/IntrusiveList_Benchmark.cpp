@@ -0,0 +1,125 @@
+// both lists are driven through node handles, trust them instead of
+// walking the list on every remove_node
+#define CHECKED_NODE_HANDLES 0
+
+#include <Benchmark.h>
+#include <IntrusiveList.h>
+#include <IntrusiveQueue.h>
+#include <LinkedList.h>
+#include <Queue.h>
+
+#include <iostream>
+#include <vector>
+
+// Objects living in an arena (one vector), linked on an LRU list and a work
+// queue at the same time
+
+struct Order {
+  int id;
+  long long amount;
+  IntrusiveListHook<Order> lru;
+  IntrusiveQueueHook<Order> work;
+  Order(int id = 0) : id(id), amount(id){};
+};
+
+// Touching random objects moves them to the front of the LRU list: the
+// linked list frees and allocates a node every time, the intrusive list
+// relinks the object itself
+
+void lru(std::vector<Order> &arena, const int touches) {
+  const int size = static_cast<int>(arena.size());
+
+  LinkedList<Order *> linked;
+  std::vector<ListNode<Order *> *> handles(size);
+  for (int i = 0; i < size; i++) {
+    linked.push_end(&arena[i]);
+    handles[i] = linked.get_tail();
+  }
+
+  IntrusiveList<Order, &Order::lru> intrusive;
+  for (Order &order : arena)
+    intrusive.push_end(order);
+
+  auto linked_touch = [&]() {
+    for (int i = 0; i < touches; i++) {
+      int id = static_cast<int>((i * 2654435761u) % size);
+      linked.remove_node(handles[id]);
+      linked.push_begin(&arena[id]);
+      handles[id] = linked.get_head();
+    }
+  };
+  auto intrusive_touch = [&]() {
+    for (int i = 0; i < touches; i++) {
+      Order &order = arena[(i * 2654435761u) % size];
+      intrusive.remove_node(order);
+      intrusive.push_begin(order);
+    }
+  };
+
+  report("LinkedList<Order *> move to front", measure(linked_touch, 1));
+  report("IntrusiveList<Order> move to front", measure(intrusive_touch, 1));
+
+  long long sum = 0;
+  report("LinkedList<Order *> traversal", measure([&]() {
+           for (ListIterator<Order *> it = linked.begin(); it != linked.end();
+                ++it)
+             sum += (*it)->amount;
+         }));
+  report("IntrusiveList<Order> traversal", measure([&]() {
+           intrusive.for_each(
+               [&sum](const Order &order) { sum += order.amount; });
+         }));
+
+  do_not_optimize(sum);
+}
+
+// Cycling every object through a work queue (dequeue and enqueue again)
+
+void work(std::vector<Order> &arena, const int rounds) {
+  Queue<Order *> queue;
+  IntrusiveQueue<Order, &Order::work> intrusive;
+  for (Order &order : arena) {
+    queue.enqueue(&order);
+    intrusive.enqueue(order);
+  }
+
+  const int operations = rounds * static_cast<int>(arena.size());
+  long long sum = 0;
+
+  auto queue_cycle = [&]() {
+    for (int i = 0; i < operations; i++) {
+      Order *order = queue.dequeue();
+      sum += order->amount;
+      queue.enqueue(order);
+    }
+  };
+  auto intrusive_cycle = [&]() {
+    for (int i = 0; i < operations; i++) {
+      Order &order = intrusive.dequeue();
+      sum += order.amount;
+      intrusive.enqueue(order);
+    }
+  };
+
+  report("Queue<Order *> dequeue/enqueue", measure(queue_cycle, 1));
+  report("IntrusiveQueue<Order> dequeue/enqueue", measure(intrusive_cycle, 1));
+
+  do_not_optimize(sum);
+}
+
+int main() {
+  const int size = 100000;
+  std::vector<Order> arena;
+  arena.reserve(size);
+  for (int i = 0; i < size; i++)
+    arena.emplace_back(i);
+
+  std::cout << "\nLRU list of " << size << " objects, 1000000 touches"
+            << std::endl;
+  lru(arena, 1000000);
+
+  std::cout << "\nWork queue of " << size << " objects, 10 rounds" << std::endl;
+  work(arena, 10);
+
+  return 0;
+}
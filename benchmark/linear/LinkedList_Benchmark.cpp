@@ -0,0 +1,154 @@
+// trusted node handles in this translation unit, the checked walk is timed
+// explicitly with owns()
+#define CHECKED_NODE_HANDLES 0
+
+#include <Benchmark.h>
+#include <LinkedList.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Move-to-back through node handles (LRU touch): membership walk + O(1)
+// surgery (debug builds) vs trusted O(1) surgery (NDEBUG builds)
+
+void handles() {
+  const int size = 10000, touches = 20000;
+
+  for (bool checked : {true, false}) {
+    LinkedList<int> list;
+    std::vector<ListNode<int> *> handles(size);
+    for (int i = 0; i < size; i++) {
+      list.push_end(i);
+      handles[i] = list.get_tail();
+    }
+
+    long long walked = 0;
+    double ms = measure(
+        [&]() {
+          for (int i = 0; i < touches; i++) {
+            int key = (i * 7919) % size;
+            if (checked)
+              walked += list.owns(handles[key]);
+
+            list.push_after(list.get_tail(), handles[key]->data);
+            list.remove_node(handles[key]);
+            handles[key] = list.get_tail();
+          }
+        },
+        1);
+
+    report(checked ? "checked handles (walk + unlink)"
+                   : "trusted handles (unlink only)",
+           ms);
+    do_not_optimize(walked);
+  }
+}
+
+// Bulk insertion in the middle: one push_index per element (a walk each)
+// vs push_vector (one chain, one walk)
+
+void bulk() {
+  const int size = 20000;
+  std::vector<int> values(size);
+  for (int i = 0; i < size; i++)
+    values[i] = i;
+
+  LinkedList<int> one_by_one(values), bulk(values);
+
+  report("push_index per element", measure(
+                                       [&]() {
+                                         int index = size / 2;
+                                         for (int value : values)
+                                           one_by_one.push_index(index++,
+                                                                 value);
+                                       },
+                                       1));
+  report("push_vector", measure(
+                            [&]() { bulk.push_vector(size / 2, values); }, 1));
+
+  do_not_optimize(one_by_one);
+  do_not_optimize(bulk);
+}
+
+// Indexed loop and repeated push_middle: walk from the head per index (what
+// the list did before cursors) vs the finger/middle cursors
+
+void cursors() {
+  const int size = 20000;
+  std::vector<int> values(size);
+  for (int i = 0; i < size; i++)
+    values[i] = i;
+
+  LinkedList<int> list(values);
+
+  long long sum = 0;
+  report("indexed loop, walk from head", measure(
+                                             [&]() {
+                                               for (int i = 0; i < size; i++) {
+                                                 ListNode<int> *temp =
+                                                     list.get_head();
+                                                 for (int j = 0; j < i; j++)
+                                                   temp = temp->next;
+                                                 sum += temp->data;
+                                               }
+                                             },
+                                             1));
+  report("indexed loop, finger", measure(
+                                     [&]() {
+                                       for (int i = 0; i < size; i++)
+                                         sum += list.get_node_by_index(i)->data;
+                                     },
+                                     1));
+
+  LinkedList<int> middle;
+  report("push_middle, middle cursor", measure(
+                                           [&]() {
+                                             for (int value : values)
+                                               middle.push_middle(value);
+                                           },
+                                           1));
+
+  do_not_optimize(sum);
+  do_not_optimize(middle);
+}
+
+// Sorting: copy out, std::stable_sort and rebuild every node vs the in-place
+// merge sort that only relinks nodes (keeps node handles valid)
+
+template <class T> void sorting(const std::string &name, std::vector<T> values) {
+  LinkedList<T> rebuilt(values), relinked(values);
+
+  auto rebuild = [&]() {
+    std::vector<T> vec = rebuilt.to_vector();
+    std::stable_sort(vec.begin(), vec.end());
+    rebuilt.clear();
+    for (const T &value : vec)
+      rebuilt.push_end(value);
+  };
+
+  report(name + " to_vector + stable_sort + rebuild", measure(rebuild, 1));
+  report(name + " sort() (relinking)",
+         measure([&]() { relinked.sort(); }, 1));
+
+  do_not_optimize(rebuilt);
+  do_not_optimize(relinked);
+}
+
+int main() {
+  handles();
+  bulk();
+  cursors();
+
+  std::vector<int> numbers(1000000);
+  std::vector<std::string> strings(200000);
+  for (int i = 0; i < 1000000; i++)
+    numbers[i] = static_cast<int>((i * 2654435761u) % 1000003);
+  for (int i = 0; i < 200000; i++)
+    strings[i] = std::string(40, 'x') + std::to_string(numbers[i]);
+
+  sorting("1M int:", numbers);
+  sorting("200k string:", strings);
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+#include <Benchmark.h>
+#include <LfuCache.h>
+#include <LruCache.h>
+#include <ShardedCache.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Hand-written LRU cache on std::list and std::unordered_map, the usual
+// copy kept next to a service
+
+class ListLru {
+private:
+  std::list<std::pair<int, int>> order;
+  std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+  std::size_t capacity;
+
+public:
+  ListLru(const std::size_t capacity) : capacity(capacity){};
+
+  bool get(const int key, int &value) {
+    auto found = this->index.find(key);
+    if (found == this->index.end())
+      return false;
+
+    this->order.splice(this->order.begin(), this->order, found->second);
+    value = found->second->second;
+    return true;
+  }
+
+  void put(const int key, const int value) {
+    auto found = this->index.find(key);
+    if (found != this->index.end()) {
+      found->second->second = value;
+      this->order.splice(this->order.begin(), this->order, found->second);
+      return;
+    }
+
+    this->order.emplace_front(key, value);
+    this->index.emplace(key, this->order.begin());
+    if (this->order.size() > this->capacity) {
+      this->index.erase(this->order.back().first);
+      this->order.pop_back();
+    }
+  }
+};
+
+// Skewed keys (a few are hot, most are cold) with a scan of cold keys every
+// 64 requests, every miss is filled with put
+
+std::vector<int> requests(const int count, const int keys) {
+  std::mt19937 rng(11);
+  std::vector<int> vec(count);
+  int scan = keys;
+
+  for (int i = 0; i < count; i++) {
+    if (i % 64 < 8)
+      vec[i] = scan++;
+    else
+      vec[i] = static_cast<int>(
+          std::min<double>(keys - 1, keys * std::pow(rng() / 4294967296.0, 4)));
+  }
+
+  return vec;
+}
+
+template <class Cache>
+void serve(const std::string &name, Cache &cache,
+           const std::vector<int> &keys) {
+  long long hits = 0;
+  auto run = [&]() {
+    for (int key : keys) {
+      int value;
+      if (cache.get(key, value))
+        hits++;
+      else
+        cache.put(key, key);
+    }
+  };
+
+  report(name, measure(run, 1));
+  std::cout << "    hit ratio "
+            << static_cast<double>(hits) / static_cast<double>(keys.size())
+            << std::endl;
+}
+
+// Several threads on one cache: one mutex around an LruCache, or shards
+
+template <class Cache>
+double threaded(Cache &cache, const int threads, const int operations,
+                const int keys) {
+  return measure(
+      [&]() {
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++)
+          pool.emplace_back([&cache, t, operations, keys]() {
+            std::mt19937 rng(t + 1);
+            for (int i = 0; i < operations; i++) {
+              int key = static_cast<int>(rng() % keys), value;
+              if (!cache.get(key, value))
+                cache.put(key, key);
+            }
+          });
+
+        for (std::thread &thread : pool)
+          thread.join();
+      },
+      3);
+}
+
+class LockedLru {
+private:
+  std::mutex mutex;
+  LruCache<int, int> cache;
+
+public:
+  LockedLru(const std::size_t capacity) : cache(capacity){};
+
+  bool get(const int key, int &value) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->cache.get(key, value);
+  }
+
+  void put(const int key, const int value) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->cache.put(key, value);
+  }
+};
+
+int main() {
+  const int count = 2000000, keys = 100000, capacity = 10000;
+  std::vector<int> keys_served = requests(count, keys);
+
+  std::cout << "\n" << count << " requests, " << keys << " skewed keys with "
+            << "scans, capacity " << capacity << std::endl;
+
+  LruCache<int, int> lru(capacity);
+  LfuCache<int, int> lfu(capacity);
+  ListLru list(capacity);
+  serve("LruCache<int, int>", lru, keys_served);
+  serve("std::list + std::unordered_map LRU", list, keys_served);
+  serve("LfuCache<int, int>", lfu, keys_served);
+
+  int cores = static_cast<int>(std::thread::hardware_concurrency());
+  int threads = std::max(2, std::min(4, cores));
+  std::cout << "\n" << threads << " threads, 500000 requests each, " << keys
+            << " uniform keys, capacity " << capacity << std::endl;
+
+  LockedLru locked(capacity);
+  ShardedCache<int, int> sharded(capacity, 16);
+  report("LruCache<int, int> + std::mutex",
+         threaded(locked, threads, 500000, keys));
+  report("ShardedCache<int, int> (16 shards)",
+         threaded(sharded, threads, 500000, keys));
+
+  return 0;
+}
@@ -0,0 +1,115 @@
+#include <Benchmark.h>
+#include <BucketQueue.h>
+#include <PriorityQueue.h>
+#include <RadixHeap.h>
+
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Dijkstra (lazy deletion) on a random graph: binary heap vs radix heap vs
+// bucket queue
+
+struct Edge {
+  int to;
+  unsigned int weight;
+};
+
+const unsigned int max_weight = 100;
+const unsigned int inf = std::numeric_limits<unsigned int>::max();
+
+// adapters with the same push/pop names
+struct BinaryHeap {
+  PriorityQueue<std::pair<unsigned int, int>,
+                std::greater<std::pair<unsigned int, int>>>
+      queue;
+
+  inline void push(unsigned int key, int vertex) {
+    this->queue.push({key, vertex});
+  }
+  inline std::pair<unsigned int, int> pop() { return this->queue.pop(); }
+  inline bool is_empty() const { return this->queue.is_empty(); }
+};
+
+struct Radix {
+  RadixHeap<unsigned int, int> queue;
+
+  inline void push(unsigned int key, int vertex) {
+    this->queue.push(key, vertex);
+  }
+  inline std::pair<unsigned int, int> pop() { return this->queue.pop(); }
+  inline bool is_empty() const { return this->queue.is_empty(); }
+};
+
+struct Buckets {
+  BucketQueue<unsigned int, int> queue{max_weight};
+
+  inline void push(unsigned int key, int vertex) {
+    this->queue.push(key, vertex);
+  }
+  inline std::pair<unsigned int, int> pop() { return this->queue.pop(); }
+  inline bool is_empty() const { return this->queue.is_empty(); }
+};
+
+template <class Queue>
+unsigned long long dijkstra(const std::vector<std::vector<Edge>> &graph) {
+  std::vector<unsigned int> dist(graph.size(), inf);
+  Queue q;
+
+  dist[0] = 0;
+  q.push(0, 0);
+  while (!q.is_empty()) {
+    std::pair<unsigned int, int> top = q.pop();
+    if (top.first != dist[top.second])
+      continue;
+
+    for (const Edge &edge : graph[top.second]) {
+      unsigned int d = top.first + edge.weight;
+      if (d < dist[edge.to]) {
+        dist[edge.to] = d;
+        q.push(d, edge.to);
+      }
+    }
+  }
+
+  unsigned long long checksum = 0;
+  for (unsigned int d : dist)
+    checksum += d == inf ? 0 : d;
+
+  return checksum;
+}
+
+int main() {
+  const int vertices = 1000000, degree = 8;
+  std::vector<std::vector<Edge>> graph(vertices);
+
+  unsigned long long state = 88172645463325252ull;
+  auto next = [&state]() {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  };
+
+  for (int v = 0; v < vertices; v++) {
+    for (int e = 0; e < degree; e++) {
+      graph[v].push_back({static_cast<int>(next() % vertices),
+                          static_cast<unsigned int>(next() % max_weight) + 1});
+    }
+  }
+
+  unsigned long long results[3];
+  report("PriorityQueue (binary heap)",
+         measure([&]() { results[0] = dijkstra<BinaryHeap>(graph); }, 3));
+  report("RadixHeap",
+         measure([&]() { results[1] = dijkstra<Radix>(graph); }, 3));
+  report("BucketQueue",
+         measure([&]() { results[2] = dijkstra<Buckets>(graph); }, 3));
+
+  if (results[0] != results[1] || results[0] != results[2])
+    std::cerr << "Distances differ between queues!" << std::endl;
+
+  do_not_optimize(results);
+  return 0;
+}
@@ -0,0 +1,82 @@
+// the list is built through node handles, trust them instead of walking the
+// list on every push_after
+#define CHECKED_NODE_HANDLES 0
+
+#include <Benchmark.h>
+#include <LinkedList.h>
+#include <PooledLinkedList.h>
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Build a list by inserting at random positions of a growing list, so
+// neighbours in the list are far apart in memory (positions are picked next
+// to a random node handle, no walk)
+
+template <class Push>
+void scatter(const int size, std::vector<std::uint32_t> &order, Push push) {
+  std::mt19937 rng(7);
+  order.clear();
+  for (int i = 0; i < size; i++)
+    order.push_back(i == 0 ? 0 : static_cast<std::uint32_t>(rng() % i));
+
+  for (int i = 0; i < size; i++)
+    push(i, order[i]);
+}
+
+int main() {
+  const int size = 1000000;
+  std::vector<std::uint32_t> order;
+
+  std::cout << "\nNode size for int: ListNode " << sizeof(ListNode<int>)
+            << " bytes + malloc header, PooledNode " << sizeof(PooledNode<int>)
+            << " bytes" << std::endl;
+
+  LinkedList<int> linked;
+  std::vector<ListNode<int> *> nodes(size);
+  scatter(size, order, [&](int i, std::uint32_t after) {
+    if (i == 0)
+      linked.push_end(i);
+    else
+      linked.push_after(nodes[after], i);
+
+    nodes[i] = i == 0 ? linked.get_head() : nodes[after]->next;
+  });
+
+  PooledLinkedList<int> pooled;
+  pooled.reserve(size);
+  scatter(size, order, [&](int i, std::uint32_t after) {
+    if (i == 0)
+      pooled.push_end(i);
+    else
+      pooled.push_after(after, i);
+  });
+
+  std::cout << "\nTraversal of " << size << " scattered elements" << std::endl;
+
+  long long sum = 0;
+  report("LinkedList<int>", measure([&]() {
+           for (ListIterator<int> it = linked.begin(); it != linked.end(); ++it)
+             sum += *it;
+         }));
+  report("PooledLinkedList<int>", measure([&]() {
+           pooled.for_each([&sum](const int &value) { sum += value; });
+         }));
+
+  report("PooledLinkedList<int> compact()",
+         measure([&]() { pooled.compact(); }, 1));
+  report("PooledLinkedList<int> after compact()", measure([&]() {
+           pooled.for_each([&sum](const int &value) { sum += value; });
+         }));
+  report("PooledLinkedList<int> after compact() (links)", measure([&]() {
+           for (PooledListIterator<int> it = pooled.begin(); it != pooled.end();
+                ++it)
+             sum += *it;
+         }));
+
+  do_not_optimize(sum);
+
+  return 0;
+}
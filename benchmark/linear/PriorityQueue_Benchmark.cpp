@@ -0,0 +1,55 @@
+#include <Benchmark.h>
+#include <PriorityQueue.h>
+
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <vector>
+
+// 10M operations (5M push + 5M pop, interleaved) for each heap arity
+
+template <class Queue> double run(std::vector<int> &values) {
+  long long checksum = 0;
+  double ms = measure(
+      [&]() {
+        Queue q;
+        for (std::size_t i = 0; i < values.size(); i++) {
+          q.push(values[i]);
+          if (i % 2 == 1) {
+            checksum += q.top();
+            q.pop();
+          }
+        }
+
+        while (!q.empty())
+          q.pop();
+      },
+      1);
+
+  do_not_optimize(checksum);
+  return ms;
+}
+
+// adapter with the std::priority_queue names
+template <int Arity> struct Heap {
+  PriorityQueue<int, std::less<int>, Arity> queue;
+
+  inline void push(const int &value) { this->queue.push(value); }
+  inline void pop() { this->queue.pop(); }
+  inline int top() const { return this->queue.top(); }
+  inline bool empty() const { return this->queue.is_empty(); }
+};
+
+int main() {
+  const int size = 5000000;
+  std::vector<int> values(size);
+  for (int i = 0; i < size; i++)
+    values[i] = static_cast<int>((i * 2654435761LL) % 1000003);
+
+  report("std::priority_queue", run<std::priority_queue<int>>(values));
+  report("PriorityQueue arity 2", run<Heap<2>>(values));
+  report("PriorityQueue arity 4", run<Heap<4>>(values));
+  report("PriorityQueue arity 8", run<Heap<8>>(values));
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+#include <Benchmark.h>
+#include <SegmentedStack.h>
+#include <Stack.h>
+
+#include <algorithm>
+#include <chrono>
+
+// Growing Stack (resize on full) vs SegmentedStack: total and worst push
+
+template <class Push> void run(const std::string &name, Push push) {
+  const int size = 5000000;
+  double worst = 0;
+
+  double total = measure(
+      [&]() {
+        worst = 0;
+        for (int i = 0; i < size; i++) {
+          auto start = std::chrono::steady_clock::now();
+          push(i);
+          auto stop = std::chrono::steady_clock::now();
+
+          worst = std::max(
+              worst,
+              std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+      },
+      1);
+
+  report(name + " total", total);
+  report(name + " worst single push", worst);
+}
+
+int main() {
+  Stack<int> stack(1024);
+  run("Stack (resize x2 when full)", [&stack](int i) {
+    if (stack.is_full())
+      stack.resize(stack.get_capacity() * 2);
+
+    stack.push(i);
+  });
+  do_not_optimize(stack);
+
+  SegmentedStack<int> segmented;
+  run("SegmentedStack<int, 1024>", [&segmented](int i) { segmented.push(i); });
+  do_not_optimize(segmented);
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+#include <Benchmark.h>
+#include <ConcurrentSkipList.h>
+#include <SkipList.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Single thread: inserting, searching, iterating in order and removing
+// random keys
+
+template <class Map, class Insert, class Find, class Value, class Remove>
+void sequential(const std::string &name, const std::vector<int> &keys,
+                Insert insert, Find find, Value value, Remove remove) {
+  Map map;
+  long long sum = 0;
+
+  auto insert_all = [&]() {
+    for (int key : keys)
+      insert(map, key);
+  };
+  auto find_all = [&]() {
+    for (int key : keys)
+      sum += find(map, key);
+  };
+  auto traverse = [&]() {
+    for (auto it = map.begin(); it != map.end(); ++it)
+      sum += value(it);
+  };
+  auto remove_all = [&]() {
+    for (int key : keys)
+      remove(map, key);
+  };
+
+  report(name + " insert", measure(insert_all, 1));
+  report(name + " find", measure(find_all));
+  report(name + " ordered traversal", measure(traverse));
+  report(name + " remove", measure(remove_all, 1));
+
+  do_not_optimize(sum);
+}
+
+// Several threads on one shared map, 90% searches and 10% updates
+
+template <class Op>
+double threaded(const int threads, const int operations, Op op) {
+  return measure(
+      [&]() {
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++)
+          pool.emplace_back([&op, t, operations]() {
+            std::mt19937 rng(t + 1);
+            for (int i = 0; i < operations; i++)
+              op(static_cast<int>(rng() % 1000000), rng() % 10 == 0);
+          });
+
+        for (std::thread &thread : pool)
+          thread.join();
+      },
+      3);
+}
+
+void concurrent(const int threads, const int operations) {
+  ConcurrentSkipList<int, int> skip;
+  std::map<int, int> map;
+  std::shared_mutex mutex;
+  for (int key = 0; key < 1000000; key += 2) {
+    skip.insert(key, key);
+    map.emplace(key, key);
+  }
+
+  std::atomic<long long> found(0);
+
+  double skip_ms = threaded(threads, operations, [&](int key, bool update) {
+    if (!update) {
+      int value;
+      found += skip.find(key, value);
+    } else if (!skip.remove(key)) {
+      skip.insert(key, key);
+    }
+  });
+
+  double map_ms = threaded(threads, operations, [&](int key, bool update) {
+    if (!update) {
+      std::shared_lock<std::shared_mutex> lock(mutex);
+      found += map.count(key);
+    } else {
+      std::unique_lock<std::shared_mutex> lock(mutex);
+      if (map.erase(key) == 0)
+        map.emplace(key, key);
+    }
+  });
+
+  report("ConcurrentSkipList<int, int>", skip_ms);
+  report("std::map<int, int> + std::shared_mutex", map_ms);
+  do_not_optimize(found);
+}
+
+int main() {
+  const int size = 1000000;
+  std::vector<int> keys(size);
+  for (int i = 0; i < size; i++)
+    keys[i] = i;
+
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(5));
+
+  std::cout << "\n" << size << " random keys, one thread" << std::endl;
+  sequential<SkipList<int, int>>(
+      "SkipList<int, int>", keys,
+      [](SkipList<int, int> &s, int key) { s.insert(key, key); },
+      [](SkipList<int, int> &s, int key) { return s.find(key)->value; },
+      [](const SkipListIterator<int, int> &it) { return it->value; },
+      [](SkipList<int, int> &s, int key) { s.remove(key); });
+  sequential<std::map<int, int>>(
+      "std::map<int, int>", keys,
+      [](std::map<int, int> &m, int key) { m.emplace(key, key); },
+      [](std::map<int, int> &m, int key) { return m.find(key)->second; },
+      [](const std::map<int, int>::iterator &it) { return it->second; },
+      [](std::map<int, int> &m, int key) { m.erase(key); });
+
+  int cores = static_cast<int>(std::thread::hardware_concurrency());
+  int threads = std::max(2, std::min(4, cores));
+  std::cout << "\n" << threads
+            << " threads, 500000 operations each, 90% searches" << std::endl;
+  concurrent(threads, 500000);
+
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include <Benchmark.h>
+#include <SlidingWindow.h>
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+// Rolling min/max over a stream: scanning each window vs SlidingWindow
+
+int main() {
+  const int size = 1000000;
+  std::vector<int> stream(size);
+  for (int i = 0; i < size; i++)
+    stream[i] = static_cast<int>((i * 7919LL + 13) % 100003);
+
+  for (int window : {16, 256, 4096}) {
+    long long checksum = 0;
+
+    report("window " + std::to_string(window) + ": naive scan",
+           measure(
+               [&]() {
+                 std::deque<int> last;
+                 for (int value : stream) {
+                   last.push_back(value);
+                   if (last.size() > static_cast<size_t>(window))
+                     last.pop_front();
+
+                   checksum += *std::min_element(last.begin(), last.end());
+                   checksum += *std::max_element(last.begin(), last.end());
+                 }
+               },
+               1));
+
+    report("window " + std::to_string(window) + ": SlidingWindow",
+           measure(
+               [&]() {
+                 SlidingWindow<int> w(window);
+                 for (int value : stream) {
+                   w.push(value);
+                   checksum += w.min();
+                   checksum += w.max();
+                 }
+               },
+               1));
+
+    do_not_optimize(checksum);
+  }
+
+  return 0;
+}
@@ -0,0 +1,65 @@
+#include <Benchmark.h>
+#include <DynamicArray.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+// Count heap allocations made through operator new
+
+static long long allocations = 0;
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (void *ptr = std::malloc(size))
+    return ptr;
+
+  throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+// Per-request arrays of a few elements
+
+template <class Array> long long run(const int requests, const int elements) {
+  long long sum = 0;
+  for (int r = 0; r < requests; r++) {
+    Array array(16);
+    for (int i = 0; i < elements; i++)
+      array.push_back(r + i);
+
+    if (array.contains(r))
+      sum += array.find(r + elements - 1) - array.begin();
+  }
+
+  return sum;
+}
+
+template <class Array>
+void bench(const std::string &name, const int requests, const int elements) {
+  long long before = allocations;
+  long long result = run<Array>(requests, elements);
+  long long count = allocations - before;
+  do_not_optimize(result);
+
+  double ms = measure(
+      [&]() { do_not_optimize(run<Array>(requests, elements)); });
+  report(name + " (" + std::to_string(count) + " mallocs)", ms);
+}
+
+int main() {
+  const int requests = 1000000;
+
+  for (int elements : {4, 12, 16}) {
+    std::cout << "\n" << elements << " elements per request" << std::endl;
+    bench<DynamicArray<int>>("DynamicArray<int>", requests, elements);
+    bench<SmallDynamicArray<int, 16>>("SmallDynamicArray<int, 16>", requests,
+                                      elements);
+  }
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+#include <Benchmark.h>
+#include <PriorityQueue.h>
+#include <TimerWheel.h>
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// 10M pending timeouts, 20% cancelled, time advanced in 1000 tick steps:
+// TimerWheel vs binary heap (cancel by flag, skipped on pop)
+
+int main() {
+  const int size = 10000000;
+  const std::uint64_t span = 1 << 20;
+
+  std::vector<std::uint64_t> expiries(size);
+  unsigned long long state = 88172645463325252ull;
+  for (int i = 0; i < size; i++) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    expiries[i] = 1 + state % span;
+  }
+
+  long long fired = 0;
+
+  {
+    TimerWheel<int> wheel;
+    std::vector<TimerHandle<int>> handles(size);
+
+    report("TimerWheel schedule", measure(
+                                      [&]() {
+                                        for (int i = 0; i < size; i++)
+                                          handles[i] =
+                                              wheel.schedule(expiries[i], i);
+                                      },
+                                      1));
+    report("TimerWheel cancel", measure(
+                                    [&]() {
+                                      for (int i = 0; i < size; i += 5)
+                                        wheel.cancel(handles[i]);
+                                    },
+                                    1));
+    report("TimerWheel advance", measure(
+                                     [&]() {
+                                       for (std::uint64_t t = 0; t <= span;
+                                            t += 1000)
+                                         fired += wheel.advance(
+                                             t, [](int &) {});
+                                       fired += wheel.advance(span,
+                                                              [](int &) {});
+                                     },
+                                     1));
+  }
+
+  {
+    using Entry = std::pair<std::uint64_t, int>;
+    PriorityQueue<Entry, std::greater<Entry>> heap(size);
+    std::vector<char> cancelled(size, 0);
+
+    report("Heap schedule", measure(
+                                [&]() {
+                                  for (int i = 0; i < size; i++)
+                                    heap.push({expiries[i], i});
+                                },
+                                1));
+    report("Heap cancel", measure(
+                              [&]() {
+                                for (int i = 0; i < size; i += 5)
+                                  cancelled[i] = 1;
+                              },
+                              1));
+    report("Heap advance", measure(
+                               [&]() {
+                                 for (std::uint64_t t = 0; t <= span;
+                                      t += 1000) {
+                                   while (!heap.is_empty() &&
+                                          heap.top().first <= t) {
+                                     if (!cancelled[heap.pop().second])
+                                       fired++;
+                                   }
+                                 }
+                               },
+                               1));
+  }
+
+  do_not_optimize(fired);
+  return 0;
+}
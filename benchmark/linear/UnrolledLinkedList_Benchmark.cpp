@@ -0,0 +1,156 @@
+#include <Benchmark.h>
+#include <LinkedList.h>
+#include <UnrolledLinkedList.h>
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+// Count heap allocations and requested bytes made through operator new
+
+static long long allocations = 0;
+static long long bytes = 0;
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  bytes += static_cast<long long>(size);
+  if (void *ptr = std::malloc(size))
+    return ptr;
+
+  throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+// Memory of a list built by push_end (the allocator adds its own header of
+// about 16 bytes to every allocation on top of these numbers)
+
+template <class List> void memory(const std::string &name, const int size) {
+  long long before_allocations = allocations, before_bytes = bytes;
+  // the list object is counted by hand: it is taken straight from malloc so
+  // its release is a plain free once the replacements above are inlined
+  void *memory = std::malloc(sizeof(List));
+  if (memory == nullptr)
+    throw std::bad_alloc();
+
+  ++allocations;
+  bytes += static_cast<long long>(sizeof(List));
+  List *list = new (memory) List();
+  for (int i = 0; i < size; i++)
+    list->push_end(i);
+
+  long long count = allocations - before_allocations;
+  double per_element = static_cast<double>(bytes - before_bytes) / size;
+  std::cout << std::left << std::setw(48) << name << std::right
+            << std::setw(12) << std::fixed << std::setprecision(2)
+            << per_element << " bytes/element, " << count << " mallocs"
+            << std::endl;
+
+  list->~List();
+  std::free(memory);
+}
+
+// Full traversal and a search for a missing value; the lists are built with
+// interleaved garbage allocations so nodes are scattered like in a long
+// running program
+
+void traversal(const int size) {
+  std::vector<int *> garbage;
+  LinkedList<int> linked;
+  UnrolledLinkedList<int> unrolled;
+  for (int i = 0; i < size; i++) {
+    linked.push_end(i);
+    unrolled.push_end(i);
+    garbage.push_back(new int(i));
+  }
+
+  long long sum = 0;
+  report("LinkedList<int> traversal", measure([&]() {
+           for (ListIterator<int> it = linked.begin(); it != linked.end(); ++it)
+             sum += *it;
+         }));
+  report("UnrolledLinkedList<int> traversal", measure([&]() {
+           unrolled.for_each([&sum](const int &value) { sum += value; });
+         }));
+  report("UnrolledLinkedList<int> traversal (iterator)", measure([&]() {
+           for (UnrolledListIterator<int, unrolled_block_capacity<int>()> it =
+                    unrolled.begin();
+                it != unrolled.end(); ++it)
+             sum += *it;
+         }));
+
+  bool found = false;
+  report("LinkedList<int> find missing", measure([&]() {
+           for (ListIterator<int> it = linked.begin(); it != linked.end(); ++it)
+             found |= *it == -1;
+         }));
+  report("UnrolledLinkedList<int> find missing",
+         measure([&]() { found |= unrolled.contains(-1); }));
+
+  do_not_optimize(sum);
+  do_not_optimize(found);
+
+  for (int *value : garbage)
+    delete value;
+}
+
+// Inserting and removing at scattered indexes (hashed, so the linked list
+// finger cannot shorten the walks)
+
+template <class List> double at_index(List &list, const int operations) {
+  const int size = list.get_length();
+
+  return measure(
+      [&]() {
+        for (int i = 0; i < operations; i++) {
+          int index = static_cast<int>((i * 2654435761u) % size);
+          list.push_index(index, i);
+          list.remove_index(index);
+        }
+      },
+      1);
+}
+
+void middle(const int size, const int operations) {
+  std::vector<int> values(size);
+  for (int i = 0; i < size; i++)
+    values[i] = i;
+
+  LinkedList<int> linked(values);
+  UnrolledLinkedList<int> unrolled(values);
+
+  report("LinkedList<int> insert/remove at index",
+         at_index(linked, operations));
+  report("UnrolledLinkedList<int> insert/remove at index",
+         at_index(unrolled, operations));
+
+  do_not_optimize(linked);
+  do_not_optimize(unrolled);
+}
+
+int main() {
+  const int size = 1000000;
+
+  std::cout << "\nMemory for " << size << " elements" << std::endl;
+  memory<LinkedList<int>>("LinkedList<int>", size);
+  memory<UnrolledLinkedList<int>>("UnrolledLinkedList<int> (16 per block)",
+                                  size);
+  memory<LinkedList<double>>("LinkedList<double>", size);
+  memory<UnrolledLinkedList<double>>("UnrolledLinkedList<double> (8 per block)",
+                                     size);
+
+  std::cout << "\nTraversal of " << size << " elements" << std::endl;
+  traversal(size);
+
+  std::cout << "\nRandom positions in 100000 elements" << std::endl;
+  middle(100000, 2000);
+
+  return 0;
+}
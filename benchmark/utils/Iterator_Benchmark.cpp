@@ -0,0 +1,52 @@
+#include <Benchmark.h>
+#include <Iterator.h>
+
+#include <vector>
+
+// Checked vs unchecked iterator loops (same shape as find/count/to_string)
+
+template <bool Checked> long long count_loop(std::vector<int> &vec, int x) {
+  const int size = static_cast<int>(vec.size());
+  Iterator<int, Checked> begin(vec.data(), size, 0);
+  Iterator<int, Checked> end(vec.data(), size, size);
+
+  long long count = 0;
+  for (Iterator<int, Checked> it = begin; it != end; ++it) {
+    if (*it == x)
+      count++;
+  }
+
+  return count;
+}
+
+int main() {
+  const int size = 20000000;
+  std::vector<int> vec(size);
+  for (int i = 0; i < size; i++)
+    vec[i] = i % 1000;
+
+  long long result = 0;
+
+  report("checked Iterator<int, true> loop", measure([&]() {
+           result = count_loop<true>(vec, 7);
+           do_not_optimize(result);
+         }));
+
+  report("unchecked Iterator<int, false> loop", measure([&]() {
+           result = count_loop<false>(vec, 7);
+           do_not_optimize(result);
+         }));
+
+  report("raw pointer loop", measure([&]() {
+           long long count = 0;
+           for (const int *p = vec.data(); p != vec.data() + size; ++p) {
+             if (*p == 7)
+               count++;
+           }
+
+           result = count;
+           do_not_optimize(result);
+         }));
+
+  return 0;
+}
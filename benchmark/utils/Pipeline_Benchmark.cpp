@@ -0,0 +1,51 @@
+#include <Benchmark.h>
+#include <DynamicArray.h>
+#include <Pipeline.h>
+
+#include <functional>
+#include <vector>
+
+// Eager filter -> apply -> reduce chain vs fused lazy pipeline
+
+int main() {
+  const int size = 5000000;
+  std::vector<long long> vec(size);
+  for (int i = 0; i < size; i++)
+    vec[i] = i % 1000;
+
+  DynamicArray<long long> d(vec);
+  auto odd = [](long long x) { return x % 2 == 1; };
+  auto square = [](long long x) { return x * x; };
+  auto sum = [](long long a, long long b) { return a + b; };
+
+  long long result = 0;
+
+  report("eager filter().apply().reduce()", measure([&]() {
+           result = d.filter(odd).apply(square).reduce(0, sum);
+           do_not_optimize(result);
+         }));
+
+  report("lazy pipe().filter().map().reduce()", measure([&]() {
+           result = d.pipe().filter(odd).map(square).reduce(0LL, sum);
+           do_not_optimize(result);
+         }));
+
+  report("lazy pipe().filter().map().parallel_reduce()", measure([&]() {
+           result = d.pipe().filter(odd).map(square).parallel_reduce(0LL, sum,
+                                                                     sum);
+           do_not_optimize(result);
+         }));
+
+  report("eager filter().apply() (materialized)", measure([&]() {
+           DynamicArray<long long> out = d.filter(odd).apply(square);
+           do_not_optimize(out);
+         }));
+
+  report("lazy pipe().filter().map().collect()", measure([&]() {
+           DynamicArray<long long> out =
+               d.pipe().filter(odd).map(square).collect();
+           do_not_optimize(out);
+         }));
+
+  return 0;
+}
@@ -4,7 +4,7 @@ set -e
 
 BUILD_DIR="build"
 EXECUTABLE_NAME="data-structures"
-VALID_TESTS=("DynamicArray" "Stack" "Queue" "LinkedList" "Iterator" "QueueIterator" "ListIterator")
+VALID_TESTS=("DynamicArray" "Stack" "Queue" "LinkedList" "Iterator" "QueueIterator" "ListIterator" "ArrayView" "Pipeline" "SmallDynamicArray" "StaticArray" "StaticStack" "MatchMask" "SegmentedStack" "MinMaxStack" "MonotonicStack" "Deque" "SlidingWindow" "PriorityQueue" "IndexedPriorityQueue" "RadixHeap" "BucketQueue" "TimerWheel" "UnrolledLinkedList" "PooledLinkedList" "IntrusiveList" "IntrusiveQueue" "SkipList" "ConcurrentSkipList" "ConcurrentOrderedList" "EpochReclamation" "LruCache" "LfuCache" "ShardedCache")
 
 if [ ! -d "$BUILD_DIR" ]; then
     mkdir "$BUILD_DIR"
@@ -29,6 +29,22 @@ if [ "$1" == "tests" ]; then
         echo -e "\nRunning all the tests.\n"
         GTEST_COLOR=1 ctest --test-dir build/test --output-on-failure -j12
     fi
+elif [ "$1" == "bench" ]; then
+    BENCHMARKS=$(find benchmark -name "*_Benchmark" -type f -executable | sort)
+
+    if [ -n "$2" ]; then
+        BENCHMARKS=$(echo "$BENCHMARKS" | grep "/$2_Benchmark$" || true)
+
+        if [ -z "$BENCHMARKS" ]; then
+            echo -e "\nError: Benchmark '$2' was not found in $BUILD_DIR/benchmark directory."
+            exit 1
+        fi
+    fi
+
+    for BENCHMARK in $BENCHMARKS; do
+        echo -e "\nRunning $(basename "$BENCHMARK").\n"
+        ./"$BENCHMARK"
+    done
 elif [ "$1" == "run" ]; then
     if [ ! -f "$EXECUTABLE_NAME" ]; then
         echo -e "\nError: Executable file: $EXECUTABLE_NAME was not found in $BUILD_DIR directory."
@@ -37,6 +53,6 @@ elif [ "$1" == "run" ]; then
 
     ./"$EXECUTABLE_NAME"
 else
-    echo -e "\nUsage: $0 {tests [TestName]|run}"
+    echo -e "\nUsage: $0 {tests [TestName]|bench [BenchmarkName]|run}"
     exit 1
 fi
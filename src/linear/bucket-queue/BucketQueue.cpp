@@ -0,0 +1,19 @@
+/*
+
+A bucket queue (Dial's queue) keeps one bucket per key value in a circular
+array. When all queued keys stay within [last popped key, last popped key +
+max spread], as in Dijkstra's algorithm with edge weights <= max spread, a
+push is O(1) and a pop only moves the cursor forward over empty buckets, so
+it is O(1) amortized plus the spread.
+
+Pros:
+    Push/Pop in O(1) for small integer spreads
+    No key comparisons at all
+
+Cons:
+    Memory grows with the max spread
+    Keys should never go below the last popped key
+
+*/
+
+int main() { return 0; }
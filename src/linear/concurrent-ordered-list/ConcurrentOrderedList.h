@@ -0,0 +1,256 @@
+#ifndef CONCURRENTORDEREDLIST_H
+#define CONCURRENTORDEREDLIST_H
+
+#include <EpochReclamation.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Concurrent ordered list node (the value never changes after the node is
+// published, the lowest bit of next marks the node as removed)
+
+template <class T> class ConcurrentListNode {
+public:
+  const T data;
+  std::atomic<std::uintptr_t> next;
+  ConcurrentListNode(const T &data) : data(data), next(0){};
+};
+
+// Lock-free sorted set on a singly linked list (Harris-Michael): removal
+// marks the node first and unlinks it second, unlinked nodes are freed by
+// epoch based reclamation once no thread can still be reading them
+
+template <class T, class Compare = std::less<T>> class ConcurrentOrderedList {
+private:
+  using Node = ConcurrentListNode<T>;
+  using Link = std::atomic<std::uintptr_t>;
+
+  // position of a value: prev is the link that points to curr, curr the
+  // first node not less than the value (null at the end)
+  struct Window {
+    Link *prev;
+    Node *curr;
+  };
+
+  Link head;
+  std::atomic<int> length;
+  Compare comp;
+  mutable EpochDomain domain;
+
+  // link helper functions
+  static inline Node *ref(const std::uintptr_t link) {
+    return reinterpret_cast<Node *>(link & ~std::uintptr_t(1));
+  }
+  static inline bool is_marked(const std::uintptr_t link) {
+    return (link & 1) != 0;
+  }
+  static inline std::uintptr_t to_link(const Node *node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  // search helper functions (inside a guard)
+  Window search(const T &value);
+  inline bool matches(const Node *node, const T &value) const {
+    return node != nullptr && !this->comp(value, node->data);
+  }
+
+public:
+  // constructors
+  inline explicit ConcurrentOrderedList<T, Compare>(
+      const Compare &comp = Compare())
+      : head(0), length(0), comp(comp){};
+
+  // threads may hold pointers into the list, so it cannot be copied
+  ConcurrentOrderedList<T, Compare>(const ConcurrentOrderedList<T, Compare> &) =
+      delete;
+  ConcurrentOrderedList<T, Compare> &
+  operator=(const ConcurrentOrderedList<T, Compare> &) = delete;
+
+  // destructor
+  inline ~ConcurrentOrderedList<T, Compare>() { this->clear(); }
+
+  // getters (exact only while no other thread changes the list)
+  inline int get_length() const {
+    return this->length.load(std::memory_order_relaxed);
+  }
+  inline const EpochDomain &get_domain() const { return this->domain; }
+
+  // bool methods (contains is lock-free and never changes the list, its
+  // only write is the slot of its epoch guard)
+  inline bool is_empty() const { return this->get_length() == 0; }
+  bool contains(const T &value) const;
+
+  // adding and removing (lock-free; false when the value is already there
+  // or was not found, another thread may have won the race)
+  bool insert(const T &value);
+  bool remove(const T &value);
+
+  // converting methods (weakly consistent: sees every value present during
+  // the whole walk, may or may not see values changed meanwhile)
+  template <class Fn> void for_each(Fn fn) const;
+  const std::vector<T> to_vector() const;
+
+  // only while no other thread uses the list
+  void clear();
+};
+
+// ---------
+// Search helpers
+// ---------
+
+// Find the window of the value, unlinking (and retiring) marked nodes met
+// on the way
+template <typename T, typename Compare>
+typename ConcurrentOrderedList<T, Compare>::Window
+ConcurrentOrderedList<T, Compare>::search(const T &value) {
+retry:
+  Link *prev = &this->head;
+  Node *curr = ref(prev->load(std::memory_order_acquire));
+
+  while (curr != nullptr) {
+    std::uintptr_t next = curr->next.load(std::memory_order_acquire);
+
+    if (is_marked(next)) {
+      std::uintptr_t expected = to_link(curr);
+      if (!prev->compare_exchange_strong(
+              expected, next & ~std::uintptr_t(1), std::memory_order_acq_rel,
+              std::memory_order_acquire))
+        goto retry;
+
+      this->domain.retire(curr);
+      curr = ref(next);
+      continue;
+    }
+
+    if (!this->comp(curr->data, value))
+      break;
+
+    prev = &curr->next;
+    curr = ref(next);
+  }
+
+  return {prev, curr};
+}
+
+// ---------
+// Methods
+// ---------
+
+// Check if the value is in the list (lock-free, does not unlink anything;
+// the epoch guard publishes its epoch in a slot of the domain)
+template <typename T, typename Compare>
+bool ConcurrentOrderedList<T, Compare>::contains(const T &value) const {
+  EpochGuard guard(this->domain);
+
+  Node *curr = ref(this->head.load(std::memory_order_acquire));
+  while (curr != nullptr && this->comp(curr->data, value))
+    curr = ref(curr->next.load(std::memory_order_acquire));
+
+  return this->matches(curr, value) &&
+         !is_marked(curr->next.load(std::memory_order_acquire));
+}
+
+// Insert the value: one compare-and-swap on the link before its position
+template <typename T, typename Compare>
+bool ConcurrentOrderedList<T, Compare>::insert(const T &value) {
+  EpochGuard guard(this->domain);
+  Node *node = nullptr;
+
+  while (true) {
+    Window window = this->search(value);
+    if (this->matches(window.curr, value)) {
+      delete node; // never published
+      return false;
+    }
+
+    if (node == nullptr)
+      node = new Node(value);
+
+    node->next.store(to_link(window.curr), std::memory_order_relaxed);
+
+    std::uintptr_t expected = to_link(window.curr);
+    if (window.prev->compare_exchange_strong(expected, to_link(node),
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+      this->length.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+}
+
+// Remove the value: marking its next link removes it, then one try to
+// unlink it (a later search unlinks it when that fails)
+template <typename T, typename Compare>
+bool ConcurrentOrderedList<T, Compare>::remove(const T &value) {
+  EpochGuard guard(this->domain);
+
+  while (true) {
+    Window window = this->search(value);
+    if (!this->matches(window.curr, value))
+      return false;
+
+    Node *node = window.curr;
+    std::uintptr_t next = node->next.load(std::memory_order_acquire);
+    if (is_marked(next) ||
+        !node->next.compare_exchange_strong(next, next | 1,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+      continue;
+
+    this->length.fetch_sub(1, std::memory_order_relaxed);
+
+    std::uintptr_t expected = to_link(node);
+    if (window.prev->compare_exchange_strong(expected, next,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire))
+      this->domain.retire(node);
+    else
+      this->search(value);
+
+    return true;
+  }
+}
+
+// Call fn on every present value in order
+template <typename T, typename Compare>
+template <class Fn>
+void ConcurrentOrderedList<T, Compare>::for_each(Fn fn) const {
+  EpochGuard guard(this->domain);
+
+  Node *node = ref(this->head.load(std::memory_order_acquire));
+  while (node != nullptr) {
+    std::uintptr_t next = node->next.load(std::memory_order_acquire);
+    if (!is_marked(next))
+      fn(node->data);
+
+    node = ref(next);
+  }
+}
+
+// Values in order
+template <typename T, typename Compare>
+const std::vector<T> ConcurrentOrderedList<T, Compare>::to_vector() const {
+  std::vector<T> vec;
+  this->for_each([&vec](const T &value) { vec.push_back(value); });
+
+  return vec;
+}
+
+// Free every node, linked or retired (only while no other thread uses the
+// list)
+template <typename T, typename Compare>
+void ConcurrentOrderedList<T, Compare>::clear() {
+  Node *node = ref(this->head.exchange(0, std::memory_order_acquire));
+  while (node != nullptr) {
+    Node *next = ref(node->next.load(std::memory_order_relaxed));
+    delete node;
+    node = next;
+  }
+
+  this->length.store(0, std::memory_order_relaxed);
+  this->domain.drain();
+}
+
+#endif
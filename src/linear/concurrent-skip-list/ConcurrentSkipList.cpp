@@ -0,0 +1,33 @@
+/*
+
+A concurrent skip list lets any number of threads search, insert and
+remove at the same time without locks. A node becomes present when it is
+linked on the bottom level with a single compare-and-swap, and the upper
+levels are linked after it. Removal first marks the links of the node
+(the lowest bit of a pointer), top level first: the thread that marks the
+bottom level owns the removal, and later searches unlink marked nodes as
+they pass them.
+
+Searches (contains/find) never write and never retry, which makes the
+list a good fit for read-heavy workloads. Removed nodes are not freed
+right away, because a reader may still be standing on them: they go on a
+retired stack, and reclaim() frees them when the caller knows no other
+thread uses the list (e.g. between phases, or in the destructor).
+
+Pros:
+    Lock-free insertion and removal, wait-free searches
+    Ordered keys and weakly consistent ordered iteration
+
+Memory is the price: a list that keeps removing keys grows until all
+threads stop and someone calls reclaim(), so long-running users have to
+plan quiescent points, or use a structure with epoch reclamation instead.
+
+Cons:
+    Removed nodes are only freed by reclaim() while the list is quiescent,
+    memory grows without bound otherwise
+    Values cannot be changed in place (remove and insert again)
+    Every node is its own allocation
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,491 @@
+#ifndef CONCURRENTSKIPLIST_H
+#define CONCURRENTSKIPLIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Concurrent skip list node (key and value never change after the node is
+// published; the tower of height next links follows the node, the lowest
+// bit of a link marks the node as removed on that level)
+
+template <class K, class V> class ConcurrentSkipNode {
+public:
+  const K key;
+  const V value;
+  const int height;
+  ConcurrentSkipNode<K, V> *retired; // next node on the retired stack
+  ConcurrentSkipNode(const K &key, const V &value, const int height)
+      : key(key), value(value), height(height), retired(nullptr){};
+
+  inline std::atomic<std::uintptr_t> *next() {
+    return reinterpret_cast<std::atomic<std::uintptr_t> *>(this + 1);
+  }
+};
+
+// Lock-free skip list (ordered set of unique keys with values, any number of
+// threads can insert, remove and search at the same time). Removed nodes are
+// not freed until reclaim() or the destructor, when no other thread uses the
+// list, which is what keeps readers safe without any locking.
+//
+// Memory limit: every successful remove keeps its node until the next
+// reclaim(), so a long-running workload that removes keys grows without
+// bound unless it stops all threads to call reclaim() from time to time
+// (get_retired() tells how many nodes are waiting). A removed node may still
+// be linked on an upper level by a racing insert, so it cannot be freed by
+// epochs while the list is in use; ConcurrentOrderedList has a single level
+// and frees its nodes on the fly.
+
+template <class K, class V, class Compare = std::less<K>>
+class ConcurrentSkipList {
+public:
+  static constexpr int max_height = 24;
+
+private:
+  using Node = ConcurrentSkipNode<K, V>;
+  using Link = std::atomic<std::uintptr_t>;
+
+  Link head[max_height];
+  std::atomic<int> height; // levels that may hold nodes
+  std::atomic<int> length;
+  std::atomic<Node *> retired;
+  std::atomic<int> retired_count;
+  Compare comp;
+
+  // link helper functions
+  static inline Node *ref(const std::uintptr_t link) {
+    return reinterpret_cast<Node *>(link & ~std::uintptr_t(1));
+  }
+  static inline bool is_marked(const std::uintptr_t link) {
+    return (link & 1) != 0;
+  }
+  static inline std::uintptr_t to_link(const Node *node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  // node helper functions
+  static int random_height();
+  static Node *make_node(const K &key, const V &value, const int height);
+  static void free_node(Node *node);
+  void retire(Node *node);
+
+  // search helper functions
+  bool search(const K &key, Link *preds[], Node *succs[]);
+  Node *lower_node(const K &key) const;
+
+public:
+  // constructors
+  explicit ConcurrentSkipList<K, V, Compare>(const Compare &comp = Compare());
+
+  // threads may hold pointers into the list, so it cannot be copied
+  ConcurrentSkipList<K, V, Compare>(const ConcurrentSkipList<K, V, Compare> &) =
+      delete;
+  ConcurrentSkipList<K, V, Compare> &
+  operator=(const ConcurrentSkipList<K, V, Compare> &) = delete;
+
+  // destructor
+  ~ConcurrentSkipList<K, V, Compare>();
+
+  // getters (exact only while no other thread changes the list)
+  inline int get_length() const {
+    return this->length.load(std::memory_order_relaxed);
+  }
+  inline int get_retired() const {
+    return this->retired_count.load(std::memory_order_relaxed);
+  }
+
+  // bool methods
+  inline bool is_empty() const { return this->get_length() == 0; }
+  bool contains(const K &key) const;
+
+  // find (copies the value out, the node may be removed right after)
+  bool find(const K &key, V &value) const;
+
+  // adding and removing (lock-free; false when the key is already there or
+  // was not found, another thread may have won the race)
+  bool insert(const K &key, const V &value);
+  bool remove(const K &key);
+
+  // converting methods (weakly consistent: sees every key present during the
+  // whole walk, may or may not see keys changed meanwhile)
+  template <class Fn> void for_each(Fn fn) const;
+  const std::vector<std::pair<K, V>> to_vector() const;
+
+  // maintenance (only while no other thread uses the list; the only way
+  // to free removed nodes before the destructor)
+  void reclaim();
+  void clear();
+};
+
+// ---------
+// Constructors
+// ---------
+
+// Empty list constructor
+template <typename K, typename V, typename Compare>
+ConcurrentSkipList<K, V, Compare>::ConcurrentSkipList(const Compare &comp)
+    : height(1), length(0), retired(nullptr), retired_count(0), comp(comp) {
+  for (int l = 0; l < max_height; l++)
+    this->head[l].store(0, std::memory_order_relaxed);
+}
+
+// Destructor (no other thread may use the list anymore)
+template <typename K, typename V, typename Compare>
+ConcurrentSkipList<K, V, Compare>::~ConcurrentSkipList() {
+  this->clear();
+}
+
+// ---------
+// Node helpers
+// ---------
+
+// Random height in [1, max_height], each level is kept with probability 1/4
+// (xorshift64* with a state per thread)
+template <typename K, typename V, typename Compare>
+int ConcurrentSkipList<K, V, Compare>::random_height() {
+  static std::atomic<std::uint64_t> seeds(0);
+  thread_local std::uint64_t state =
+      0x9E3779B97F4A7C15ull * (seeds.fetch_add(1) * 2 + 1);
+
+  std::uint64_t x = state;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  state = x;
+
+  std::uint64_t bits = (x * 0x2545F4914F6CDD1Dull) |
+                       (std::uint64_t(1) << (2 * (max_height - 1)));
+  int zeros = 0;
+  while ((bits & 1) == 0) {
+    bits >>= 1;
+    zeros++;
+  }
+
+  return zeros / 2 + 1;
+}
+
+// Allocate a node with its tower of unlinked levels
+template <typename K, typename V, typename Compare>
+ConcurrentSkipNode<K, V> *
+ConcurrentSkipList<K, V, Compare>::make_node(const K &key, const V &value,
+                                             const int height) {
+  void *memory = ::operator new(sizeof(Node) + height * sizeof(Link));
+  Node *node = new (memory) Node(key, value, height);
+
+  for (int l = 0; l < height; l++)
+    new (&node->next()[l]) Link(0);
+
+  return node;
+}
+
+// Destroy and free a node
+template <typename K, typename V, typename Compare>
+void ConcurrentSkipList<K, V, Compare>::free_node(Node *node) {
+  for (int l = 0; l < node->height; l++)
+    node->next()[l].~Link();
+
+  node->~Node();
+  ::operator delete(node);
+}
+
+// Push a removed node on the retired stack (freed by reclaim)
+template <typename K, typename V, typename Compare>
+void ConcurrentSkipList<K, V, Compare>::retire(Node *node) {
+  Node *top = this->retired.load(std::memory_order_relaxed);
+  do {
+    node->retired = top;
+  } while (!this->retired.compare_exchange_weak(top, node,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed));
+
+  this->retired_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ---------
+// Search helpers
+// ---------
+
+// Find the key, unlinking marked nodes met on the way; preds[l] is the
+// tower holding the link on level l before the position of the key and
+// succs[l] the node after it (levels below the current height only)
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipList<K, V, Compare>::search(const K &key, Link *preds[],
+                                               Node *succs[]) {
+retry:
+  Link *links = this->head;
+  Node *curr = nullptr;
+
+  for (int l = this->height.load(std::memory_order_acquire) - 1; l >= 0;
+       l--) {
+    curr = ref(links[l].load(std::memory_order_acquire));
+
+    while (curr != nullptr) {
+      std::uintptr_t succ = curr->next()[l].load(std::memory_order_acquire);
+
+      // curr is removed on this level: swing the link of pred past it
+      while (is_marked(succ)) {
+        std::uintptr_t expected = to_link(curr);
+        if (!links[l].compare_exchange_strong(
+                expected, succ & ~std::uintptr_t(1), std::memory_order_acq_rel,
+                std::memory_order_acquire))
+          goto retry;
+
+        curr = ref(succ);
+        if (curr == nullptr)
+          break;
+
+        succ = curr->next()[l].load(std::memory_order_acquire);
+      }
+
+      if (curr == nullptr || !this->comp(curr->key, key))
+        break;
+
+      links = curr->next();
+      curr = ref(succ);
+    }
+
+    preds[l] = links;
+    succs[l] = curr;
+  }
+
+  return curr != nullptr && !this->comp(key, curr->key);
+}
+
+// First node with key not less than the given one that is not removed
+// (null if none); wait-free, never writes
+template <typename K, typename V, typename Compare>
+ConcurrentSkipNode<K, V> *
+ConcurrentSkipList<K, V, Compare>::lower_node(const K &key) const {
+  const Link *links = this->head;
+  Node *curr = nullptr;
+
+  for (int l = this->height.load(std::memory_order_acquire) - 1; l >= 0;
+       l--) {
+    curr = ref(links[l].load(std::memory_order_acquire));
+
+    while (curr != nullptr) {
+      std::uintptr_t succ = curr->next()[l].load(std::memory_order_acquire);
+
+      // step over removed nodes without unlinking them
+      while (is_marked(succ)) {
+        curr = ref(succ);
+        if (curr == nullptr)
+          break;
+
+        succ = curr->next()[l].load(std::memory_order_acquire);
+      }
+
+      if (curr == nullptr || !this->comp(curr->key, key))
+        break;
+
+      links = curr->next();
+      curr = ref(succ);
+    }
+  }
+
+  return curr;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Check if the key is in the list
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipList<K, V, Compare>::contains(const K &key) const {
+  Node *node = this->lower_node(key);
+  return node != nullptr && !this->comp(key, node->key);
+}
+
+// Copy the value of the key out, false if not found
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipList<K, V, Compare>::find(const K &key, V &value) const {
+  Node *node = this->lower_node(key);
+  if (node == nullptr || this->comp(key, node->key))
+    return false;
+
+  value = node->value;
+  return true;
+}
+
+// Insert the key with its value: the node is linked on the bottom level
+// first (that makes it present), then on the levels above one by one
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipList<K, V, Compare>::insert(const K &key, const V &value) {
+  int top = ConcurrentSkipList<K, V, Compare>::random_height();
+
+  // raise the height first, so the search below fills preds up to top
+  int height = this->height.load(std::memory_order_relaxed);
+  while (height < top &&
+         !this->height.compare_exchange_weak(height, top,
+                                             std::memory_order_acq_rel))
+    ;
+
+  Link *preds[max_height];
+  Node *succs[max_height];
+  Node *node = nullptr;
+
+  while (true) {
+    if (this->search(key, preds, succs)) {
+      if (node != nullptr)
+        ConcurrentSkipList<K, V, Compare>::free_node(node);
+
+      return false;
+    }
+
+    if (node == nullptr)
+      node = ConcurrentSkipList<K, V, Compare>::make_node(key, value, top);
+
+    for (int l = 0; l < top; l++)
+      node->next()[l].store(to_link(succs[l]), std::memory_order_relaxed);
+
+    std::uintptr_t expected = to_link(succs[0]);
+    if (preds[0][0].compare_exchange_strong(expected, to_link(node),
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+      break;
+  }
+
+  this->length.fetch_add(1, std::memory_order_relaxed);
+
+  for (int l = 1; l < top; l++) {
+    while (true) {
+      // a remover marked the node: stop, the search unlinks what is linked
+      std::uintptr_t next = node->next()[l].load(std::memory_order_acquire);
+      if (is_marked(next))
+        return true;
+
+      if (ref(next) != succs[l] &&
+          !node->next()[l].compare_exchange_strong(next, to_link(succs[l]),
+                                                   std::memory_order_acq_rel))
+        continue;
+
+      std::uintptr_t expected = to_link(succs[l]);
+      if (preds[l][l].compare_exchange_strong(expected, to_link(node),
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_acquire))
+        break;
+
+      // the neighbourhood changed: search again, unless the node is gone
+      this->search(key, preds, succs);
+      if (succs[0] != node)
+        return true;
+    }
+  }
+
+  return true;
+}
+
+// Remove the key: mark the links of the node top-down, whoever marks the
+// bottom level removed it, then a search unlinks it everywhere
+template <typename K, typename V, typename Compare>
+bool ConcurrentSkipList<K, V, Compare>::remove(const K &key) {
+  Link *preds[max_height];
+  Node *succs[max_height];
+
+  if (!this->search(key, preds, succs))
+    return false;
+
+  Node *node = succs[0];
+  for (int l = node->height - 1; l >= 1; l--) {
+    std::uintptr_t next = node->next()[l].load(std::memory_order_acquire);
+    while (!is_marked(next) &&
+           !node->next()[l].compare_exchange_weak(next, next | 1,
+                                                  std::memory_order_acq_rel))
+      ;
+  }
+
+  std::uintptr_t next = node->next()[0].load(std::memory_order_acquire);
+  while (true) {
+    if (is_marked(next))
+      return false;
+
+    if (node->next()[0].compare_exchange_weak(next, next | 1,
+                                              std::memory_order_acq_rel)) {
+      this->search(key, preds, succs);
+      this->length.fetch_sub(1, std::memory_order_relaxed);
+      this->retire(node);
+      return true;
+    }
+  }
+}
+
+// Call fn(key, value) on every present pair in key order
+template <typename K, typename V, typename Compare>
+template <class Fn>
+void ConcurrentSkipList<K, V, Compare>::for_each(Fn fn) const {
+  Node *node = ref(this->head[0].load(std::memory_order_acquire));
+
+  while (node != nullptr) {
+    std::uintptr_t next = node->next()[0].load(std::memory_order_acquire);
+    if (!is_marked(next))
+      fn(node->key, node->value);
+
+    node = ref(next);
+  }
+}
+
+// Pairs of key and value in key order
+template <typename K, typename V, typename Compare>
+const std::vector<std::pair<K, V>>
+ConcurrentSkipList<K, V, Compare>::to_vector() const {
+  std::vector<std::pair<K, V>> vec;
+  this->for_each(
+      [&vec](const K &key, const V &value) { vec.emplace_back(key, value); });
+
+  return vec;
+}
+
+// Unlink removed nodes still linked on some level (an insert may link a
+// level after the remover's search went past it) and free retired nodes
+template <typename K, typename V, typename Compare>
+void ConcurrentSkipList<K, V, Compare>::reclaim() {
+  for (int l = 0; l < max_height; l++) {
+    Link *links = this->head;
+    Node *curr = ref(links[l].load(std::memory_order_relaxed));
+
+    while (curr != nullptr) {
+      std::uintptr_t succ = curr->next()[l].load(std::memory_order_relaxed);
+      if (is_marked(succ)) {
+        links[l].store(succ & ~std::uintptr_t(1), std::memory_order_relaxed);
+      } else {
+        links = curr->next();
+      }
+
+      curr = ref(succ);
+    }
+  }
+
+  Node *node = this->retired.exchange(nullptr, std::memory_order_acquire);
+  this->retired_count.store(0, std::memory_order_relaxed);
+  while (node != nullptr) {
+    Node *next = node->retired;
+    ConcurrentSkipList<K, V, Compare>::free_node(node);
+    node = next;
+  }
+}
+
+// Free every node (only while no other thread uses the list)
+template <typename K, typename V, typename Compare>
+void ConcurrentSkipList<K, V, Compare>::clear() {
+  this->reclaim();
+
+  Node *node = ref(this->head[0].load(std::memory_order_relaxed));
+  while (node != nullptr) {
+    Node *next = ref(node->next()[0].load(std::memory_order_relaxed));
+    ConcurrentSkipList<K, V, Compare>::free_node(node);
+    node = next;
+  }
+
+  for (int l = 0; l < max_height; l++)
+    this->head[l].store(0, std::memory_order_relaxed);
+
+  this->height.store(1, std::memory_order_relaxed);
+  this->length.store(0, std::memory_order_relaxed);
+}
+
+#endif
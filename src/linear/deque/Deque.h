@@ -0,0 +1,273 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// Deque on a ring buffer (capacity is always a power of two)
+
+template <class T> class Deque {
+private:
+  T *buffer;
+  int head;
+  int size;
+  int capacity;
+
+  // ring buffer helper functions
+  inline int physical(const int &index) const {
+    return (this->head + index) & (this->capacity - 1);
+  }
+  static int round_capacity(const int &capacity);
+
+public:
+  // constructors
+  inline explicit Deque<T>(const int capacity = 8)
+      : head(0), size(0), capacity(Deque<T>::round_capacity(capacity)) {
+    this->buffer = new T[this->capacity];
+  };
+  Deque<T>(const std::vector<T> &vec);
+  Deque<T>(const Deque<T> &other);
+
+  // destructor
+  inline ~Deque<T>() {
+    delete[] this->buffer;
+    this->buffer = nullptr;
+  };
+
+  // equal operator
+  Deque<T> &operator=(const Deque<T> &other);
+
+  // resize buffer method
+  void reserve(const int &new_capacity);
+
+  // getters
+  inline int get_size() const { return this->size; }
+  inline int get_capacity() const { return this->capacity; }
+
+  // bool methods
+  inline bool is_empty() const { return this->size == 0; }
+  inline bool is_full() const { return this->size == this->capacity; }
+  bool contains(const T &value) const;
+
+  // adding to the deque
+  void push_back(const T &value);
+  void push_front(const T &value);
+
+  // removing from the deque
+  T pop_back();
+  T pop_front();
+  inline void clear() { this->head = this->size = 0; }
+
+  // get element methods
+  T front() const;
+  T back() const;
+  T at(const int &index) const;
+  inline T operator[](const int &index) const { return this->at(index); }
+
+  // converting methods
+  const std::vector<T> to_vector() const;
+  const std::string to_string() const;
+
+  // compare methods
+  bool operator==(const Deque<T> &other) const;
+  bool operator!=(const Deque<T> &other) const { return !(*this == other); }
+};
+
+//----------
+// Constructors
+// ----------
+
+// Based on vector constructor
+template <typename T>
+Deque<T>::Deque(const std::vector<T> &vec) : Deque<T>(vec.size()) {
+  for (const T &element : vec)
+    this->push_back(element);
+}
+
+// Copy constructor (deep copy)
+template <typename T>
+Deque<T>::Deque(const Deque<T> &other)
+    : head(0), size(other.size), capacity(other.capacity) {
+  this->buffer = new T[this->capacity];
+  for (int i = 0; i < other.size; i++)
+    this->buffer[i] = other.buffer[other.physical(i)];
+}
+
+// Equal operator
+template <typename T> Deque<T> &Deque<T>::operator=(const Deque<T> &other) {
+  if (this == &other)
+    return *this;
+
+  T *new_buffer = new T[other.capacity];
+  for (int i = 0; i < other.size; i++)
+    new_buffer[i] = other.buffer[other.physical(i)];
+
+  delete[] this->buffer;
+  this->buffer = new_buffer;
+  this->head = 0;
+  this->size = other.size;
+  this->capacity = other.capacity;
+
+  return *this;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Smallest power of two >= capacity (at most 2^30, the largest int power of
+// two)
+template <typename T> int Deque<T>::round_capacity(const int &capacity) {
+  if (capacity < 0)
+    throw std::invalid_argument("Capacity should not be < 0!");
+  if (capacity > (1 << 30))
+    throw std::length_error("Capacity should not be > 2^30!");
+
+  int rounded = 1;
+  while (rounded < capacity)
+    rounded <<= 1;
+
+  return rounded;
+}
+
+// Grow the buffer (elements are unwrapped to the start)
+template <typename T> void Deque<T>::reserve(const int &new_capacity) {
+  if (new_capacity <= this->capacity)
+    return;
+
+  int rounded = Deque<T>::round_capacity(new_capacity);
+  T *new_buffer = new T[rounded];
+  for (int i = 0; i < this->size; i++)
+    new_buffer[i] = this->buffer[this->physical(i)];
+
+  delete[] this->buffer;
+  this->buffer = new_buffer;
+  this->head = 0;
+  this->capacity = rounded;
+}
+
+// Push to the back (capacity is a power of two, so rounding capacity + 1
+// doubles it)
+template <typename T> void Deque<T>::push_back(const T &value) {
+  if (this->is_full())
+    this->reserve(this->capacity + 1);
+
+  this->buffer[this->physical(this->size)] = value;
+  this->size++;
+}
+
+// Push to the front
+template <typename T> void Deque<T>::push_front(const T &value) {
+  if (this->is_full())
+    this->reserve(this->capacity + 1);
+
+  this->head = (this->head - 1) & (this->capacity - 1);
+  this->buffer[this->head] = value;
+  this->size++;
+}
+
+// Pop from the back
+template <typename T> T Deque<T>::pop_back() {
+  if (this->is_empty())
+    throw std::length_error("Deque is empty!");
+
+  this->size--;
+  return this->buffer[this->physical(this->size)];
+}
+
+// Pop from the front
+template <typename T> T Deque<T>::pop_front() {
+  if (this->is_empty())
+    throw std::length_error("Deque is empty!");
+
+  T popped = this->buffer[this->head];
+  this->head = (this->head + 1) & (this->capacity - 1);
+  this->size--;
+
+  return popped;
+}
+
+// Get front element
+template <typename T> T Deque<T>::front() const {
+  if (this->is_empty())
+    throw std::length_error("Deque is empty!");
+
+  return this->buffer[this->head];
+}
+
+// Get back element
+template <typename T> T Deque<T>::back() const {
+  if (this->is_empty())
+    throw std::length_error("Deque is empty!");
+
+  return this->buffer[this->physical(this->size - 1)];
+}
+
+// Get by index (from the front)
+template <typename T> T Deque<T>::at(const int &index) const {
+  if (this->is_empty())
+    throw std::length_error("Deque is empty!");
+
+  if (index < 0 || index >= this->size)
+    throw std::out_of_range("Provided index is out of range!");
+
+  return this->buffer[this->physical(index)];
+}
+
+// Contains in deque
+template <typename T> bool Deque<T>::contains(const T &value) const {
+  for (int i = 0; i < this->size; i++) {
+    if (this->buffer[this->physical(i)] == value)
+      return true;
+  }
+
+  return false;
+}
+
+// To vector (from the front to the back)
+template <typename T> const std::vector<T> Deque<T>::to_vector() const {
+  std::vector<T> vec;
+  vec.reserve(this->size);
+  for (int i = 0; i < this->size; i++)
+    vec.push_back(this->buffer[this->physical(i)]);
+
+  return vec;
+}
+
+// To string
+template <typename T> const std::string Deque<T>::to_string() const {
+  if (this->is_empty())
+    throw std::length_error("Deque is empty!");
+
+  std::stringstream ss;
+  for (int i = 0; i < this->size; i++) {
+    if (i != 0)
+      ss << ", ";
+
+    ss << this->buffer[this->physical(i)];
+  }
+
+  ss << ".";
+  return ss.str();
+}
+
+// ---------
+// Compare
+// ---------
+
+// Equal to
+template <typename T> bool Deque<T>::operator==(const Deque<T> &other) const {
+  if (this->size != other.size)
+    return false;
+
+  for (int i = 0; i < this->size; i++) {
+    if (this->buffer[this->physical(i)] != other.buffer[other.physical(i)])
+      return false;
+  }
+
+  return true;
+}
+
+#endif
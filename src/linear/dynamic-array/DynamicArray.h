@@ -1,8 +1,13 @@
 #ifndef DYNAMICARRAY_H
 #define DYNAMICARRAY_H
 
+#include <ArrayView.h>
 #include <Iterator.h>
+#include <MatchMask.h>
+#include <Pipeline.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -12,53 +17,101 @@
 #include <queue>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
-// Dynamic array
+// Inline storage of a small dynamic array (empty if N = 0)
 
-template <class T> class DynamicArray {
+template <class T, int N> class InlineStorage {
+protected:
+  T buffer[N];
+  inline T *inline_data() const { return const_cast<T *>(this->buffer); }
+};
+
+template <class T> class InlineStorage<T, 0> {
+protected:
+  inline T *inline_data() const { return nullptr; }
+};
+
+// Dynamic array (keeps up to N elements inline before using the heap)
+
+template <class T, int N = 0> class DynamicArray : private InlineStorage<T, N> {
 private:
-  T *array;
+  T *array = nullptr;
   int size;
   int capacity;
 
+  // storage helper functions
+  T *allocate(const int &capacity);
+  void deallocate(T *array) const;
+  void grow();
+
+  // copy-on-write state (reference counter is shared by all copies)
+  mutable std::atomic<int> *refs = nullptr;
+  bool cow = false;
+
+  // copy-on-write helper functions
+  void adopt(T *new_array);
+  void release();
+
+  // iterator position helper functions (checked in every build)
+  int position(const Iterator<const T> &it, const bool end_allowed) const;
+  inline Iterator<T> to_mutable(const Iterator<const T> &it) {
+    return Iterator<T>(this->array, this->size,
+                       static_cast<int>(it.get_pointer() - this->array));
+  }
+
   // merge sort helper functions
   void merge_sort_helper(int left, int right, std::function<bool(T, T)> comp);
   void merge(int left, int mid, int right, std::function<bool(T, T)> comp);
 
 public:
   // constructors
-  inline explicit DynamicArray<T>() : array(nullptr), size(0), capacity(0){};
-  inline explicit DynamicArray<T>(const int &capacity)
+  inline explicit DynamicArray<T, N>()
+      : array(this->inline_data()), size(0), capacity(N){};
+  inline explicit DynamicArray<T, N>(const int &capacity)
       : size(0), capacity(capacity) {
-    this->array = new T[capacity];
+    this->array = this->allocate(capacity);
   }
-  DynamicArray<T>(const int &size, const T &value);
-  DynamicArray<T>(const int &size, T *arr);
-  DynamicArray<T>(const std::vector<T> &vec);
-  template <typename Iterator> DynamicArray<T>(Iterator begin, Iterator end);
-  DynamicArray<T>(const DynamicArray<T> &other);
+  DynamicArray<T, N>(const int &size, const T &value);
+  DynamicArray<T, N>(const int &size, T *arr);
+  DynamicArray<T, N>(const std::vector<T> &vec);
+  template <typename Iterator> DynamicArray<T, N>(Iterator begin, Iterator end);
+  DynamicArray<T, N>(const DynamicArray<T, N> &other);
 
   // specified constructors
-  DynamicArray<int>(const int &size, const int &min, const int &max);
-  DynamicArray<char>(const std::string &str);
+  DynamicArray<T, N>(const int &size, const T &min, const T &max);
+  DynamicArray<T, N>(const std::string &str);
 
   // equal operator
-  DynamicArray<T> &operator=(const DynamicArray<T> &other);
+  DynamicArray<T, N> &operator=(const DynamicArray<T, N> &other);
 
   // destructor
-  inline ~DynamicArray<T>() {
-    delete[] array;
-    this->array = nullptr;
-  }
+  inline ~DynamicArray<T, N>() { this->release(); }
 
   // resize array method
   void resize(const int &capacity);
 
-  // getters
-  inline T *get_array() const { return this->array; }
+  // copy-on-write
+  void set_copy_on_write(const bool enabled);
+  void detach();
+  inline bool is_copy_on_write() const { return this->cow; }
+  inline bool is_inline() const {
+    return N > 0 && this->array == this->inline_data();
+  }
+  inline int use_count() const {
+    return this->refs == nullptr ? 1 : this->refs->load();
+  }
+
+  // getters (the mutable buffer is detached from a shared copy-on-write one
+  // first, the const one shares it)
+  inline const T *get_array() const { return this->array; }
+  inline T *get_array() {
+    this->detach();
+    return this->array;
+  }
   inline int get_size() const { return this->size; }
   inline int get_capacity() const { return this->capacity; }
 
@@ -85,10 +138,22 @@ public:
   void erase_all(const T &element);
   void erase_if(std::function<bool(T)> fn);
 
-  // find
-  Iterator<T> find(const T &element) const;
-  std::vector<Iterator<T>> find_all(const T &element) const;
-  std::vector<Iterator<T>> find_if(std::function<bool(T)> fn) const;
+  // find (mutable iterators detach a shared copy-on-write buffer first)
+  Iterator<const T> find(const T &element) const;
+  std::vector<Iterator<const T>> find_all(const T &element) const;
+  std::vector<Iterator<const T>> find_if(std::function<bool(T)> fn) const;
+  Iterator<T> find(const T &element);
+  std::vector<Iterator<T>> find_all(const T &element);
+  std::vector<Iterator<T>> find_if(std::function<bool(T)> fn);
+
+  // compact find (indexes, bitmap of matches, visitor without results)
+  std::vector<int> find_all_indices(const T &element) const;
+  template <class Fn> std::vector<int> find_if_indices(Fn fn) const;
+  MatchMask match_mask(const T &element) const;
+  template <class Fn> MatchMask match_mask_if(Fn fn) const;
+  template <class Fn> void for_each_match(const T &element, Fn fn) const;
+  template <class Fn, class Visit>
+  void for_each_match_if(Fn fn, Visit visit) const;
 
   // replace
   void replace(const T &element, const T &replace);
@@ -102,26 +167,45 @@ public:
   inline const std::vector<T> to_vector() const {
     return std::vector<T>(this->array, this->array + this->get_size());
   }
-  static inline DynamicArray<T> from_vector(const std::vector<T> &vec) {
-    return DynamicArray<T>(vec);
+  static inline DynamicArray<T, N> from_vector(const std::vector<T> &vec) {
+    return DynamicArray<T, N>(vec);
   }
   const std::string to_string() const;
 
+  // views (non-owning; a mutable view first detaches a shared copy-on-write
+  // buffer, a read-only one shares it)
+  inline ArrayView<const T> view() const {
+    return ArrayView<const T>(this->array, this->size);
+  }
+  inline ArrayView<const T> slice(const int &from, const int &to) const {
+    return this->view().slice(from, to);
+  }
+  inline ArrayView<T> view() {
+    this->detach();
+    return ArrayView<T>(this->array, this->size);
+  }
+  inline ArrayView<T> slice(const int &from, const int &to) {
+    return this->view().slice(from, to);
+  }
+
+  // lazy pipeline (stages are fused into one pass on the terminal operation)
+  inline Pipeline<T> pipe() const { return Pipeline<T>(this->view()); }
+
   // useful functions
   int count(const T &element) const;
   int count_if(std::function<bool(T)> fn) const;
-  DynamicArray<T> filter(std::function<bool(T)> fn) const;
+  DynamicArray<T, N> filter(std::function<bool(T)> fn) const;
   void map(std::function<void(T)> fn) const;
-  DynamicArray<T> apply(std::function<T(T)> fn) const;
+  DynamicArray<T, N> apply(std::function<T(T)> fn) const;
   T reduce(T init, std::function<T(T, T)> fn = std::plus<T>()) const;
   void reverse();
-  DynamicArray<T> reversed() const;
+  DynamicArray<T, N> reversed() const;
   void reverse_partial(const Iterator<T> it1, const Iterator<T> it2);
-  DynamicArray<T> reversed_partial(const Iterator<T> it1,
+  DynamicArray<T, N> reversed_partial(const Iterator<T> it1,
                                    const Iterator<T> it2) const;
-  DynamicArray<T> remove_duplicates() const;
+  DynamicArray<T, N> remove_duplicates() const;
   std::map<T, int> frequency_map() const;
-  static void swap(DynamicArray<T> &a, DynamicArray<T> &b);
+  static void swap(DynamicArray<T, N> &a, DynamicArray<T, N> &b);
 
   // min/max find
   T max() const;
@@ -137,30 +221,40 @@ public:
   void merge_sort(std::function<bool(T, T)> comp = std::less<T>());
 
   // union
-  DynamicArray<T> operator|(const DynamicArray<T> &other) const;
+  DynamicArray<T, N> operator|(const DynamicArray<T, N> &other) const;
   // intersect
-  DynamicArray<T> operator&(const DynamicArray<T> &other) const;
+  DynamicArray<T, N> operator&(const DynamicArray<T, N> &other) const;
   // merge
-  DynamicArray<T> operator+(const DynamicArray<T> &other) const;
+  DynamicArray<T, N> operator+(const DynamicArray<T, N> &other) const;
 
-  // iterators
-  inline Iterator<T> begin() const {
+  // iterators (half-open: end() is one past the last element; mutable ones
+  // detach a shared copy-on-write buffer first, so writing through them never
+  // reaches another copy until the array is copied again)
+  inline Iterator<const T> begin() const {
+    return Iterator<const T>(this->array, this->size);
+  }
+  inline Iterator<const T> end() const {
+    return Iterator<const T>(this->array, this->size, this->size);
+  }
+  inline Iterator<T> begin() {
+    this->detach();
     return Iterator<T>(this->array, this->size);
   }
-  inline Iterator<T> end() const {
-    return Iterator<T>(this->array, this->size, this->size - 1);
+  inline Iterator<T> end() {
+    this->detach();
+    return Iterator<T>(this->array, this->size, this->size);
   }
 
   // compare methods
-  bool operator>(const DynamicArray<T> &other) const;
-  bool operator<(const DynamicArray<T> &other) const;
-  bool operator==(const DynamicArray<T> &other) const;
-  bool operator!=(const DynamicArray<T> &other) const;
+  bool operator>(const DynamicArray<T, N> &other) const;
+  bool operator<(const DynamicArray<T, N> &other) const;
+  bool operator==(const DynamicArray<T, N> &other) const;
+  bool operator!=(const DynamicArray<T, N> &other) const;
 
   // some functions
-  Iterator<T> distinct() const;
-  std::vector<Iterator<T>> distinct_all() const;
-  Iterator<T> kth_distinct(const int &k) const;
+  Iterator<const T> distinct() const;
+  std::vector<Iterator<const T>> distinct_all() const;
+  Iterator<const T> kth_distinct(const int &k) const;
   std::vector<T> top_k_frequent(const int &k) const;
 };
 
@@ -169,62 +263,73 @@ public:
 // ----------
 
 // Fill constructor
-template <typename T>
-DynamicArray<T>::DynamicArray(const int &size, const T &value)
+template <typename T, int N>
+DynamicArray<T, N>::DynamicArray(const int &size, const T &value)
     : size(size), capacity(size) {
-  this->array = new T[capacity];
+  this->array = this->allocate(capacity);
   std::fill(this->array, this->array + size, value);
 }
 
 // Based on T* array constructor
-template <typename T>
-DynamicArray<T>::DynamicArray(const int &size, T *arr)
+template <typename T, int N>
+DynamicArray<T, N>::DynamicArray(const int &size, T *arr)
     : size(size), capacity(size) {
-  this->array = new T[capacity];
+  this->array = this->allocate(capacity);
   for (int i = 0; i < this->size; i++)
     this->array[i] = arr[i];
 }
 
 // Based on vector constructor
-template <typename T>
-DynamicArray<T>::DynamicArray(const std::vector<T> &vec)
+template <typename T, int N>
+DynamicArray<T, N>::DynamicArray(const std::vector<T> &vec)
     : size(vec.size()), capacity(vec.size()) {
-  this->array = new T[vec.size()];
+  this->array = this->allocate(vec.size());
   for (int i = 0; i < this->size; i++)
     this->array[i] = vec[i];
 }
 
 // Based on range vector iterator constructor
-template <typename T>
+template <typename T, int N>
 template <typename Iterator>
-DynamicArray<T>::DynamicArray(Iterator begin, Iterator end) {
+DynamicArray<T, N>::DynamicArray(Iterator begin, Iterator end) {
   if (begin >= end)
     throw std::invalid_argument(
         "The first iterator must be less than the second iterator!");
 
   this->size = this->capacity = std::distance(begin, end);
-  this->array = new T[this->size];
+  this->array = this->allocate(this->size);
 
   int i = 0;
   for (Iterator it = begin; it != end; ++it, ++i)
     this->array[i] = *it;
 }
 
-// Copy constructor (deep copy)
-template <typename T>
-DynamicArray<T>::DynamicArray(const DynamicArray &other)
-    : size(other.size), capacity(other.capacity) {
-  this->array = new T[other.capacity];
+// Copy constructor (deep copy, or shared buffer in copy-on-write mode)
+template <typename T, int N>
+DynamicArray<T, N>::DynamicArray(const DynamicArray &other)
+    : array(nullptr), size(other.size), capacity(other.capacity),
+      cow(other.cow) {
+  if (other.refs != nullptr) {
+    other.refs->fetch_add(1, std::memory_order_relaxed);
+    this->array = other.array;
+    this->refs = other.refs;
+    return;
+  }
+
+  T *new_array = this->allocate(other.capacity);
   for (int i = 0; i < this->size; i++)
-    this->array[i] = other[i];
+    new_array[i] = other.array[i];
+
+  this->adopt(new_array);
 }
 
 // Fill int array with random numbers from range
-template <>
-inline DynamicArray<int>::DynamicArray(const int &size, const int &min,
-                                       const int &max)
+template <typename T, int N>
+DynamicArray<T, N>::DynamicArray(const int &size, const T &min, const T &max)
     : size(size), capacity(size) {
-  this->array = new int[capacity];
+  static_assert(std::is_integral<T>::value,
+                "Random range constructor needs an integral type!");
+  this->array = this->allocate(capacity);
 
   static bool seed_initialized = false;
   if (!seed_initialized) {
@@ -233,34 +338,46 @@ inline DynamicArray<int>::DynamicArray(const int &size, const int &min,
   }
 
   for (int i = 0; i < size; i++) {
-    int num = min + std::rand() % ((max + 1) - min);
+    T num = min + std::rand() % ((max + 1) - min);
     this->array[i] = num;
   }
 }
 
 // Form array from string
-template <>
-inline DynamicArray<char>::DynamicArray(const std::string &str)
+template <typename T, int N>
+DynamicArray<T, N>::DynamicArray(const std::string &str)
     : size(str.size()), capacity(str.size()) {
-
-  this->array = new char[this->capacity];
+  static_assert(std::is_same<T, char>::value,
+                "String constructor needs a char array!");
+  this->array = this->allocate(this->capacity);
   for (int i = 0; i < this->size; i++) {
     this->array[i] = str[i];
   }
 }
 
 // Equal operator
-template <typename T>
-DynamicArray<T> &DynamicArray<T>::operator=(const DynamicArray<T> &other) {
+template <typename T, int N>
+DynamicArray<T, N> &
+DynamicArray<T, N>::operator=(const DynamicArray<T, N> &other) {
   if (this != &other) {
-    delete[] array;
+    this->cow = other.cow;
+
+    if (other.refs != nullptr) {
+      other.refs->fetch_add(1, std::memory_order_relaxed);
+      this->release();
+      this->array = other.array;
+      this->refs = other.refs;
+    } else {
+      this->release();
+      T *new_array = this->allocate(other.capacity);
+      for (int i = 0; i < other.size; i++)
+        new_array[i] = other.array[i];
+
+      this->adopt(new_array);
+    }
 
     this->size = other.size;
     this->capacity = other.capacity;
-    this->array = new T[other.capacity];
-
-    for (int i = 0; i < this->size; i++)
-      this->array[i] = other[i];
   }
 
   return *this;
@@ -271,8 +388,8 @@ DynamicArray<T> &DynamicArray<T>::operator=(const DynamicArray<T> &other) {
 // ----------
 
 // Greater than
-template <typename T>
-bool DynamicArray<T>::operator>(const DynamicArray<T> &other) const {
+template <typename T, int N>
+bool DynamicArray<T, N>::operator>(const DynamicArray<T, N> &other) const {
   if (this->size > other.size)
     return true;
 
@@ -289,8 +406,8 @@ bool DynamicArray<T>::operator>(const DynamicArray<T> &other) const {
 }
 
 // Less than
-template <typename T>
-bool DynamicArray<T>::operator<(const DynamicArray<T> &other) const {
+template <typename T, int N>
+bool DynamicArray<T, N>::operator<(const DynamicArray<T, N> &other) const {
   if (this->size < other.size)
     return true;
 
@@ -307,8 +424,8 @@ bool DynamicArray<T>::operator<(const DynamicArray<T> &other) const {
 }
 
 // Equal to
-template <typename T>
-bool DynamicArray<T>::operator==(const DynamicArray<T> &other) const {
+template <typename T, int N>
+bool DynamicArray<T, N>::operator==(const DynamicArray<T, N> &other) const {
   if (this->size != other.size)
     return false;
 
@@ -321,8 +438,8 @@ bool DynamicArray<T>::operator==(const DynamicArray<T> &other) const {
 }
 
 // Not equal to
-template <typename T>
-bool DynamicArray<T>::operator!=(const DynamicArray<T> &other) const {
+template <typename T, int N>
+bool DynamicArray<T, N>::operator!=(const DynamicArray<T, N> &other) const {
   return !(*this == other);
 }
 
@@ -331,22 +448,131 @@ bool DynamicArray<T>::operator!=(const DynamicArray<T> &other) const {
 // ---------
 
 // Resize array
-template <typename T> void DynamicArray<T>::resize(const int &new_capacity) {
+template <typename T, int N>
+void DynamicArray<T, N>::resize(const int &new_capacity) {
   if (new_capacity <= this->capacity)
     return;
 
-  T *new_array = new T[new_capacity];
-  if (this->array != nullptr) {
-    std::memcpy(new_array, this->array, this->size * sizeof(T));
-    delete[] this->array;
+  if (new_capacity <= N && this->is_inline()) {
+    this->capacity = new_capacity;
+    return;
   }
 
-  this->array = new_array;
+  T *new_array = this->allocate(new_capacity);
+  for (int i = 0; i < this->size; i++)
+    new_array[i] = this->array[i];
+
+  this->adopt(new_array);
   this->capacity = new_capacity;
 }
 
+// ---------
+// Copy-on-write
+// ---------
+
+// Enable/disable sharing the buffer between copies
+template <typename T, int N>
+void DynamicArray<T, N>::set_copy_on_write(const bool enabled) {
+  if (this->cow == enabled)
+    return;
+
+  if (enabled) {
+    if (this->array != nullptr && !this->is_inline())
+      this->refs = new std::atomic<int>(1);
+  } else {
+    this->detach();
+    delete this->refs;
+    this->refs = nullptr;
+  }
+
+  this->cow = enabled;
+}
+
+// Take a private copy of a shared buffer before modifying it
+template <typename T, int N> void DynamicArray<T, N>::detach() {
+  if (this->refs == nullptr ||
+      this->refs->load(std::memory_order_acquire) == 1)
+    return;
+
+  T *new_array = this->allocate(this->capacity);
+  for (int i = 0; i < this->size; i++)
+    new_array[i] = this->array[i];
+
+  this->adopt(new_array);
+}
+
+// Replace the buffer with a newly allocated one
+template <typename T, int N> void DynamicArray<T, N>::adopt(T *new_array) {
+  this->release();
+  this->array = new_array;
+
+  if (this->cow && !this->is_inline())
+    this->refs = new std::atomic<int>(1);
+}
+
+// Drop the reference to the buffer (the last owner frees it)
+template <typename T, int N> void DynamicArray<T, N>::release() {
+  if (this->refs == nullptr) {
+    this->deallocate(this->array);
+  } else if (this->refs->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    this->deallocate(this->array);
+    delete this->refs;
+  }
+
+  this->array = nullptr;
+  this->refs = nullptr;
+}
+
+// ---------
+// Iterator positions
+// ---------
+
+// Index of an iterator into this array, end() only if end_allowed (checked
+// in every build, unchecked iterators do not know their array)
+template <typename T, int N>
+int DynamicArray<T, N>::position(const Iterator<const T> &it,
+                                 const bool end_allowed) const {
+  const T *ptr = it.get_pointer(), *last = this->array + this->size;
+  std::less<const T *> less;
+
+  if (less(ptr, this->array) || less(last, ptr) ||
+      (!end_allowed && ptr == last))
+    throw std::out_of_range("Iterator is out of range!");
+
+  return static_cast<int>(ptr - this->array);
+}
+
+// ---------
+// Storage
+// ---------
+
+// Allocate a buffer (the inline one if it is free and big enough)
+template <typename T, int N>
+T *DynamicArray<T, N>::allocate(const int &capacity) {
+  if (N > 0 && capacity <= N && !this->is_inline())
+    return this->inline_data();
+
+  return new T[capacity];
+}
+
+// Free a buffer (the inline one is never freed)
+template <typename T, int N>
+void DynamicArray<T, N>::deallocate(T *array) const {
+  if (N == 0 || array != this->inline_data())
+    delete[] array;
+}
+
+// Make room for one more element (only small arrays grow by themselves)
+template <typename T, int N> void DynamicArray<T, N>::grow() {
+  if (N == 0)
+    throw std::length_error("Array is full, try to resize it!");
+
+  this->resize(std::max(2 * this->capacity, N));
+}
+
 // Contains element in array
-template <typename T> bool DynamicArray<T>::contains(const T &value) const {
+template <typename T, int N>
+bool DynamicArray<T, N>::contains(const T &value) const {
   for (int i = 0; i < this->size; i++) {
     if (this->array[i] == value)
       return true;
@@ -356,7 +582,7 @@ template <typename T> bool DynamicArray<T>::contains(const T &value) const {
 }
 
 // Get element by index from array
-template <typename T> T DynamicArray<T>::at(const int &index) const {
+template <typename T, int N> T DynamicArray<T, N>::at(const int &index) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -367,48 +593,56 @@ template <typename T> T DynamicArray<T>::at(const int &index) const {
 }
 
 // Push back
-template <typename T> void DynamicArray<T>::push_back(const T &value) {
+template <typename T, int N>
+void DynamicArray<T, N>::push_back(const T &value) {
   if (this->is_full())
-    throw std::length_error("Array is full, try to resize it!");
+    this->grow();
 
+  this->detach();
   this->array[this->size++] = value;
 }
 
 // Push begin
-template <typename T> void DynamicArray<T>::push_begin(const T &value) {
+template <typename T, int N>
+void DynamicArray<T, N>::push_begin(const T &value) {
   if (this->is_full())
-    throw std::length_error("Array is full, try to resize it!");
+    this->grow();
 
-  for (int i = ++this->size; i > 0; i--)
+  this->detach();
+  for (int i = this->size; i > 0; i--)
     this->array[i] = this->array[i - 1];
 
   this->array[0] = value;
+  ++this->size;
 }
 
 // Insert at given index
-template <typename T>
-void DynamicArray<T>::insert(const int &index, const T &value) {
+template <typename T, int N>
+void DynamicArray<T, N>::insert(const int &index, const T &value) {
   if (this->is_full())
-    throw std::length_error("Array is full, try to resize it!");
+    this->grow();
 
   if (index < 0 || index >= this->size)
     throw std::out_of_range("Provided index is out of range!");
 
-  for (int i = ++this->size; i >= index; i--)
+  this->detach();
+  for (int i = this->size; i > index; i--)
     this->array[i] = this->array[i - 1];
 
   this->array[index] = value;
+  ++this->size;
 }
 
 // Insert vector at given index
-template <typename T>
-void DynamicArray<T>::insert(const int &index, const std::vector<T> &vec) {
+template <typename T, int N>
+void DynamicArray<T, N>::insert(const int &index, const std::vector<T> &vec) {
   if (this->is_full())
-    throw std::length_error("Array is full, try to resize it!");
+    this->grow();
 
   if (index < 0 || index >= this->size)
     throw std::out_of_range("Provided index is out of range!");
 
+  this->detach();
   if (this->size + vec.size() > this->capacity)
     this->resize(this->size + vec.size());
 
@@ -422,7 +656,7 @@ void DynamicArray<T>::insert(const int &index, const std::vector<T> &vec) {
 }
 
 // Erase from back
-template <typename T> void DynamicArray<T>::erase_back() {
+template <typename T, int N> void DynamicArray<T, N>::erase_back() {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -430,10 +664,11 @@ template <typename T> void DynamicArray<T>::erase_back() {
 }
 
 // Erase from begin
-template <typename T> void DynamicArray<T>::erase_begin() {
+template <typename T, int N> void DynamicArray<T, N>::erase_begin() {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
+  this->detach();
   for (int i = 0; i < this->size - 1; i++) {
     this->array[i] = this->array[i + 1];
   }
@@ -442,66 +677,74 @@ template <typename T> void DynamicArray<T>::erase_begin() {
 }
 
 // Erase element by given position of iterator
-template <typename T> void DynamicArray<T>::erase(const Iterator<T> it) {
+template <typename T, int N>
+void DynamicArray<T, N>::erase(const Iterator<T> it) {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  for (Iterator<T> it2 = it + 1; it2 != end() + 1; ++it2)
-    *(it2 - 1) = *it2;
+  int index = this->position(it, false);
+  this->detach();
+  for (int i = index + 1; i < this->size; i++)
+    this->array[i - 1] = this->array[i];
 
   --this->size;
 }
 
-// Erase element in give iterator range
-template <typename T>
-void DynamicArray<T>::erase_range(const Iterator<T> it1,
+// Erase elements in the iterator range [it1, it2)
+template <typename T, int N>
+void DynamicArray<T, N>::erase_range(const Iterator<T> it1,
                                   const Iterator<T> it2) {
-  if (it1 > it2)
+  int from = this->position(it1, true), to = this->position(it2, true);
+  if (from > to)
     throw std::invalid_argument("1st range must be less than 2nd!");
 
-  for (Iterator<T> it = it2 + 1; it != end() + 1; ++it)
-    *(it - (it2.get_index() - it1.get_index() + 1)) = *it;
+  this->detach();
+  int count = to - from;
+  for (int i = to; i < this->size; i++)
+    this->array[i - count] = this->array[i];
 
-  this->size -= (it2.get_index() - it1.get_index() + 1);
+  this->size -= count;
 }
 
 // Erase all occurrences of an element
-template <typename T> void DynamicArray<T>::erase_all(const T &element) {
+template <typename T, int N>
+void DynamicArray<T, N>::erase_all(const T &element) {
   std::vector<Iterator<T>> items = this->find_all(element);
   for (auto it = items.rbegin(); it != items.rend(); ++it)
     this->erase(*it);
 }
 
 // Erase element by predicate
-template <typename T>
-void DynamicArray<T>::erase_if(std::function<bool(T)> fn) {
+template <typename T, int N>
+void DynamicArray<T, N>::erase_if(std::function<bool(T)> fn) {
   std::vector<Iterator<T>> items = this->find_if(fn);
   for (auto it = items.rbegin(); it != items.rend(); ++it)
     this->erase(*it);
 }
 
 // Find element in the stack
-template <typename T>
-Iterator<T> DynamicArray<T>::find(const T &element) const {
+template <typename T, int N>
+Iterator<const T> DynamicArray<T, N>::find(const T &element) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  for (Iterator<T> it = begin(); it != end(); ++it) {
+  for (Iterator<const T> it = begin(); it != end(); ++it) {
     if (*it == element)
-      return Iterator<T>(it, true);
+      return it;
   }
 
   return end();
 }
 
 // Find all elements in the stack
-template <typename T>
-std::vector<Iterator<T>> DynamicArray<T>::find_all(const T &element) const {
+template <typename T, int N>
+std::vector<Iterator<const T>>
+DynamicArray<T, N>::find_all(const T &element) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  std::vector<Iterator<T>> iterators;
-  for (Iterator<T> it = begin(); it != end() + 1; ++it) {
+  std::vector<Iterator<const T>> iterators;
+  for (Iterator<const T> it = begin(); it != end(); ++it) {
     if (*it == element)
       iterators.push_back(it);
   }
@@ -510,14 +753,14 @@ std::vector<Iterator<T>> DynamicArray<T>::find_all(const T &element) const {
 }
 
 // Find all elements that satisfy the condition/predicate
-template <typename T>
-std::vector<Iterator<T>>
-DynamicArray<T>::find_if(std::function<bool(T)> fn) const {
+template <typename T, int N>
+std::vector<Iterator<const T>>
+DynamicArray<T, N>::find_if(std::function<bool(T)> fn) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  std::vector<Iterator<T>> iterators;
-  for (Iterator<T> it = begin(); it != end() + 1; ++it) {
+  std::vector<Iterator<const T>> iterators;
+  for (Iterator<const T> it = begin(); it != end(); ++it) {
     if (fn(*it))
       iterators.push_back(it);
   }
@@ -525,9 +768,120 @@ DynamicArray<T>::find_if(std::function<bool(T)> fn) const {
   return iterators;
 }
 
+// Find element (detaches first, the iterator may be written through)
+template <typename T, int N>
+Iterator<T> DynamicArray<T, N>::find(const T &element) {
+  this->detach();
+  return this->to_mutable(std::as_const(*this).find(element));
+}
+
+// Find all elements (detaches first, the iterators may be written through)
+template <typename T, int N>
+std::vector<Iterator<T>> DynamicArray<T, N>::find_all(const T &element) {
+  this->detach();
+  std::vector<Iterator<T>> iterators;
+  for (const Iterator<const T> &it : std::as_const(*this).find_all(element))
+    iterators.push_back(this->to_mutable(it));
+
+  return iterators;
+}
+
+// Find all elements that satisfy the condition (detaches first, the
+// iterators may be written through)
+template <typename T, int N>
+std::vector<Iterator<T>>
+DynamicArray<T, N>::find_if(std::function<bool(T)> fn) {
+  this->detach();
+  std::vector<Iterator<T>> iterators;
+  for (const Iterator<const T> &it : std::as_const(*this).find_if(fn))
+    iterators.push_back(this->to_mutable(it));
+
+  return iterators;
+}
+
+//----------
+// Compact find
+// ----------
+
+// Indexes of all occurrences
+template <typename T, int N>
+std::vector<int> DynamicArray<T, N>::find_all_indices(const T &element) const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  std::vector<int> indices;
+  for (int i = 0; i < this->size; i++) {
+    if (this->array[i] == element)
+      indices.push_back(i);
+  }
+
+  return indices;
+}
+
+// Indexes of all elements that satisfy the predicate
+template <typename T, int N>
+template <class Fn>
+std::vector<int> DynamicArray<T, N>::find_if_indices(Fn fn) const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  std::vector<int> indices;
+  for (int i = 0; i < this->size; i++) {
+    if (fn(this->array[i]))
+      indices.push_back(i);
+  }
+
+  return indices;
+}
+
+// Bitmap of all occurrences
+template <typename T, int N>
+MatchMask DynamicArray<T, N>::match_mask(const T &element) const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  return MatchMask::equal(this->array, this->size, element);
+}
+
+// Bitmap of all elements that satisfy the predicate
+template <typename T, int N>
+template <class Fn>
+MatchMask DynamicArray<T, N>::match_mask_if(Fn fn) const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  return MatchMask::build(this->array, this->size, fn);
+}
+
+// Visit (index, value) of every occurrence
+template <typename T, int N>
+template <class Fn>
+void DynamicArray<T, N>::for_each_match(const T &element, Fn fn) const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  for (int i = 0; i < this->size; i++) {
+    if (this->array[i] == element)
+      fn(i, this->array[i]);
+  }
+}
+
+// Visit (index, value) of every element that satisfies the predicate
+template <typename T, int N>
+template <class Fn, class Visit>
+void DynamicArray<T, N>::for_each_match_if(Fn fn, Visit visit) const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  for (int i = 0; i < this->size; i++) {
+    if (fn(this->array[i]))
+      visit(i, this->array[i]);
+  }
+}
+
 // Replace given element
-template <typename T>
-void DynamicArray<T>::replace(const T &element, const T &replace) {
+template <typename T, int N>
+void DynamicArray<T, N>::replace(const T &element, const T &replace) {
   Iterator<T> el = this->find(element);
   if (el == end())
     throw std::invalid_argument("Element was not found!");
@@ -536,17 +890,19 @@ void DynamicArray<T>::replace(const T &element, const T &replace) {
 }
 
 // Replace at given iterator
-template <typename T>
-void DynamicArray<T>::replace(const Iterator<T> it, const T &replace) {
+template <typename T, int N>
+void DynamicArray<T, N>::replace(const Iterator<T> it, const T &replace) {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  *it = replace;
+  int index = this->position(it, false);
+  this->detach();
+  this->array[index] = replace;
 }
 
 // Replace all occurrences of element
-template <typename T>
-void DynamicArray<T>::replace_all(const T &element, const T &replace) {
+template <typename T, int N>
+void DynamicArray<T, N>::replace_all(const T &element, const T &replace) {
   std::vector<Iterator<T>> items = this->find_all(element);
   if (items.size() == 0)
     throw std::invalid_argument("Elements were not found!");
@@ -556,30 +912,30 @@ void DynamicArray<T>::replace_all(const T &element, const T &replace) {
 }
 
 // Replace all occurrences of element that satisfy the condition
-template <typename T>
-void DynamicArray<T>::replace_if(std::function<bool(T)> fn, const T &replace) {
+template <typename T, int N>
+void DynamicArray<T, N>::replace_if(std::function<bool(T)> fn,
+                                    const T &replace) {
   std::vector<Iterator<T>> items = this->find_if(fn);
   for (Iterator<T> it : items)
     *it = replace;
 }
 
-// Replace all elements in a range
-template <typename T>
-void DynamicArray<T>::replace_range(const Iterator<T> it1,
+// Replace all elements in the range [it1, it2)
+template <typename T, int N>
+void DynamicArray<T, N>::replace_range(const Iterator<T> it1,
                                     const Iterator<T> it2, const T &replace) {
-  if (it1 > it2)
+  int from = this->position(it1, true), to = this->position(it2, true);
+  if (from > to)
     throw std::invalid_argument("1st range must be less than 2nd!");
 
-  for (Iterator<T> it = it1; it != it2; ++it)
-    *it = replace;
-
-  *it2 = replace;
+  this->detach();
+  std::fill(this->array + from, this->array + to, replace);
 }
 
 // Swapping two dynamic arrays
-template <typename T>
-void DynamicArray<T>::swap(DynamicArray<T> &a, DynamicArray<T> &b) {
-  DynamicArray<T> temp = a;
+template <typename T, int N>
+void DynamicArray<T, N>::swap(DynamicArray<T, N> &a, DynamicArray<T, N> &b) {
+  DynamicArray<T, N> temp = a;
   a = b;
   b = temp;
 }
@@ -589,12 +945,13 @@ void DynamicArray<T>::swap(DynamicArray<T> &a, DynamicArray<T> &b) {
 // ----------
 
 // To string
-template <typename T> const std::string DynamicArray<T>::to_string() const {
+template <typename T, int N>
+const std::string DynamicArray<T, N>::to_string() const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
   std::stringstream ss;
-  for (Iterator<T> it = begin(); it != end() + 1; ++it) {
+  for (Iterator<const T> it = begin(); it != end(); ++it) {
     if (it != begin())
       ss << ", ";
 
@@ -606,7 +963,8 @@ template <typename T> const std::string DynamicArray<T>::to_string() const {
 }
 
 // Count element
-template <typename T> int DynamicArray<T>::count(const T &element) const {
+template <typename T, int N>
+int DynamicArray<T, N>::count(const T &element) const {
   int count = 0;
   for (int i = 0; i < this->size; i++) {
     if (this->array[i] == element)
@@ -617,8 +975,8 @@ template <typename T> int DynamicArray<T>::count(const T &element) const {
 }
 
 // Count element by predicate
-template <typename T>
-int DynamicArray<T>::count_if(std::function<bool(T)> fn) const {
+template <typename T, int N>
+int DynamicArray<T, N>::count_if(std::function<bool(T)> fn) const {
   int count = 0;
   for (int i = 0; i < this->size; i++) {
     if (fn(this->array[i]))
@@ -629,12 +987,12 @@ int DynamicArray<T>::count_if(std::function<bool(T)> fn) const {
 }
 
 // Filter elemets in the array
-template <typename T>
-DynamicArray<T> DynamicArray<T>::filter(std::function<bool(T)> fn) const {
+template <typename T, int N>
+DynamicArray<T, N> DynamicArray<T, N>::filter(std::function<bool(T)> fn) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  DynamicArray<T> result(this->capacity);
+  DynamicArray<T, N> result(this->capacity);
   for (int i = 0; i < this->size; i++) {
     if (fn(this->array[i]))
       result.push_back(this->array[i]);
@@ -647,8 +1005,8 @@ DynamicArray<T> DynamicArray<T>::filter(std::function<bool(T)> fn) const {
 }
 
 // Map array elements
-template <typename T>
-void DynamicArray<T>::map(std::function<void(T)> fn) const {
+template <typename T, int N>
+void DynamicArray<T, N>::map(std::function<void(T)> fn) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -657,12 +1015,12 @@ void DynamicArray<T>::map(std::function<void(T)> fn) const {
 }
 
 // Apply function to array
-template <typename T>
-DynamicArray<T> DynamicArray<T>::apply(std::function<T(T)> fn) const {
+template <typename T, int N>
+DynamicArray<T, N> DynamicArray<T, N>::apply(std::function<T(T)> fn) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  DynamicArray<T> result(this->capacity);
+  DynamicArray<T, N> result(this->capacity);
   for (int i = 0; i < this->size; i++) {
     T value = fn(this->array[i]);
     result.push_back(value);
@@ -672,8 +1030,8 @@ DynamicArray<T> DynamicArray<T>::apply(std::function<T(T)> fn) const {
 }
 
 // Reduce
-template <typename T>
-T DynamicArray<T>::reduce(T init, std::function<T(T, T)> fn) const {
+template <typename T, int N>
+T DynamicArray<T, N>::reduce(T init, std::function<T(T, T)> fn) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -684,10 +1042,11 @@ T DynamicArray<T>::reduce(T init, std::function<T(T, T)> fn) const {
 }
 
 // Reverse array (modify the existing)
-template <typename T> void DynamicArray<T>::reverse() {
+template <typename T, int N> void DynamicArray<T, N>::reverse() {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
+  this->detach();
   int i = 0, j = this->size - 1;
   while (i < j) {
     std::swap(this->array[i], this->array[j]);
@@ -697,42 +1056,40 @@ template <typename T> void DynamicArray<T>::reverse() {
 }
 
 // Reverse array (creating new array)
-template <typename T> DynamicArray<T> DynamicArray<T>::reversed() const {
+template <typename T, int N>
+DynamicArray<T, N> DynamicArray<T, N>::reversed() const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  DynamicArray<T> result(this->capacity);
+  DynamicArray<T, N> result(this->capacity);
   for (int i = 0; i < this->size; i++)
     result.push_begin(this->array[i]);
 
   return result;
 }
 
-// Reverse partial (modify the existing)
-template <typename T>
-void DynamicArray<T>::reverse_partial(const Iterator<T> it1,
+// Reverse the range [it1, it2) (modify the existing)
+template <typename T, int N>
+void DynamicArray<T, N>::reverse_partial(const Iterator<T> it1,
                                       const Iterator<T> it2) {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  if (it1 >= it2)
+  int from = this->position(it1, true), to = this->position(it2, true);
+  if (from > to)
     throw std::invalid_argument("1st iterator must be less than 2nd iterator!");
 
-  Iterator<T> begin = it1, end = it2;
-  while (begin < end) {
-    std::swap(*begin, *end);
-    ++begin;
-    --end;
-  }
+  this->detach();
+  std::reverse(this->array + from, this->array + to);
 }
 
 // Remove duplicates from array
-template <typename T>
-DynamicArray<T> DynamicArray<T>::remove_duplicates() const {
+template <typename T, int N>
+DynamicArray<T, N> DynamicArray<T, N>::remove_duplicates() const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
-  DynamicArray<T> result(this->capacity);
+  DynamicArray<T, N> result(this->capacity);
   std::unordered_set<T> seen;
   for (int i = 0; i < this->size; i++) {
     if (seen.find(this->array[i]) == seen.end()) {
@@ -745,7 +1102,8 @@ DynamicArray<T> DynamicArray<T>::remove_duplicates() const {
 }
 
 // Get frequency map of dynamic array
-template <typename T> std::map<T, int> DynamicArray<T>::frequency_map() const {
+template <typename T, int N>
+std::map<T, int> DynamicArray<T, N>::frequency_map() const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -761,7 +1119,7 @@ template <typename T> std::map<T, int> DynamicArray<T>::frequency_map() const {
 // ----------
 
 // Find max element
-template <typename T> T DynamicArray<T>::max() const {
+template <typename T, int N> T DynamicArray<T, N>::max() const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -775,7 +1133,8 @@ template <typename T> T DynamicArray<T>::max() const {
 }
 
 // Find max by key
-template <typename T> T DynamicArray<T>::max(std::function<int(T)> fn) const {
+template <typename T, int N>
+T DynamicArray<T, N>::max(std::function<int(T)> fn) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -789,8 +1148,8 @@ template <typename T> T DynamicArray<T>::max(std::function<int(T)> fn) const {
 }
 
 // Find max by predicate
-template <typename T>
-T DynamicArray<T>::max_if(std::function<bool(T)> fn) const {
+template <typename T, int N>
+T DynamicArray<T, N>::max_if(std::function<bool(T)> fn) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -813,7 +1172,7 @@ T DynamicArray<T>::max_if(std::function<bool(T)> fn) const {
 }
 
 // Find min element
-template <typename T> T DynamicArray<T>::min() const {
+template <typename T, int N> T DynamicArray<T, N>::min() const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -827,7 +1186,8 @@ template <typename T> T DynamicArray<T>::min() const {
 }
 
 // Find min element by key
-template <typename T> T DynamicArray<T>::min(std::function<int(T)> fn) const {
+template <typename T, int N>
+T DynamicArray<T, N>::min(std::function<int(T)> fn) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -841,8 +1201,8 @@ template <typename T> T DynamicArray<T>::min(std::function<int(T)> fn) const {
 }
 
 // Find min element by predicate
-template <typename T>
-T DynamicArray<T>::min_if(std::function<bool(T)> fn) const {
+template <typename T, int N>
+T DynamicArray<T, N>::min_if(std::function<bool(T)> fn) const {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
@@ -869,11 +1229,12 @@ T DynamicArray<T>::min_if(std::function<bool(T)> fn) const {
 // ----------
 
 // Bubble sort
-template <typename T>
-void DynamicArray<T>::bubble_sort(std::function<bool(T, T)> comp) {
+template <typename T, int N>
+void DynamicArray<T, N>::bubble_sort(std::function<bool(T, T)> comp) {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
+  this->detach();
   for (int i = 0; i < this->size - 1; i++) {
     for (int j = 0; j < this->size - i - 1; j++) {
       if (comp(this->array[j + 1], this->array[j]))
@@ -883,11 +1244,12 @@ void DynamicArray<T>::bubble_sort(std::function<bool(T, T)> comp) {
 }
 
 // Selection sort
-template <typename T>
-void DynamicArray<T>::selection_sort(std::function<bool(T, T)> comp) {
+template <typename T, int N>
+void DynamicArray<T, N>::selection_sort(std::function<bool(T, T)> comp) {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
+  this->detach();
   for (int i = 0; i < this->size - 1; i++) {
     int min_index = i;
     for (int j = i + 1; j < this->size; j++) {
@@ -900,17 +1262,18 @@ void DynamicArray<T>::selection_sort(std::function<bool(T, T)> comp) {
 }
 
 // Merge sort
-template <typename T>
-void DynamicArray<T>::merge_sort(std::function<bool(T, T)> comp) {
+template <typename T, int N>
+void DynamicArray<T, N>::merge_sort(std::function<bool(T, T)> comp) {
   if (this->is_empty())
     throw std::length_error("Array is empty, try to add elements!");
 
+  this->detach();
   merge_sort_helper(0, this->size - 1, comp);
 }
 
 // Merge sort helper function
-template <typename T>
-void DynamicArray<T>::merge_sort_helper(int left, int right,
+template <typename T, int N>
+void DynamicArray<T, N>::merge_sort_helper(int left, int right,
                                         std::function<bool(T, T)> comp) {
   if (left < right) {
     int mid = left + (right - left) / 2;
@@ -920,8 +1283,8 @@ void DynamicArray<T>::merge_sort_helper(int left, int right,
   }
 }
 
-template <typename T>
-void DynamicArray<T>::merge(int left, int mid, int right,
+template <typename T, int N>
+void DynamicArray<T, N>::merge(int left, int mid, int right,
                             std::function<bool(T, T)> comp) {
   int n1 = mid - left + 1;
   int n2 = right - mid;
@@ -967,12 +1330,13 @@ void DynamicArray<T>::merge(int left, int mid, int right,
 // ----------
 
 // Union of two arrays
-template <typename T>
-DynamicArray<T> DynamicArray<T>::operator|(const DynamicArray<T> &other) const {
+template <typename T, int N>
+DynamicArray<T, N>
+DynamicArray<T, N>::operator|(const DynamicArray<T, N> &other) const {
   if (this->is_empty() || other.is_empty())
     throw std::length_error("One of arrays is empty!");
 
-  DynamicArray<T> result(this->capacity + other.get_capacity());
+  DynamicArray<T, N> result(this->capacity + other.get_capacity());
   std::unordered_set<T> seen;
 
   for (int i = 0; i < this->size; i++) {
@@ -993,12 +1357,13 @@ DynamicArray<T> DynamicArray<T>::operator|(const DynamicArray<T> &other) const {
 }
 
 // Intersection of two arrays
-template <typename T>
-DynamicArray<T> DynamicArray<T>::operator&(const DynamicArray<T> &other) const {
+template <typename T, int N>
+DynamicArray<T, N>
+DynamicArray<T, N>::operator&(const DynamicArray<T, N> &other) const {
   if (this->is_empty() || other.is_empty())
     throw std::length_error("One of arrays is empty!");
 
-  DynamicArray<T> result(this->size);
+  DynamicArray<T, N> result(this->size);
   std::unordered_set<T> seen;
   std::unordered_set<T> result_set;
 
@@ -1017,12 +1382,13 @@ DynamicArray<T> DynamicArray<T>::operator&(const DynamicArray<T> &other) const {
 }
 
 // Merge two arrays
-template <typename T>
-DynamicArray<T> DynamicArray<T>::operator+(const DynamicArray<T> &other) const {
+template <typename T, int N>
+DynamicArray<T, N>
+DynamicArray<T, N>::operator+(const DynamicArray<T, N> &other) const {
   if (this->is_empty() || other.is_empty())
     throw std::length_error("One of arrays is empty!");
 
-  DynamicArray<T> result(*this);
+  DynamicArray<T, N> result(*this);
   result.resize(result.get_size() + other.get_size());
 
   for (int i = 0; i < other.get_size(); i++)
@@ -1036,20 +1402,21 @@ DynamicArray<T> DynamicArray<T>::operator+(const DynamicArray<T> &other) const {
 // ----------
 
 // Getting the first element that appears once in the array
-template <typename T> Iterator<T> DynamicArray<T>::distinct() const {
+template <typename T, int N>
+Iterator<const T> DynamicArray<T, N>::distinct() const {
   std::map<T, int> fm = this->frequency_map();
-  for (Iterator<T> it = this->begin(); it != this->end(); ++it) {
+  for (Iterator<const T> it = this->begin(); it != this->end(); ++it) {
     if (fm[*it] == 1)
-      return Iterator<T>(it, true);
+      return it;
   }
 
   return end();
 }
 
 // All distinct elements
-template <typename T>
-std::vector<Iterator<T>> DynamicArray<T>::distinct_all() const {
-  std::vector<Iterator<T>> distincts;
+template <typename T, int N>
+std::vector<Iterator<const T>> DynamicArray<T, N>::distinct_all() const {
+  std::vector<Iterator<const T>> distincts;
   std::map<T, int> fm = this->frequency_map();
   for (Iterator it = this->begin(); it != this->end(); ++it) {
     if (fm[*it] == 1)
@@ -1060,24 +1427,24 @@ std::vector<Iterator<T>> DynamicArray<T>::distinct_all() const {
 }
 
 // Kth distinct element in the array
-template <typename T>
-Iterator<T> DynamicArray<T>::kth_distinct(const int &k) const {
+template <typename T, int N>
+Iterator<const T> DynamicArray<T, N>::kth_distinct(const int &k) const {
   int kth = k;
   std::map<T, int> fm = this->frequency_map();
-  for (Iterator<T> it = this->begin(); it != this->end(); ++it) {
+  for (Iterator<const T> it = this->begin(); it != this->end(); ++it) {
     if (fm[*it] == 1)
       --kth;
 
     if (kth == 0)
-      return Iterator<T>(it, true);
+      return it;
   }
 
   return end();
 }
 
 // Top k frequent elements from the array
-template <typename T>
-std::vector<T> DynamicArray<T>::top_k_frequent(const int &k) const {
+template <typename T, int N>
+std::vector<T> DynamicArray<T, N>::top_k_frequent(const int &k) const {
   std::map<T, int> fm = this->frequency_map();
 
   auto comp = [](std::pair<T, int> &a, std::pair<T, int> &b) {
@@ -1102,4 +1469,8 @@ std::vector<T> DynamicArray<T>::top_k_frequent(const int &k) const {
   return result;
 }
 
+// Small dynamic array (no heap allocation while it holds up to N elements)
+
+template <class T, int N = 16> using SmallDynamicArray = DynamicArray<T, N>;
+
 #endif
@@ -0,0 +1,11 @@
+/*
+
+An indexed priority queue is a d-ary heap of ids from [0, capacity), each
+with its own key. A second array remembers where every id sits in the heap,
+so the key of any id can be changed (decrease-key/increase-key) or the id can
+be erased in O(log n). That is what Dijkstra's and Prim's algorithms need to
+update the distance of a vertex that is already queued.
+
+*/
+
+int main() { return 0; }
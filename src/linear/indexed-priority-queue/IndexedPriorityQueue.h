@@ -0,0 +1,327 @@
+#ifndef INDEXEDPRIORITYQUEUE_H
+#define INDEXEDPRIORITYQUEUE_H
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Indexed priority queue (d-ary heap of ids from [0, capacity) with a key
+// each; the top is the greatest key by Compare, pass std::greater<T> for a
+// min-heap as in Dijkstra)
+
+template <class T, class Compare = std::less<T>, int Arity = 2>
+class IndexedPriorityQueue {
+  static_assert(Arity >= 2, "Arity should be >= 2!");
+
+private:
+  int *heap;     // heap position -> id
+  int *position; // id -> heap position (-1 if not queued)
+  T *keys;       // id -> key
+  int size;
+  int capacity;
+  Compare comp;
+
+  // heap helper functions
+  void sift_up(int index);
+  void sift_down(int index);
+  void check_id(const int &id) const;
+  void check_queued(const int &id) const;
+
+  // memory helper functions
+  void allocate(const int &capacity);
+  void release();
+  void copy_from(const IndexedPriorityQueue<T, Compare, Arity> &other);
+
+public:
+  // constructors
+  inline explicit IndexedPriorityQueue<T, Compare, Arity>(
+      const int capacity, const Compare &comp = Compare())
+      : size(0), capacity(capacity), comp(comp) {
+    if (capacity < 0)
+      throw std::invalid_argument("Capacity should not be < 0!");
+
+    this->allocate(capacity);
+  };
+  IndexedPriorityQueue<T, Compare, Arity>(
+      const IndexedPriorityQueue<T, Compare, Arity> &other);
+
+  // destructor
+  inline ~IndexedPriorityQueue<T, Compare, Arity>() { this->release(); };
+
+  // equal operator
+  IndexedPriorityQueue<T, Compare, Arity> &
+  operator=(const IndexedPriorityQueue<T, Compare, Arity> &other);
+
+  // getters
+  inline int get_size() const { return this->size; }
+  inline int get_capacity() const { return this->capacity; }
+  static constexpr int get_arity() { return Arity; }
+
+  // bool methods
+  inline bool is_empty() const { return this->size == 0; }
+  inline bool contains(const int &id) const {
+    return id >= 0 && id < this->capacity && this->position[id] != -1;
+  }
+
+  // adding to the queue
+  void push(const int &id, const T &key);
+
+  // changing keys (decrease-key and increase-key)
+  void update(const int &id, const T &key);
+  void push_or_update(const int &id, const T &key);
+
+  // removing from the queue
+  int pop();
+  void erase(const int &id);
+  void clear();
+
+  // get element methods
+  int top_id() const;
+  T top_key() const;
+  T key_of(const int &id) const;
+};
+
+//----------
+// Constructors
+// ----------
+
+// Copy constructor (deep copy)
+template <typename T, typename Compare, int Arity>
+IndexedPriorityQueue<T, Compare, Arity>::IndexedPriorityQueue(
+    const IndexedPriorityQueue<T, Compare, Arity> &other)
+    : size(other.size), capacity(other.capacity), comp(other.comp) {
+  this->allocate(other.capacity);
+  this->copy_from(other);
+}
+
+// Equal operator
+template <typename T, typename Compare, int Arity>
+IndexedPriorityQueue<T, Compare, Arity> &
+IndexedPriorityQueue<T, Compare, Arity>::operator=(
+    const IndexedPriorityQueue<T, Compare, Arity> &other) {
+  if (this == &other)
+    return *this;
+
+  this->release();
+  this->size = other.size;
+  this->capacity = other.capacity;
+  this->comp = other.comp;
+  this->allocate(other.capacity);
+  this->copy_from(other);
+
+  return *this;
+}
+
+// ---------
+// Memory helpers
+// ---------
+
+// Allocate arrays, nothing is queued
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::allocate(const int &capacity) {
+  this->heap = new int[capacity];
+  this->position = new int[capacity];
+  this->keys = new T[capacity];
+  std::fill(this->position, this->position + capacity, -1);
+}
+
+// Free arrays
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::release() {
+  delete[] this->heap;
+  delete[] this->position;
+  delete[] this->keys;
+  this->heap = this->position = nullptr;
+  this->keys = nullptr;
+}
+
+// Copy arrays of the same capacity
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::copy_from(
+    const IndexedPriorityQueue<T, Compare, Arity> &other) {
+  std::copy(other.heap, other.heap + other.size, this->heap);
+  std::copy(other.position, other.position + other.capacity, this->position);
+  std::copy(other.keys, other.keys + other.capacity, this->keys);
+}
+
+// ---------
+// Heap helpers
+// ---------
+
+// Move the id up while its key beats the parent's key
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::sift_up(int index) {
+  int id = this->heap[index];
+
+  while (index > 0) {
+    int parent = (index - 1) / Arity;
+    if (!this->comp(this->keys[this->heap[parent]], this->keys[id]))
+      break;
+
+    this->heap[index] = this->heap[parent];
+    this->position[this->heap[index]] = index;
+    index = parent;
+  }
+
+  this->heap[index] = id;
+  this->position[id] = index;
+}
+
+// Move the id down while one of its children has a better key
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::sift_down(int index) {
+  int id = this->heap[index];
+
+  while (true) {
+    int first = index * Arity + 1;
+    if (first >= this->size)
+      break;
+
+    int last = std::min(first + Arity, this->size);
+    int best = first;
+    for (int child = first + 1; child < last; child++) {
+      if (this->comp(this->keys[this->heap[best]],
+                     this->keys[this->heap[child]]))
+        best = child;
+    }
+
+    if (!this->comp(this->keys[id], this->keys[this->heap[best]]))
+      break;
+
+    this->heap[index] = this->heap[best];
+    this->position[this->heap[index]] = index;
+    index = best;
+  }
+
+  this->heap[index] = id;
+  this->position[id] = index;
+}
+
+// Id should be in [0, capacity)
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::check_id(const int &id) const {
+  if (id < 0 || id >= this->capacity)
+    throw std::out_of_range("Provided id is out of range!");
+}
+
+// Id should be in the queue
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::check_queued(
+    const int &id) const {
+  this->check_id(id);
+  if (this->position[id] == -1)
+    throw std::invalid_argument("Id is not in the queue!");
+}
+
+// ---------
+// Methods
+// ---------
+
+// Push a new id with its key
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::push(const int &id,
+                                                   const T &key) {
+  this->check_id(id);
+  if (this->position[id] != -1)
+    throw std::invalid_argument("Id is already in the queue!");
+
+  this->keys[id] = key;
+  this->heap[this->size] = id;
+  this->position[id] = this->size;
+  this->sift_up(this->size++);
+}
+
+// Change the key of a queued id (sifts whichever way the key moved)
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::update(const int &id,
+                                                     const T &key) {
+  this->check_queued(id);
+
+  bool raised = this->comp(this->keys[id], key);
+  this->keys[id] = key;
+
+  if (raised)
+    this->sift_up(this->position[id]);
+  else
+    this->sift_down(this->position[id]);
+}
+
+// Push the id or change its key if it is already queued
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::push_or_update(const int &id,
+                                                             const T &key) {
+  if (this->contains(id))
+    this->update(id, key);
+  else
+    this->push(id, key);
+}
+
+// Pop the id with the top key
+template <typename T, typename Compare, int Arity>
+int IndexedPriorityQueue<T, Compare, Arity>::pop() {
+  if (this->is_empty())
+    throw std::length_error("Priority queue is empty!");
+
+  int id = this->heap[0];
+  this->erase(id);
+
+  return id;
+}
+
+// Erase a queued id
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::erase(const int &id) {
+  this->check_queued(id);
+
+  int index = this->position[id];
+  int last = this->heap[--this->size];
+  this->position[id] = -1;
+
+  if (index == this->size)
+    return;
+
+  // the last id fills the hole and may need to go either way
+  this->heap[index] = last;
+  this->position[last] = index;
+  this->sift_up(index);
+  this->sift_down(this->position[last]);
+}
+
+// Clear the queue (only queued ids are reset)
+template <typename T, typename Compare, int Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::clear() {
+  for (int i = 0; i < this->size; i++)
+    this->position[this->heap[i]] = -1;
+
+  this->size = 0;
+}
+
+// Get the id with the top key
+template <typename T, typename Compare, int Arity>
+int IndexedPriorityQueue<T, Compare, Arity>::top_id() const {
+  if (this->is_empty())
+    throw std::length_error("Priority queue is empty!");
+
+  return this->heap[0];
+}
+
+// Get the top key
+template <typename T, typename Compare, int Arity>
+T IndexedPriorityQueue<T, Compare, Arity>::top_key() const {
+  if (this->is_empty())
+    throw std::length_error("Priority queue is empty!");
+
+  return this->keys[this->heap[0]];
+}
+
+// Get the key of a queued id
+template <typename T, typename Compare, int Arity>
+T IndexedPriorityQueue<T, Compare, Arity>::key_of(const int &id) const {
+  this->check_queued(id);
+  return this->keys[id];
+}
+
+#endif
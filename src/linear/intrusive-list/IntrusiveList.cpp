@@ -0,0 +1,26 @@
+/*
+
+An intrusive list does not own its elements and has no nodes of its own:
+the links live in a hook that is a member of the element, and the list only
+keeps the head. Elements are allocated by the caller (in an arena, on the
+stack, inside another structure) and linking or unlinking one is a couple of
+pointer writes. An element with several hooks can be on several lists at
+the same time, e.g. a task on a per-worker list and on a global LRU list.
+
+The prev of the head points to the tail, so the tail is reached in O(1)
+without a tail member and a hook alone tells whether its element is linked
+(prev is null only for an unlinked element).
+
+Pros:
+    No allocation and no copy of the element when linking
+    Removal of an element in O(1) without any lookup
+    One element can be on several lists at once
+
+Cons:
+    The element type has to declare a hook for every list it can be on
+    Elements must outlive the list and must not move while linked
+    The list cannot be copied
+
+*/
+
+int main() { return 0; }
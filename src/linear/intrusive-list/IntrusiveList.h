@@ -0,0 +1,473 @@
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+// Node handle checking policy (same as LinkedList): in debug builds
+// push_after/push_before/remove_node walk the list (O(n)) to verify that the
+// node belongs to it, with NDEBUG they only check that it is linked (O(1)).
+// Define CHECKED_NODE_HANDLES=0/1 before including to override it.
+#ifndef CHECKED_NODE_HANDLES
+#ifdef NDEBUG
+#define CHECKED_NODE_HANDLES 0
+#else
+#define CHECKED_NODE_HANDLES 1
+#endif
+#endif
+
+// Intrusive list hook, a member of the element (one hook per list the
+// element can be on at the same time). The prev of the head points to the
+// tail, so every linked element has a non-null prev and a hook knows by
+// itself whether it is linked.
+
+template <class T> class IntrusiveListHook {
+public:
+  T *next;
+  T *prev;
+  IntrusiveListHook() : next(nullptr), prev(nullptr){};
+
+  // a hook belongs to its element, copying the element must not copy links
+  IntrusiveListHook(const IntrusiveListHook<T> &)
+      : next(nullptr), prev(nullptr){};
+  IntrusiveListHook<T> &operator=(const IntrusiveListHook<T> &) {
+    return *this;
+  }
+
+  inline bool is_linked() const { return this->prev != nullptr; }
+};
+
+template <class T, IntrusiveListHook<T> T::*Hook> class IntrusiveList;
+
+// Intrusive List Iterator (bidirectional, end() holds nullptr and the list,
+// so --end() is the tail)
+
+template <class T, IntrusiveListHook<T> T::*Hook> class IntrusiveListIterator {
+private:
+  T *node;
+  const IntrusiveList<T, Hook> *list;
+
+public:
+  // iterator traits
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  // constructors
+  inline IntrusiveListIterator<T, Hook>() : node(nullptr), list(nullptr){};
+  inline IntrusiveListIterator<T, Hook>(
+      T *node, const IntrusiveList<T, Hook> *list = nullptr)
+      : node(node), list(list){};
+
+  // getters
+  inline T *get_node() const { return this->node; }
+
+  // increment operators
+  inline IntrusiveListIterator<T, Hook> &operator++() {
+    if (this->node != nullptr)
+      this->node = (this->node->*Hook).next;
+
+    return *this;
+  }
+
+  inline IntrusiveListIterator<T, Hook> operator++(int) {
+    IntrusiveListIterator<T, Hook> temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  // decrement operators (stops at the head)
+  inline IntrusiveListIterator<T, Hook> &operator--() {
+    if (this->node == nullptr) {
+      if (this->list != nullptr)
+        this->node = this->list->get_tail();
+    } else if (this->list == nullptr || this->node != this->list->get_head()) {
+      this->node = (this->node->*Hook).prev;
+    }
+
+    return *this;
+  }
+
+  inline IntrusiveListIterator<T, Hook> operator--(int) {
+    IntrusiveListIterator<T, Hook> temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  // get operators
+  inline T &operator*() const {
+    if (this->node == nullptr)
+      throw std::out_of_range("Iterator is out of range");
+
+    return *this->node;
+  }
+
+  inline T *operator->() const {
+    if (this->node == nullptr)
+      throw std::out_of_range("Iterator is out of range");
+
+    return this->node;
+  }
+
+  // compare operators
+  inline bool operator==(const IntrusiveListIterator<T, Hook> &other) const {
+    return this->node == other.node;
+  }
+
+  inline bool operator!=(const IntrusiveListIterator<T, Hook> &other) const {
+    return this->node != other.node;
+  }
+};
+
+// Intrusive doubly linked list: links elements owned by someone else through
+// their Hook member, never allocates and never copies an element
+
+template <class T, IntrusiveListHook<T> T::*Hook> class IntrusiveList {
+private:
+  T *head;
+  int length;
+
+  // link helper functions
+  static inline IntrusiveListHook<T> &hook(T *node) { return node->*Hook; }
+  void link(T *before, T *node);
+  void unlink(T *node);
+  void check_free(const T &element) const;
+  void check_linked(const T &element) const;
+
+public:
+  static constexpr bool checks_handles = CHECKED_NODE_HANDLES;
+
+  // constructors
+  inline explicit IntrusiveList<T, Hook>() : head(nullptr), length(0){};
+
+  // elements point at each other through their hooks, so a list cannot be
+  // copied (moving the hooks of every element is what swap is for)
+  IntrusiveList<T, Hook>(const IntrusiveList<T, Hook> &) = delete;
+  IntrusiveList<T, Hook> &operator=(const IntrusiveList<T, Hook> &) = delete;
+
+  // destructor (unlinks the elements, they stay alive)
+  inline ~IntrusiveList<T, Hook>() { this->clear(); }
+
+  // getters
+  inline T *get_head() const { return this->head; }
+  inline T *get_tail() const {
+    return this->head != nullptr ? (this->head->*Hook).prev : nullptr;
+  }
+  inline int get_length() const { return this->length; }
+  T *get_node_by_index(const int index) const;
+
+  // bool methods
+  inline bool is_empty() const { return this->head == nullptr; }
+  static inline bool is_linked(const T &element) {
+    return (element.*Hook).is_linked();
+  }
+  bool contains(const T &element) const;
+
+  // adding to the list (the element must not be linked by this hook yet)
+  void push_end(T &element);
+  void push_begin(T &element);
+  void push_after(T &node, T &element);
+  void push_before(T &node, T &element);
+  void push_index(const int index, T &element);
+
+  // removing from the list (returns the unlinked element)
+  T &remove_begin();
+  T &remove_end();
+  void remove_node(T &node);
+  T &remove_index(const int index);
+  template <class Fn> int remove_if(Fn fn);
+
+  // find
+  template <class Fn> T *find_if(Fn fn) const;
+  template <class Fn> void for_each(Fn fn) const;
+
+  // useful methods
+  void clear();
+  static void swap(IntrusiveList<T, Hook> &a, IntrusiveList<T, Hook> &b);
+  void reverse();
+
+  // iterators (half-open: end() is one past the tail)
+  inline IntrusiveListIterator<T, Hook> begin() const {
+    return IntrusiveListIterator<T, Hook>(this->head, this);
+  }
+  inline IntrusiveListIterator<T, Hook> end() const {
+    return IntrusiveListIterator<T, Hook>(nullptr, this);
+  }
+};
+
+// ---------
+// Link helpers
+// ---------
+
+// Link a free element before the given node (at the end when before is null)
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::link(T *before, T *node) {
+  IntrusiveListHook<T> &add = IntrusiveList<T, Hook>::hook(node);
+
+  if (this->head == nullptr) {
+    add.next = nullptr;
+    add.prev = node;
+    this->head = node;
+  } else if (before == nullptr) {
+    T *tail = this->get_tail();
+    IntrusiveList<T, Hook>::hook(tail).next = node;
+    add.next = nullptr;
+    add.prev = tail;
+    IntrusiveList<T, Hook>::hook(this->head).prev = node;
+  } else {
+    IntrusiveListHook<T> &at = IntrusiveList<T, Hook>::hook(before);
+    add.next = before;
+    add.prev = at.prev;
+
+    if (before == this->head)
+      this->head = node;
+    else
+      IntrusiveList<T, Hook>::hook(at.prev).next = node;
+
+    at.prev = node;
+  }
+
+  ++this->length;
+}
+
+// Unlink an element of this list and reset its hook
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::unlink(T *node) {
+  IntrusiveListHook<T> &target = IntrusiveList<T, Hook>::hook(node);
+
+  if (node == this->head) {
+    this->head = target.next;
+    if (target.next != nullptr)
+      IntrusiveList<T, Hook>::hook(target.next).prev = target.prev;
+  } else {
+    IntrusiveList<T, Hook>::hook(target.prev).next = target.next;
+    if (target.next != nullptr)
+      IntrusiveList<T, Hook>::hook(target.next).prev = target.prev;
+    else
+      IntrusiveList<T, Hook>::hook(this->head).prev = target.prev;
+  }
+
+  target.next = target.prev = nullptr;
+  --this->length;
+}
+
+// Throw if the element is already linked by this hook
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::check_free(const T &element) const {
+  if (IntrusiveList<T, Hook>::is_linked(element))
+    throw std::invalid_argument("Provided element is already linked!");
+}
+
+// Throw if the node is not linked, membership walk only with
+// CHECKED_NODE_HANDLES
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::check_linked(const T &node) const {
+  if (!IntrusiveList<T, Hook>::is_linked(node))
+    throw std::invalid_argument("Provided node is not linked!");
+
+  if (IntrusiveList<T, Hook>::checks_handles && !this->contains(node))
+    throw std::invalid_argument("Provided node was not found in the list!");
+}
+
+// ---------
+// Methods
+// ---------
+
+// Node at the given index (walks from the nearest end)
+template <typename T, IntrusiveListHook<T> T::*Hook>
+T *IntrusiveList<T, Hook>::get_node_by_index(const int index) const {
+  if (index < 0 || index >= this->length)
+    throw std::out_of_range("Provided index is out of range!");
+
+  T *node = this->head;
+  if (index <= this->length / 2) {
+    for (int i = 0; i < index; i++)
+      node = (node->*Hook).next;
+  } else {
+    node = this->get_tail();
+    for (int i = this->length - 1; i > index; i--)
+      node = (node->*Hook).prev;
+  }
+
+  return node;
+}
+
+// Check if the element is in this list (walks the list)
+template <typename T, IntrusiveListHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::contains(const T &element) const {
+  if (!IntrusiveList<T, Hook>::is_linked(element))
+    return false;
+
+  for (T *node = this->head; node != nullptr; node = (node->*Hook).next) {
+    if (node == &element)
+      return true;
+  }
+
+  return false;
+}
+
+// Push element to the end
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::push_end(T &element) {
+  this->check_free(element);
+  this->link(nullptr, &element);
+}
+
+// Push element to the beggining of a list
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::push_begin(T &element) {
+  this->check_free(element);
+  this->link(this->head, &element);
+}
+
+// Push element after specific node
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::push_after(T &node, T &element) {
+  this->check_linked(node);
+  this->check_free(element);
+  this->link((node.*Hook).next, &element);
+}
+
+// Push element before specific node
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::push_before(T &node, T &element) {
+  this->check_linked(node);
+  this->check_free(element);
+  this->link(&node, &element);
+}
+
+// Push element at given position (index)
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::push_index(const int index, T &element) {
+  if (index < 0 || index > this->length)
+    throw std::out_of_range("Provided index is out of range!");
+
+  this->check_free(element);
+  this->link(index == this->length ? nullptr : this->get_node_by_index(index),
+             &element);
+}
+
+// Remove the first element
+template <typename T, IntrusiveListHook<T> T::*Hook>
+T &IntrusiveList<T, Hook>::remove_begin() {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  T *node = this->head;
+  this->unlink(node);
+  return *node;
+}
+
+// Remove the last element
+template <typename T, IntrusiveListHook<T> T::*Hook>
+T &IntrusiveList<T, Hook>::remove_end() {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  T *node = this->get_tail();
+  this->unlink(node);
+  return *node;
+}
+
+// Remove specific node (O(1))
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::remove_node(T &node) {
+  this->check_linked(node);
+  this->unlink(&node);
+}
+
+// Remove element at given position (index)
+template <typename T, IntrusiveListHook<T> T::*Hook>
+T &IntrusiveList<T, Hook>::remove_index(const int index) {
+  T *node = this->get_node_by_index(index);
+  this->unlink(node);
+  return *node;
+}
+
+// Remove every element matching the predicate, returns how many
+template <typename T, IntrusiveListHook<T> T::*Hook>
+template <class Fn>
+int IntrusiveList<T, Hook>::remove_if(Fn fn) {
+  int removed = 0;
+  T *node = this->head;
+
+  while (node != nullptr) {
+    T *next = (node->*Hook).next;
+    if (fn(*node)) {
+      this->unlink(node);
+      removed++;
+    }
+
+    node = next;
+  }
+
+  return removed;
+}
+
+// First element matching the predicate (null if none)
+template <typename T, IntrusiveListHook<T> T::*Hook>
+template <class Fn>
+T *IntrusiveList<T, Hook>::find_if(Fn fn) const {
+  for (T *node = this->head; node != nullptr; node = (node->*Hook).next) {
+    if (fn(*node))
+      return node;
+  }
+
+  return nullptr;
+}
+
+// Call fn on every element from head to tail
+template <typename T, IntrusiveListHook<T> T::*Hook>
+template <class Fn>
+void IntrusiveList<T, Hook>::for_each(Fn fn) const {
+  for (T *node = this->head; node != nullptr; node = (node->*Hook).next)
+    fn(*node);
+}
+
+// Unlink every element (they stay alive)
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::clear() {
+  T *node = this->head;
+  while (node != nullptr) {
+    IntrusiveListHook<T> &target = IntrusiveList<T, Hook>::hook(node);
+    node = target.next;
+    target.next = target.prev = nullptr;
+  }
+
+  this->head = nullptr;
+  this->length = 0;
+}
+
+// Swap two lists (O(1), elements keep their hooks)
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::swap(IntrusiveList<T, Hook> &a,
+                                  IntrusiveList<T, Hook> &b) {
+  std::swap(a.head, b.head);
+  std::swap(a.length, b.length);
+}
+
+// Reverse the list in place (swaps the links of every element)
+template <typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::reverse() {
+  if (this->is_empty())
+    return;
+
+  T *first = this->head, *last = this->get_tail();
+  for (T *node = first; node != nullptr;) {
+    IntrusiveListHook<T> &target = IntrusiveList<T, Hook>::hook(node);
+    T *next = target.next;
+    std::swap(target.next, target.prev);
+    node = next;
+  }
+
+  // the old head becomes the tail, the prev of the new head wraps to it
+  IntrusiveList<T, Hook>::hook(first).next = nullptr;
+  IntrusiveList<T, Hook>::hook(last).prev = first;
+  this->head = last;
+}
+
+#endif
@@ -0,0 +1,23 @@
+/*
+
+An intrusive queue is a FIFO queue over a singly linked list whose single
+link lives in a hook that is a member of the element. The queue does not
+allocate and does not copy: enqueue and dequeue are a couple of pointer
+writes on elements the caller already owns.
+
+The next of the tail points to the tail itself instead of null, so a hook
+alone tells whether its element is linked (next is null only for an
+unlinked element).
+
+Pros:
+    No allocation and no copy of the element on enqueue
+    Half the link memory of an intrusive list
+
+Cons:
+    Erasing from the middle walks to the previous element
+    Elements must outlive the queue and must not move while linked
+    The queue cannot be copied
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,350 @@
+#ifndef INTRUSIVEQUEUE_H
+#define INTRUSIVEQUEUE_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+// Intrusive queue hook, a member of the element (one hook per queue the
+// element can be in at the same time). The next of the tail points to the
+// tail itself, so every linked element has a non-null next and a hook knows
+// by itself whether it is linked.
+
+template <class T> class IntrusiveQueueHook {
+public:
+  T *next;
+  IntrusiveQueueHook() : next(nullptr){};
+
+  // a hook belongs to its element, copying the element must not copy links
+  IntrusiveQueueHook(const IntrusiveQueueHook<T> &) : next(nullptr){};
+  IntrusiveQueueHook<T> &operator=(const IntrusiveQueueHook<T> &) {
+    return *this;
+  }
+
+  inline bool is_linked() const { return this->next != nullptr; }
+};
+
+// Intrusive Queue Iterator (forward)
+
+template <class T, IntrusiveQueueHook<T> T::*Hook>
+class IntrusiveQueueIterator {
+private:
+  T *node;
+
+public:
+  // iterator traits
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  // constructors
+  inline IntrusiveQueueIterator<T, Hook>() : node(nullptr){};
+  inline IntrusiveQueueIterator<T, Hook>(T *node) : node(node){};
+
+  // getters
+  inline T *get_node() const { return this->node; }
+
+  // increment operators
+  inline IntrusiveQueueIterator<T, Hook> &operator++() {
+    if (this->node != nullptr) {
+      T *next = (this->node->*Hook).next;
+      this->node = next == this->node ? nullptr : next;
+    }
+
+    return *this;
+  }
+
+  inline IntrusiveQueueIterator<T, Hook> operator++(int) {
+    IntrusiveQueueIterator<T, Hook> temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  // get operators
+  inline T &operator*() const {
+    if (this->node == nullptr)
+      throw std::out_of_range("Iterator is out of range");
+
+    return *this->node;
+  }
+
+  inline T *operator->() const {
+    if (this->node == nullptr)
+      throw std::out_of_range("Iterator is out of range");
+
+    return this->node;
+  }
+
+  // compare operators
+  inline bool operator==(const IntrusiveQueueIterator<T, Hook> &other) const {
+    return this->node == other.node;
+  }
+
+  inline bool operator!=(const IntrusiveQueueIterator<T, Hook> &other) const {
+    return this->node != other.node;
+  }
+};
+
+// Intrusive queue on a singly linked list: links elements owned by someone
+// else through their Hook member, never allocates and never copies an element
+
+template <class T, IntrusiveQueueHook<T> T::*Hook> class IntrusiveQueue {
+private:
+  T *head;
+  T *tail;
+  int length;
+
+  // link helper functions
+  static inline IntrusiveQueueHook<T> &hook(T *node) { return node->*Hook; }
+  inline T *next_of(T *node) const {
+    return node == this->tail ? nullptr : (node->*Hook).next;
+  }
+  void unlink_after(T *prev, T *node);
+
+public:
+  // constructors
+  inline explicit IntrusiveQueue<T, Hook>()
+      : head(nullptr), tail(nullptr), length(0){};
+
+  // elements point at each other through their hooks, so a queue cannot be
+  // copied (moving the hooks of every element is what swap is for)
+  IntrusiveQueue<T, Hook>(const IntrusiveQueue<T, Hook> &) = delete;
+  IntrusiveQueue<T, Hook> &operator=(const IntrusiveQueue<T, Hook> &) = delete;
+
+  // destructor (unlinks the elements, they stay alive)
+  inline ~IntrusiveQueue<T, Hook>() { this->clear(); }
+
+  // getters
+  T &get_first() const;
+  T &get_last() const;
+  inline T *get_head() const { return this->head; }
+  inline T *get_tail() const { return this->tail; }
+  inline int get_length() const { return this->length; }
+
+  // bool methods
+  inline bool is_empty() const { return this->head == nullptr; }
+  static inline bool is_linked(const T &element) {
+    return (element.*Hook).is_linked();
+  }
+  bool contains(const T &element) const;
+
+  // adding to the queue (the element must not be linked by this hook yet)
+  void enqueue(T &element);
+
+  // erasing from the queue (dequeue returns the unlinked element, erase
+  // walks to the element before the given one)
+  T &dequeue();
+  void erase(T &element);
+  template <class Fn> int erase_if(Fn fn);
+
+  // find
+  template <class Fn> T *find_if(Fn fn) const;
+  template <class Fn> void for_each(Fn fn) const;
+
+  // useful methods
+  void clear();
+  static void swap(IntrusiveQueue<T, Hook> &a, IntrusiveQueue<T, Hook> &b);
+  void reverse();
+
+  // iterators (half-open: end() is one past the tail)
+  inline IntrusiveQueueIterator<T, Hook> begin() const {
+    return IntrusiveQueueIterator<T, Hook>(this->head);
+  }
+  inline IntrusiveQueueIterator<T, Hook> end() const {
+    return IntrusiveQueueIterator<T, Hook>(nullptr);
+  }
+};
+
+// ---------
+// Link helpers
+// ---------
+
+// Unlink the node following prev (prev is null for the head) and reset its
+// hook
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::unlink_after(T *prev, T *node) {
+  T *next = this->next_of(node);
+
+  if (prev == nullptr)
+    this->head = next;
+  else
+    IntrusiveQueue<T, Hook>::hook(prev).next = next != nullptr ? next : prev;
+
+  if (node == this->tail)
+    this->tail = prev;
+
+  IntrusiveQueue<T, Hook>::hook(node).next = nullptr;
+  --this->length;
+}
+
+// ---------
+// Methods
+// ---------
+
+// First element of the queue
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+T &IntrusiveQueue<T, Hook>::get_first() const {
+  if (this->is_empty())
+    throw std::length_error("Queue is empty!");
+
+  return *this->head;
+}
+
+// Last element of the queue
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+T &IntrusiveQueue<T, Hook>::get_last() const {
+  if (this->is_empty())
+    throw std::length_error("Queue is empty!");
+
+  return *this->tail;
+}
+
+// Check if the element is in this queue (walks the queue)
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+bool IntrusiveQueue<T, Hook>::contains(const T &element) const {
+  if (!IntrusiveQueue<T, Hook>::is_linked(element))
+    return false;
+
+  for (T *node = this->head; node != nullptr; node = this->next_of(node)) {
+    if (node == &element)
+      return true;
+  }
+
+  return false;
+}
+
+// Enqueue element to the end of the queue
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::enqueue(T &element) {
+  if (IntrusiveQueue<T, Hook>::is_linked(element))
+    throw std::invalid_argument("Provided element is already linked!");
+
+  IntrusiveQueue<T, Hook>::hook(&element).next = &element;
+
+  if (this->tail != nullptr)
+    IntrusiveQueue<T, Hook>::hook(this->tail).next = &element;
+  else
+    this->head = &element;
+
+  this->tail = &element;
+  ++this->length;
+}
+
+// Dequeue the first element
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+T &IntrusiveQueue<T, Hook>::dequeue() {
+  if (this->is_empty())
+    throw std::length_error("Queue is empty!");
+
+  T *node = this->head;
+  this->unlink_after(nullptr, node);
+  return *node;
+}
+
+// Erase specific element (O(n), a singly linked node does not know its prev)
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::erase(T &element) {
+  T *prev = nullptr;
+  for (T *node = this->head; node != nullptr; node = this->next_of(node)) {
+    if (node == &element) {
+      this->unlink_after(prev, node);
+      return;
+    }
+
+    prev = node;
+  }
+
+  throw std::invalid_argument("Provided element was not found in the queue!");
+}
+
+// Erase every element matching the predicate, returns how many
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+template <class Fn>
+int IntrusiveQueue<T, Hook>::erase_if(Fn fn) {
+  int erased = 0;
+  T *prev = nullptr, *node = this->head;
+
+  while (node != nullptr) {
+    T *next = this->next_of(node);
+    if (fn(*node)) {
+      this->unlink_after(prev, node);
+      erased++;
+    } else {
+      prev = node;
+    }
+
+    node = next;
+  }
+
+  return erased;
+}
+
+// First element matching the predicate (null if none)
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+template <class Fn>
+T *IntrusiveQueue<T, Hook>::find_if(Fn fn) const {
+  for (T *node = this->head; node != nullptr; node = this->next_of(node)) {
+    if (fn(*node))
+      return node;
+  }
+
+  return nullptr;
+}
+
+// Call fn on every element from head to tail
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+template <class Fn>
+void IntrusiveQueue<T, Hook>::for_each(Fn fn) const {
+  for (T *node = this->head; node != nullptr; node = this->next_of(node))
+    fn(*node);
+}
+
+// Unlink every element (they stay alive)
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::clear() {
+  T *node = this->head;
+  while (node != nullptr) {
+    T *next = this->next_of(node);
+    IntrusiveQueue<T, Hook>::hook(node).next = nullptr;
+    node = next;
+  }
+
+  this->head = this->tail = nullptr;
+  this->length = 0;
+}
+
+// Swap two queues (O(1), elements keep their hooks)
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::swap(IntrusiveQueue<T, Hook> &a,
+                                   IntrusiveQueue<T, Hook> &b) {
+  std::swap(a.head, b.head);
+  std::swap(a.tail, b.tail);
+  std::swap(a.length, b.length);
+}
+
+// Reverse the queue in place
+template <typename T, IntrusiveQueueHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::reverse() {
+  if (this->is_empty())
+    return;
+
+  T *prev = this->head, *node = this->next_of(this->head);
+
+  // the old head becomes the tail and points to itself
+  IntrusiveQueue<T, Hook>::hook(this->head).next = this->head;
+
+  while (node != nullptr) {
+    T *next = this->next_of(node);
+    IntrusiveQueue<T, Hook>::hook(node).next = prev;
+    prev = node;
+    node = next;
+  }
+
+  this->tail = this->head;
+  this->head = prev;
+}
+
+#endif
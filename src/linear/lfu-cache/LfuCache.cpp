@@ -0,0 +1,24 @@
+/*
+
+A least frequently used (LFU) cache evicts the entry that was used the
+fewest times, and the least recently used one among those. Entries are
+kept in frequency buckets: a linked list of buckets in order of frequency,
+each holding a linked list of its entries in order of use. A hit relinks
+the entry node into the bucket of the next frequency (creating it right
+after the current one when it is missing), an eviction drops the last entry
+of the first bucket, so every operation is O(1) without any heap.
+
+New entries start with one use and are evicted first, which protects the
+often used entries from scans of keys that are used once.
+
+Pros:
+    O(1) get, put and eviction
+    Keeps the hot entries through scans
+
+Cons:
+    Entries that were hot once stay until they are evicted or erased
+    Not thread-safe (see ShardedCache)
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,280 @@
+#ifndef LFUCACHE_H
+#define LFUCACHE_H
+
+#include <CacheEntry.h>
+#include <LinkedList.h>
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Frequency bucket of a least frequently used cache (its entries were all
+// used frequency times, most recently used first)
+
+template <class K, class V> class LfuBucket {
+public:
+  long long frequency;
+  LinkedList<CacheEntry<K, V>> entries;
+  LfuBucket(const long long frequency) : frequency(frequency){};
+};
+
+// Least frequently used cache: a linked list of frequency buckets (lowest
+// first), each a linked list of entries, and a hash index from keys to
+// their bucket and entry nodes. A use moves the entry node to the bucket of
+// the next frequency, an eviction drops the least recently used entry of
+// the first bucket, both in O(1)
+
+template <class K, class V, class Hash = std::hash<K>> class LfuCache {
+private:
+  using Entry = CacheEntry<K, V>;
+  using Bucket = LfuBucket<K, V>;
+  using EntryNode = ListNode<Entry>;
+  using BucketNode = ListNode<Bucket>;
+
+  struct Position {
+    BucketNode *bucket;
+    EntryNode *entry;
+  };
+
+  LinkedList<Bucket> buckets;
+  std::unordered_map<K, Position, Hash> index;
+  std::size_t capacity;
+  std::size_t weight;
+  CacheWeigher<K, V> weigher;
+  CacheStats stats;
+
+  // helper functions
+  inline std::size_t weigh(const K &key, const V &value) const {
+    return this->weigher ? this->weigher(key, value) : 1;
+  }
+  void touch(Position &position);
+  void evict(const std::size_t room, const EntryNode *keep = nullptr);
+
+public:
+  // constructors (capacity is a number of entries, or the total weight with
+  // a weigher)
+  explicit LfuCache<K, V, Hash>(const std::size_t capacity,
+                                const CacheWeigher<K, V> &weigher = nullptr);
+
+  // the index points into the lists, so the cache cannot be copied
+  LfuCache<K, V, Hash>(const LfuCache<K, V, Hash> &) = delete;
+  LfuCache<K, V, Hash> &operator=(const LfuCache<K, V, Hash> &) = delete;
+
+  // getters
+  inline int get_length() const { return static_cast<int>(this->index.size()); }
+  inline std::size_t get_weight() const { return this->weight; }
+  inline std::size_t get_capacity() const { return this->capacity; }
+  inline const CacheStats &get_stats() const { return this->stats; }
+  long long get_frequency(const K &key) const;
+
+  // bool methods (contains does not count as a use)
+  inline bool is_empty() const { return this->index.empty(); }
+  inline bool contains(const K &key) const {
+    return this->index.find(key) != this->index.end();
+  }
+
+  // using the cache (get copies the value on a hit, put returns true for a
+  // new key and evicts the least frequently used entries to make room, ties
+  // go to the least recently used)
+  bool get(const K &key, V &value);
+  bool put(const K &key, const V &value);
+  bool erase(const K &key);
+
+  // changing the capacity evicts what does not fit anymore
+  void set_capacity(const std::size_t capacity);
+
+  // converting methods (most frequently used first, the last entry is
+  // evicted first)
+  const std::vector<std::pair<K, V>> to_vector() const;
+
+  // useful methods
+  inline void reset_stats() { this->stats = CacheStats(); }
+  void clear();
+};
+
+// ---------
+// Constructors
+// ---------
+
+// Empty cache
+template <typename K, typename V, typename Hash>
+LfuCache<K, V, Hash>::LfuCache(const std::size_t capacity,
+                               const CacheWeigher<K, V> &weigher)
+    : capacity(capacity), weight(0), weigher(weigher) {
+  if (capacity == 0)
+    throw std::invalid_argument("Capacity should be positive!");
+}
+
+// ---------
+// Helpers
+// ---------
+
+// Move an entry to the front of the next frequency bucket (relinks the
+// entry node, a bucket is created or dropped when needed)
+template <typename K, typename V, typename Hash>
+void LfuCache<K, V, Hash>::touch(Position &position) {
+  BucketNode *bucket = position.bucket, *next = bucket->next;
+  long long frequency = bucket->data.frequency + 1;
+
+  if (next == nullptr || next->data.frequency != frequency) {
+    this->buckets.insert_trusted(next, Bucket(frequency));
+    next = bucket->next;
+  }
+
+  LinkedList<Entry> &from = bucket->data.entries, &to = next->data.entries;
+  to.relink_trusted(to.get_head(), from, position.entry);
+  position.bucket = next;
+
+  if (from.is_empty())
+    this->buckets.unlink_trusted(bucket);
+}
+
+// Drop least frequently used entries until room more weight fits the
+// capacity, never the keep entry
+template <typename K, typename V, typename Hash>
+void LfuCache<K, V, Hash>::evict(const std::size_t room,
+                                 const EntryNode *keep) {
+  while (this->weight + room > this->capacity) {
+    BucketNode *bucket = this->buckets.get_head();
+    EntryNode *last = bucket->data.entries.get_tail();
+
+    // room fits the capacity on its own, so something else is left
+    if (last == keep) {
+      last = last->prev;
+      if (last == nullptr) {
+        bucket = bucket->next;
+        last = bucket->data.entries.get_tail();
+      }
+    }
+
+    this->weight -= last->data.weight;
+    this->index.erase(last->data.key);
+    bucket->data.entries.unlink_trusted(last);
+    if (bucket->data.entries.is_empty())
+      this->buckets.unlink_trusted(bucket);
+
+    this->stats.evictions++;
+  }
+}
+
+// ---------
+// Getters
+// ---------
+
+// Number of uses of the key (0 if it is not cached)
+template <typename K, typename V, typename Hash>
+long long LfuCache<K, V, Hash>::get_frequency(const K &key) const {
+  auto found = this->index.find(key);
+  return found == this->index.end() ? 0
+                                    : found->second.bucket->data.frequency;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Copy the value of the key into value and count the use
+template <typename K, typename V, typename Hash>
+bool LfuCache<K, V, Hash>::get(const K &key, V &value) {
+  auto found = this->index.find(key);
+  if (found == this->index.end()) {
+    this->stats.misses++;
+    return false;
+  }
+
+  this->stats.hits++;
+  this->touch(found->second);
+  value = found->second.entry->data.value;
+  return true;
+}
+
+// Insert the key with one use, or replace its value and count the use
+template <typename K, typename V, typename Hash>
+bool LfuCache<K, V, Hash>::put(const K &key, const V &value) {
+  std::size_t weight = this->weigh(key, value);
+  if (weight > this->capacity)
+    throw std::invalid_argument("Entry is heavier than the capacity!");
+
+  auto found = this->index.find(key);
+  if (found != this->index.end()) {
+    EntryNode *node = found->second.entry;
+    this->weight -= node->data.weight;
+    this->touch(found->second);
+    this->evict(weight, node);
+
+    node->data.value = value;
+    node->data.weight = weight;
+    this->weight += weight;
+    return false;
+  }
+
+  // evicting first, a new entry would be the least frequently used one
+  this->evict(weight);
+
+  BucketNode *first = this->buckets.get_head();
+  if (first == nullptr || first->data.frequency != 1) {
+    this->buckets.push_begin(Bucket(1));
+    first = this->buckets.get_head();
+  }
+
+  first->data.entries.push_begin(Entry(key, value, weight));
+  this->index.emplace(key,
+                      Position{first, first->data.entries.get_head()});
+  this->weight += weight;
+  return true;
+}
+
+// Remove the key, false if it was not cached
+template <typename K, typename V, typename Hash>
+bool LfuCache<K, V, Hash>::erase(const K &key) {
+  auto found = this->index.find(key);
+  if (found == this->index.end())
+    return false;
+
+  BucketNode *bucket = found->second.bucket;
+  this->weight -= found->second.entry->data.weight;
+  bucket->data.entries.unlink_trusted(found->second.entry);
+  if (bucket->data.entries.is_empty())
+    this->buckets.unlink_trusted(bucket);
+
+  this->index.erase(found);
+  return true;
+}
+
+// Set the capacity, evicting entries when it shrinks
+template <typename K, typename V, typename Hash>
+void LfuCache<K, V, Hash>::set_capacity(const std::size_t capacity) {
+  if (capacity == 0)
+    throw std::invalid_argument("Capacity should be positive!");
+
+  this->capacity = capacity;
+  this->evict(0);
+}
+
+// Entries from the most to the least frequently used (most recently used
+// first on ties)
+template <typename K, typename V, typename Hash>
+const std::vector<std::pair<K, V>> LfuCache<K, V, Hash>::to_vector() const {
+  std::vector<std::pair<K, V>> vec;
+  vec.reserve(this->index.size());
+
+  for (BucketNode *bucket = this->buckets.get_tail(); bucket != nullptr;
+       bucket = bucket->prev)
+    for (const Entry &entry : bucket->data.entries)
+      vec.emplace_back(entry.key, entry.value);
+
+  return vec;
+}
+
+// Remove every entry (counters are kept)
+template <typename K, typename V, typename Hash>
+void LfuCache<K, V, Hash>::clear() {
+  this->buckets.clear();
+  this->index.clear();
+  this->weight = 0;
+}
+
+#endif
@@ -2,13 +2,29 @@
 #define LINKEDLIST_H
 
 #include <ListIterator.h>
+#include <ListSort.h>
 
+#include <cstdlib>
+#include <ctime>
 #include <functional>
+#include <initializer_list>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
 
+// Node handle checking policy: in debug builds push_after/push_before and
+// remove_node/remove_after/remove_before walk the list (O(n)) to verify that
+// the node belongs to it, with NDEBUG they trust the handle and are O(1).
+// Define CHECKED_NODE_HANDLES=0/1 before including to override it.
+#ifndef CHECKED_NODE_HANDLES
+#ifdef NDEBUG
+#define CHECKED_NODE_HANDLES 0
+#else
+#define CHECKED_NODE_HANDLES 1
+#endif
+#endif
+
 // Doubly linked list node
 
 template <class T> class ListNode {
@@ -19,7 +35,8 @@ public:
   ListNode(const T &data) : next(nullptr), prev(nullptr), data(data) {};
 };
 
-// Doubly linked list
+// Doubly linked list (const lookups by index move the cached finger, so
+// even const access to one list needs external locking across threads)
 
 template <class T> class LinkedList {
 private:
@@ -27,7 +44,30 @@ private:
   ListNode<T> *tail;
   int length;
 
+  // cached positions (node and its index, node is null when unknown): the
+  // finger is the last node reached by index, middle is kept by push_middle
+  struct Cursor {
+    ListNode<T> *node;
+    int index;
+  };
+  mutable Cursor finger = {nullptr, 0};
+  Cursor middle = {nullptr, 0};
+
+  // node handle helper functions
+  void check_handle(const ListNode<T> *node) const;
+  void unlink(ListNode<T> *node, const int &at = -1);
+  void link_chain(ListNode<T> *before, ListNode<T> *first, ListNode<T> *last,
+                  const int &count, const int &at = -1);
+
+  // positional helper functions
+  ListNode<T> *node_at(const int &index) const;
+  inline void reset_cursors() {
+    this->finger.node = this->middle.node = nullptr;
+  }
+
 public:
+  static constexpr bool checks_handles = CHECKED_NODE_HANDLES;
+
   // constructors
   inline explicit LinkedList<T>() : head(nullptr), tail(nullptr), length(0){};
   LinkedList<T>(int size, const T &value);
@@ -51,6 +91,7 @@ public:
   // bool methods
   inline bool is_empty() const { return this->head == nullptr; }
   bool contains(const ListNode<T> *node) const;
+  bool owns(const ListNode<T> *node) const;
 
   // adding to the list
   void push_end(const T &element);
@@ -61,6 +102,21 @@ public:
   void push_random(const T &element);
   void push_middle(const T &element);
   void push_vector(const int index, const std::vector<T> &vec);
+  template <class InputIt>
+  void push_range(const int index, InputIt first, InputIt last);
+
+  // moving nodes between lists (no allocation)
+  void splice(const ListIterator<T> pos, LinkedList<T> &other);
+  void splice(const ListIterator<T> pos, LinkedList<T> &other,
+              const ListIterator<T> first, const ListIterator<T> last);
+
+  // trusted node handles (O(1) in every build, the membership walk of
+  // CHECKED_NODE_HANDLES is skipped: only for owners that keep their own
+  // index of the nodes, like the caches; before is null for the end)
+  void insert_trusted(ListNode<T> *before, const T &element);
+  void relink_trusted(ListNode<T> *before, LinkedList<T> &other,
+                      ListNode<T> *node);
+  void unlink_trusted(ListNode<T> *node);
 
   // removing from the list
   inline void remove_end() { this->remove_node(this->tail); };
@@ -73,7 +129,7 @@ public:
   }
   void remove_all(const T &element);
   inline void remove_index(const int &index) {
-    this->remove_node(this->get_node_by_index(index));
+    this->unlink(this->get_node_by_index(index), index);
   }
   void remove_if(std::function<bool(T)> fn);
 
@@ -87,9 +143,17 @@ public:
   // useful methods
   void clear();
 
-  // iterators
-  inline ListIterator<T> begin() const { return ListIterator<T>(this->head); }
-  inline ListIterator<T> end() const { return ListIterator<T>(this->tail); }
+  // sorting by relinking nodes (stable, no allocation; merge expects both
+  // lists sorted by comp and moves every node of other into this list)
+  template <class Compare = std::less<T>> void sort(Compare comp = Compare());
+  template <class Compare = std::less<T>>
+  void merge(LinkedList<T> &other, Compare comp = Compare());
+
+  // iterators (half-open: end() is one past the tail)
+  inline ListIterator<T> begin() const {
+    return ListIterator<T>(this->head, this);
+  }
+  inline ListIterator<T> end() const { return ListIterator<T>(nullptr, this); }
 
   // compare methods
   bool operator>(const LinkedList<T> &other) const;
@@ -145,103 +209,166 @@ LinkedList<T>::LinkedList(const LinkedList<T> &other)
 }
 
 // ---------
-// Methods
+// Node handle helpers
 // ---------
 
-// Push element to the end
-template <typename T> void LinkedList<T>::push_end(const T &element) {
-  ListNode<T> *add = new ListNode<T>(element);
-  ++this->length;
+// Null check, membership walk only with CHECKED_NODE_HANDLES
+template <typename T>
+void LinkedList<T>::check_handle(const ListNode<T> *node) const {
+  if (node == nullptr)
+    throw std::invalid_argument("Provided node is null!");
 
-  if (this->is_empty()) {
-    this->head = this->tail = add;
-    return;
+  if (LinkedList<T>::checks_handles && !this->owns(node))
+    throw std::invalid_argument("Provided node was not found in the list!");
+}
+
+// Unlink and delete a node of this list (O(1)); at is its index when the
+// caller knows it, so the cached cursors stay valid
+template <typename T>
+void LinkedList<T>::unlink(ListNode<T> *node, const int &at) {
+  for (Cursor *cursor : {&this->finger, &this->middle}) {
+    if (cursor->node == nullptr)
+      continue;
+
+    if (cursor->node == node) {
+      // step to a neighbour instead of dropping the cursor
+      if (node->next != nullptr)
+        cursor->node = node->next;
+      else if (node->prev != nullptr)
+        *cursor = {node->prev, cursor->index - 1};
+      else
+        cursor->node = nullptr;
+    } else if (at >= 0 ? cursor->index > at : node == this->head) {
+      cursor->index--;
+    } else if (at < 0 && node != this->tail) {
+      cursor->node = nullptr;
+    }
   }
 
-  add->prev = this->tail;
-  this->tail->next = add;
+  if (this->head == node)
+    this->head = node->next;
 
-  this->tail = add;
-}
+  if (this->tail == node)
+    this->tail = node->prev;
 
-// Push element to the beggining of a list
-template <typename T> void LinkedList<T>::push_begin(const T &element) {
-  ListNode<T> *add = new ListNode<T>(element);
-  ++this->length;
+  if (node->next != nullptr)
+    node->next->prev = node->prev;
 
-  if (this->is_empty()) {
-    this->head = this->tail = add;
-    return;
-  }
+  if (node->prev != nullptr)
+    node->prev->next = node->next;
 
-  add->next = this->head;
-  this->head = this->head->prev = add;
+  --this->length;
+  delete node;
 }
 
-// Push element after specific node
+// Link a detached chain [first, last] of count nodes before the given node
+// (at the end when before is null); at is the index of first when the caller
+// knows it, so the cached cursors stay valid
 template <typename T>
-void LinkedList<T>::push_after(const ListNode<T> *node, const T &element) {
-  if (this->is_empty())
-    throw std::length_error("List is empty!");
+void LinkedList<T>::link_chain(ListNode<T> *before, ListNode<T> *first,
+                               ListNode<T> *last, const int &count,
+                               const int &at) {
+  for (Cursor *cursor : {&this->finger, &this->middle}) {
+    if (cursor->node == nullptr || before == nullptr)
+      continue;
+
+    if (at >= 0 ? cursor->index >= at
+                : before == this->head || before == cursor->node)
+      cursor->index += count;
+    else if (at < 0)
+      cursor->node = nullptr;
+  }
 
-  if (node == nullptr)
-    throw std::invalid_argument("Provided node is null!");
+  ListNode<T> *after = before != nullptr ? before->prev : this->tail;
 
-  ListNode<T> *add = new ListNode<T>(element);
-  ListNode<T> *temp = this->head;
+  first->prev = after;
+  last->next = before;
 
-  while (temp != nullptr && temp != node)
-    temp = temp->next;
+  if (after != nullptr)
+    after->next = first;
+  else
+    this->head = first;
 
-  if (temp == nullptr)
-    throw std::invalid_argument("Provided node was not found in the list!");
+  if (before != nullptr)
+    before->prev = last;
+  else
+    this->tail = last;
 
-  add->next = temp->next;
-  add->prev = temp;
-  temp->next = add;
+  this->length += count;
+}
 
-  ++this->length;
+// Node at a valid index, walked from the nearest of head, tail, finger and
+// middle (the finger is moved there)
+template <typename T>
+ListNode<T> *LinkedList<T>::node_at(const int &index) const {
+  ListNode<T> *node = this->head;
+  int from = 0, distance = index;
+
+  if (this->length - 1 - index < distance) {
+    node = this->tail;
+    from = this->length - 1;
+    distance = from - index;
+  }
 
-  if (temp == this->tail)
-    this->tail = add;
+  for (Cursor cursor : {this->finger, this->middle}) {
+    if (cursor.node != nullptr && std::abs(cursor.index - index) < distance) {
+      node = cursor.node;
+      from = cursor.index;
+      distance = std::abs(from - index);
+    }
+  }
+
+  for (; from < index; ++from)
+    node = node->next;
+
+  for (; from > index; --from)
+    node = node->prev;
 
-  if (add->next != nullptr)
-    add->next->prev = add;
+  this->finger = {node, index};
+  return node;
 }
 
-// Push element before specific node
-template <typename T>
-void LinkedList<T>::push_before(const ListNode<T> *node, const T &element) {
-  if (this->is_empty())
-    throw std::length_error("List is empty!");
+// ---------
+// Methods
+// ---------
 
-  if (node == nullptr)
-    throw std::invalid_argument("Provided node is null!");
+// Push element to the end
+template <typename T> void LinkedList<T>::push_end(const T &element) {
+  ListNode<T> *add = new ListNode<T>(element);
+  this->link_chain(nullptr, add, add, 1, this->length);
+}
 
+// Push element to the beggining of a list
+template <typename T> void LinkedList<T>::push_begin(const T &element) {
   ListNode<T> *add = new ListNode<T>(element);
-  ListNode<T> *temp = this->head;
+  this->link_chain(this->head, add, add, 1, 0);
+}
 
-  while (temp != nullptr && temp != node)
-    temp = temp->next;
+// Push element after specific node
+template <typename T>
+void LinkedList<T>::push_after(const ListNode<T> *node, const T &element) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
 
-  if (temp == nullptr)
-    throw std::invalid_argument("Provided node was not found in the list!");
+  this->check_handle(node);
 
-  add->prev = temp->prev;
-  add->next = temp;
+  ListNode<T> *add = new ListNode<T>(element);
+  this->link_chain(node->next, add, add, 1);
+}
 
-  ++this->length;
+// Push element before specific node
+template <typename T>
+void LinkedList<T>::push_before(const ListNode<T> *node, const T &element) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
 
-  if (temp->prev != NULL) {
-    add->prev->next = add;
-  } else {
-    this->head = add;
-  }
+  this->check_handle(node);
 
-  temp->prev = add;
+  ListNode<T> *add = new ListNode<T>(element);
+  this->link_chain(const_cast<ListNode<T> *>(node), add, add, 1);
 }
 
-// Push element at given position (index)
+// Push element at given position (index, length appends)
 template <typename T>
 void LinkedList<T>::push_index(const int index, const T &element) {
   if (this->is_empty())
@@ -250,30 +377,17 @@ void LinkedList<T>::push_index(const int index, const T &element) {
   if (index < 0 || index > this->length)
     throw std::out_of_range("Provided index is out of range!");
 
-  ListNode<T> *add = new ListNode<T>(element);
-  ListNode<T> *temp = this->head;
-
   if (index == 0) {
     this->push_begin(element);
     return;
   }
 
-  if (index == this->length - 1) {
-    this->push_end(element);
-    return;
-  }
-
-  for (int i = 1; i < index && temp != nullptr; ++i)
-    temp = temp->next;
-
-  add->prev = temp;
-  add->next = temp->next;
-  temp->next = add;
-
-  ++this->length;
+  ListNode<T> *before =
+      index == this->length ? nullptr : this->node_at(index);
+  ListNode<T> *add = new ListNode<T>(element);
 
-  if (add->next != NULL)
-    add->next->prev = add;
+  this->link_chain(before, add, add, 1, index);
+  this->finger = {add, index};
 }
 
 // Push element at the middle of a list
@@ -288,24 +402,13 @@ template <typename T> void LinkedList<T>::push_middle(const T &element) {
     return;
   }
 
+  // the cached middle is at most one step away after the previous call
+  int index = (this->length - 1) / 2;
+  ListNode<T> *temp = this->node_at(index);
   ListNode<T> *add = new ListNode<T>(element);
-  ListNode<T> *temp = this->head;
-
-  for (size_t i = 0; i < (this->length - 1) / 2; ++i)
-    temp = temp->next;
 
-  add->next = temp->next;
-  add->prev = temp;
-
-  if (temp->next != nullptr)
-    temp->next->prev = add;
-
-  temp->next = add;
-
-  if (temp == this->tail)
-    this->tail = add;
-
-  ++this->length;
+  this->link_chain(temp->next, add, add, 1, index + 1);
+  this->middle = {temp, index};
 }
 
 // Push element at the random place
@@ -333,111 +436,211 @@ void LinkedList<T>::push_vector(const int index, const std::vector<T> &vec) {
   if (index < 0 || index > this->length - 1)
     throw std::out_of_range("Provided index is out of range!");
 
-  int i = index;
-  for (const T &element : vec) {
-    this->push_index(i++, element);
+  this->push_range(index, vec.begin(), vec.end());
+}
+
+// Push a range so that its first element lands at the given index (0 to
+// length, builds the chain in one pass and links it after one walk)
+template <typename T>
+template <class InputIt>
+void LinkedList<T>::push_range(const int index, InputIt first, InputIt last) {
+  if (index < 0 || index > this->length)
+    throw std::out_of_range("Provided index is out of range!");
+
+  ListNode<T> *chain_first = nullptr, *chain_last = nullptr;
+  int count = 0;
+
+  try {
+    for (; first != last; ++first) {
+      ListNode<T> *add = new ListNode<T>(*first);
+      add->prev = chain_last;
+
+      if (chain_last != nullptr)
+        chain_last->next = add;
+      else
+        chain_first = add;
+
+      chain_last = add;
+      ++count;
+    }
+  } catch (...) {
+    while (chain_first != nullptr) {
+      ListNode<T> *next = chain_first->next;
+      delete chain_first;
+      chain_first = next;
+    }
+
+    throw;
   }
+
+  if (count == 0)
+    return;
+
+  ListNode<T> *before = index == this->length ? nullptr : this->node_at(index);
+  this->link_chain(before, chain_first, chain_last, count, index);
 }
 
-// Remove first node of the list
-template <typename T> void LinkedList<T>::remove_begin() {
-  if (this->is_empty())
-    throw std::length_error("List is empty!");
+// Move all nodes of the other list before pos (O(1))
+template <typename T>
+void LinkedList<T>::splice(const ListIterator<T> pos, LinkedList<T> &other) {
+  if (&other == this)
+    throw std::invalid_argument("Cannot splice a list into itself!");
 
-  ListNode<T> *temp = this->head;
-  this->head = temp->next;
+  if (pos.get_node() != nullptr)
+    this->check_handle(pos.get_node());
 
-  --this->length;
-  delete temp;
+  if (other.is_empty())
+    return;
 
-  if (!this->is_empty())
-    this->head->prev = nullptr;
+  this->link_chain(pos.get_node(), other.head, other.tail, other.length);
+  other.head = other.tail = nullptr;
+  other.length = 0;
+  other.reset_cursors();
 }
 
-// Remove provided node
-template <typename T> void LinkedList<T>::remove_node(const ListNode<T> *node) {
-  if (this->is_empty())
-    throw std::length_error("List is empty!");
+// Move the nodes [first, last) of the other list before pos (O(1) pointer
+// surgery, the range is walked once to count it)
+template <typename T>
+void LinkedList<T>::splice(const ListIterator<T> pos, LinkedList<T> &other,
+                           const ListIterator<T> first,
+                           const ListIterator<T> last) {
+  if (first == last)
+    return;
 
-  if (node == nullptr)
-    throw std::invalid_argument("Provided node is null!");
+  if (first.get_node() == nullptr)
+    throw std::invalid_argument("Range should not start at end()!");
 
-  ListNode<T> *temp = this->head;
+  other.check_handle(first.get_node());
+  if (pos.get_node() != nullptr)
+    this->check_handle(pos.get_node());
 
-  while (temp != nullptr && temp != node)
-    temp = temp->next;
+  bool same = &other == this;
+  ListNode<T> *from = first.get_node(), *to = from;
+  int count = 1;
+  while (true) {
+    if (same && to != from && to == pos.get_node())
+      throw std::invalid_argument("Position should not be inside the range!");
 
-  if (temp == nullptr)
-    throw std::invalid_argument("Provided node was not found in the list!");
+    if (to->next == last.get_node())
+      break;
 
-  if (this->head == node)
-    this->head = node->next;
+    if (to->next == nullptr)
+      throw std::invalid_argument("Range end is not after its start!");
 
-  if (this->tail == node)
-    this->tail = node->prev;
+    to = to->next;
+    ++count;
+  }
 
-  if (node->next != nullptr)
-    node->next->prev = node->prev;
+  // the range is already right before pos
+  if (same && (pos == first || pos == last))
+    return;
 
-  if (node->prev != nullptr)
-    node->prev->next = node->next;
+  // cut [from, to] out of the other list
+  if (from->prev != nullptr)
+    from->prev->next = to->next;
+  else
+    other.head = to->next;
 
-  --this->length;
-  delete node;
+  if (to->next != nullptr)
+    to->next->prev = from->prev;
+  else
+    other.tail = from->prev;
+
+  other.length -= count;
+  other.reset_cursors();
+  from->prev = to->next = nullptr;
+
+  this->link_chain(pos.get_node(), from, to, count);
 }
 
-// Remove node before provided node
+// Push element before a node known to be in the list (at the end when
+// before is null)
 template <typename T>
-void LinkedList<T>::remove_before(const ListNode<T> *node) {
-  if (this->is_empty())
-    throw std::length_error("List is empty!");
+void LinkedList<T>::insert_trusted(ListNode<T> *before, const T &element) {
+  ListNode<T> *add = new ListNode<T>(element);
+  this->link_chain(before, add, add, 1);
+}
 
+// Move a node known to be in the other list before a node known to be in
+// this list (at the end when before is null)
+template <typename T>
+void LinkedList<T>::relink_trusted(ListNode<T> *before, LinkedList<T> &other,
+                                   ListNode<T> *node) {
   if (node == nullptr)
     throw std::invalid_argument("Provided node is null!");
 
-  ListNode<T> *del = node->prev;
+  // the node is already right before before
+  if (&other == this && (before == node || before == node->next))
+    return;
 
-  if (del == nullptr)
-    throw std::invalid_argument("No node exists before the provided node!");
+  if (node->prev != nullptr)
+    node->prev->next = node->next;
+  else
+    other.head = node->next;
 
-  if (del->next != nullptr)
-    del->next->prev = del->prev;
+  if (node->next != nullptr)
+    node->next->prev = node->prev;
+  else
+    other.tail = node->prev;
 
-  if (del->prev != nullptr)
-    del->prev->next = del->next;
+  other.length--;
+  other.reset_cursors();
+  node->prev = node->next = nullptr;
 
-  if (this->head == del)
-    this->head = del->next;
+  this->link_chain(before, node, node, 1);
+}
 
-  --this->length;
-  delete del;
+// Remove a node known to be in the list
+template <typename T> void LinkedList<T>::unlink_trusted(ListNode<T> *node) {
+  if (node == nullptr)
+    throw std::invalid_argument("Provided node is null!");
+
+  this->unlink(node);
 }
 
-// Remove node after provided node
+// Remove first node of the list
+template <typename T> void LinkedList<T>::remove_begin() {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  this->unlink(this->head, 0);
+}
+
+// Remove provided node
+template <typename T> void LinkedList<T>::remove_node(const ListNode<T> *node) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  this->check_handle(node);
+  this->unlink(const_cast<ListNode<T> *>(node));
+}
+
+// Remove node before provided node
 template <typename T>
-void LinkedList<T>::remove_after(const ListNode<T> *node) {
+void LinkedList<T>::remove_before(const ListNode<T> *node) {
   if (this->is_empty())
     throw std::length_error("List is empty!");
 
-  if (node == nullptr)
-    throw std::invalid_argument("Provided node is null!");
+  this->check_handle(node);
 
-  ListNode<T> *del = node->next;
+  if (node->prev == nullptr)
+    throw std::invalid_argument("No node exists before the provided node!");
 
-  if (del == nullptr)
-    throw std::invalid_argument("No node exists after the provided node!");
+  this->unlink(node->prev);
+}
 
-  if (del->next != nullptr)
-    del->next->prev = del->prev;
+// Remove node after provided node
+template <typename T>
+void LinkedList<T>::remove_after(const ListNode<T> *node) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
 
-  if (del->prev != nullptr)
-    del->prev->next = del->next;
+  this->check_handle(node);
 
-  if (this->tail == del)
-    this->tail = del->prev;
+  if (node->next == nullptr)
+    throw std::invalid_argument("No node exists after the provided node!");
 
-  --this->length;
-  delete del;
+  this->unlink(node->next);
 }
 
 // Remove all elements of an value
@@ -447,28 +650,18 @@ template <typename T> void LinkedList<T>::remove_all(const T &element) {
 
   ListNode<T> *temp = this->head;
   bool found = false;
+  int index = 0;
 
   while (temp != nullptr) {
+    ListNode<T> *next = temp->next;
     if (temp->data == element) {
-      ListNode<T> *del = temp;
+      this->unlink(temp, index);
       found = true;
-
-      if (temp->next)
-        temp->next->prev = temp->prev;
-
-      if (temp->prev) {
-        temp->prev->next = temp->next;
-        temp = temp->next;
-      } else {
-        this->head = temp->next;
-        temp = this->head;
-      }
-
-      delete del;
-      --this->length;
     } else {
-      temp = temp->next;
+      index++;
     }
+
+    temp = next;
   }
 
   if (!found)
@@ -481,11 +674,14 @@ template <typename T> void LinkedList<T>::remove_if(std::function<bool(T)> fn) {
     throw std::length_error("List is empty!");
 
   ListNode<T> *temp = this->head;
+  int index = 0;
 
   while (temp != nullptr) {
     ListNode<T> *next = temp->next;
     if (fn(temp->data))
-      this->remove_node(temp);
+      this->unlink(temp, index);
+    else
+      index++;
 
     temp = next;
   }
@@ -511,6 +707,17 @@ bool LinkedList<T>::contains(const ListNode<T> *node) const {
   return false;
 }
 
+// If provided node itself (not its value) is linked in the list
+template <typename T>
+bool LinkedList<T>::owns(const ListNode<T> *node) const {
+  for (ListNode<T> *temp = this->head; temp != nullptr; temp = temp->next) {
+    if (temp == node)
+      return true;
+  }
+
+  return false;
+}
+
 // Equal operator
 template <typename T>
 LinkedList<T> &LinkedList<T>::operator=(const LinkedList<T> &other) {
@@ -577,7 +784,7 @@ ListNode<T> *LinkedList<T>::get_node_by_value(const T &element) const {
   return temp;
 }
 
-// Get node by index
+// Get node by index (walks from the nearest cached position)
 template <typename T>
 ListNode<T> *LinkedList<T>::get_node_by_index(const int index) const {
   if (this->is_empty())
@@ -586,12 +793,7 @@ ListNode<T> *LinkedList<T>::get_node_by_index(const int index) const {
   if (index < 0 || index > this->length - 1)
     throw std::out_of_range("Provided index is out of range!");
 
-  ListNode<T> *temp = this->head;
-  int n = index;
-  while (n-- > 0)
-    temp = temp->next;
-
-  return temp;
+  return this->node_at(index);
 }
 
 // ---------
@@ -611,6 +813,52 @@ template <typename T> void LinkedList<T>::clear() {
   }
 
   this->head = this->tail = nullptr;
+  this->reset_cursors();
+}
+
+// Sort the list (bottom-up merge sort on the next links, then one pass to
+// restore the prev links and the tail)
+template <typename T>
+template <class Compare>
+void LinkedList<T>::sort(Compare comp) {
+  if (this->length < 2)
+    return;
+
+  this->head = merge_sort_chain(this->head, comp);
+
+  ListNode<T> *prev = nullptr;
+  for (ListNode<T> *node = this->head; node != nullptr; node = node->next) {
+    node->prev = prev;
+    prev = node;
+  }
+
+  this->tail = prev;
+  this->reset_cursors();
+}
+
+// Merge another sorted list into this one in O(n + m) (on ties the nodes of
+// this list go first, other is left empty)
+template <typename T>
+template <class Compare>
+void LinkedList<T>::merge(LinkedList<T> &other, Compare comp) {
+  if (this == &other || other.is_empty())
+    return;
+
+  this->head = merge_chains(this->head, other.head, comp);
+  this->length += other.length;
+
+  ListNode<T> *prev = nullptr;
+  for (ListNode<T> *node = this->head; node != nullptr; node = node->next) {
+    node->prev = prev;
+    prev = node;
+  }
+
+  this->tail = prev;
+
+  other.head = other.tail = nullptr;
+  other.length = 0;
+  other.reset_cursors();
+  this->reset_cursors();
 }
 
 // ---------
@@ -0,0 +1,24 @@
+/*
+
+A least recently used (LRU) cache keeps the entries that were used last and
+evicts the one that was not used for the longest time when it is full. It
+is a linked list of entries in order of use plus a hash index from each key
+to its list node: a hit finds the node in the index and relinks it at the
+front of the list (splice, nothing is allocated or copied), a miss that
+fills the cache drops the tail. Every operation is O(1).
+
+The capacity is a number of entries, or a total weight when a weigher gives
+the weight of each entry (e.g. its size in bytes). Hits, misses and
+evictions are counted.
+
+Pros:
+    O(1) get, put and eviction
+    Simple and predictable, adapts at once when the working set changes
+
+Cons:
+    One scan of many keys used once flushes the whole cache
+    Not thread-safe (see ShardedCache)
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,202 @@
+#ifndef LRUCACHE_H
+#define LRUCACHE_H
+
+#include <CacheEntry.h>
+#include <LinkedList.h>
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Least recently used cache: a linked list of entries in order of use (most
+// recent first) and a hash index from keys to their list nodes, so a hit
+// moves its node to the front and an eviction drops the tail in O(1) (the
+// nodes come from the index, so the list trusts them in every build)
+
+template <class K, class V, class Hash = std::hash<K>> class LruCache {
+private:
+  using Entry = CacheEntry<K, V>;
+  using Node = ListNode<Entry>;
+
+  LinkedList<Entry> entries;
+  std::unordered_map<K, Node *, Hash> index;
+  std::size_t capacity;
+  std::size_t weight;
+  CacheWeigher<K, V> weigher;
+  CacheStats stats;
+
+  // helper functions
+  inline std::size_t weigh(const K &key, const V &value) const {
+    return this->weigher ? this->weigher(key, value) : 1;
+  }
+  void touch(Node *node);
+  void evict();
+
+public:
+  // constructors (capacity is a number of entries, or the total weight with
+  // a weigher)
+  explicit LruCache<K, V, Hash>(const std::size_t capacity,
+                                const CacheWeigher<K, V> &weigher = nullptr);
+
+  // the index points into the list, so the cache cannot be copied
+  LruCache<K, V, Hash>(const LruCache<K, V, Hash> &) = delete;
+  LruCache<K, V, Hash> &operator=(const LruCache<K, V, Hash> &) = delete;
+
+  // getters
+  inline int get_length() const { return this->entries.get_length(); }
+  inline std::size_t get_weight() const { return this->weight; }
+  inline std::size_t get_capacity() const { return this->capacity; }
+  inline const CacheStats &get_stats() const { return this->stats; }
+
+  // bool methods (contains does not count as a use)
+  inline bool is_empty() const { return this->entries.is_empty(); }
+  inline bool contains(const K &key) const {
+    return this->index.find(key) != this->index.end();
+  }
+
+  // using the cache (get copies the value on a hit, put returns true for a
+  // new key and evicts the least recently used entries to make room)
+  bool get(const K &key, V &value);
+  bool put(const K &key, const V &value);
+  bool erase(const K &key);
+
+  // changing the capacity evicts what does not fit anymore
+  void set_capacity(const std::size_t capacity);
+
+  // converting methods (most recently used first)
+  const std::vector<std::pair<K, V>> to_vector() const;
+
+  // useful methods
+  inline void reset_stats() { this->stats = CacheStats(); }
+  void clear();
+};
+
+// ---------
+// Constructors
+// ---------
+
+// Empty cache
+template <typename K, typename V, typename Hash>
+LruCache<K, V, Hash>::LruCache(const std::size_t capacity,
+                               const CacheWeigher<K, V> &weigher)
+    : capacity(capacity), weight(0), weigher(weigher) {
+  if (capacity == 0)
+    throw std::invalid_argument("Capacity should be positive!");
+}
+
+// ---------
+// Helpers
+// ---------
+
+// Move a node to the front of the list (relinks it, no allocation)
+template <typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::touch(Node *node) {
+  this->entries.relink_trusted(this->entries.get_head(), this->entries, node);
+}
+
+// Drop least recently used entries until the weight fits the capacity
+template <typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::evict() {
+  while (this->weight > this->capacity) {
+    Node *last = this->entries.get_tail();
+    this->weight -= last->data.weight;
+    this->index.erase(last->data.key);
+    this->entries.unlink_trusted(last);
+    this->stats.evictions++;
+  }
+}
+
+// ---------
+// Methods
+// ---------
+
+// Copy the value of the key into value and mark it as used
+template <typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::get(const K &key, V &value) {
+  auto found = this->index.find(key);
+  if (found == this->index.end()) {
+    this->stats.misses++;
+    return false;
+  }
+
+  this->stats.hits++;
+  this->touch(found->second);
+  value = found->second->data.value;
+  return true;
+}
+
+// Insert or replace the value of the key and mark it as used
+template <typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::put(const K &key, const V &value) {
+  std::size_t weight = this->weigh(key, value);
+  if (weight > this->capacity)
+    throw std::invalid_argument("Entry is heavier than the capacity!");
+
+  auto found = this->index.find(key);
+  bool added = found == this->index.end();
+
+  if (added) {
+    this->entries.push_begin(Entry(key, value, weight));
+    this->index.emplace(key, this->entries.get_head());
+  } else {
+    Node *node = found->second;
+    this->weight -= node->data.weight;
+    node->data.value = value;
+    node->data.weight = weight;
+    this->touch(node);
+  }
+
+  // the entry is at the front, so it is evicted only if it is alone and
+  // then it fits
+  this->weight += weight;
+  this->evict();
+  return added;
+}
+
+// Remove the key, false if it was not cached
+template <typename K, typename V, typename Hash>
+bool LruCache<K, V, Hash>::erase(const K &key) {
+  auto found = this->index.find(key);
+  if (found == this->index.end())
+    return false;
+
+  this->weight -= found->second->data.weight;
+  this->entries.unlink_trusted(found->second);
+  this->index.erase(found);
+  return true;
+}
+
+// Set the capacity, evicting entries when it shrinks
+template <typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::set_capacity(const std::size_t capacity) {
+  if (capacity == 0)
+    throw std::invalid_argument("Capacity should be positive!");
+
+  this->capacity = capacity;
+  this->evict();
+}
+
+// Entries from the most to the least recently used
+template <typename K, typename V, typename Hash>
+const std::vector<std::pair<K, V>> LruCache<K, V, Hash>::to_vector() const {
+  std::vector<std::pair<K, V>> vec;
+  vec.reserve(this->index.size());
+
+  for (const Entry &entry : this->entries)
+    vec.emplace_back(entry.key, entry.value);
+
+  return vec;
+}
+
+// Remove every entry (counters are kept)
+template <typename K, typename V, typename Hash>
+void LruCache<K, V, Hash>::clear() {
+  this->entries.clear();
+  this->index.clear();
+  this->weight = 0;
+}
+
+#endif
@@ -0,0 +1,19 @@
+/*
+
+A min-max stack is a stack that can tell its minimum and maximum element in
+O(1). Next to the elements it keeps two auxiliary monotonic stacks: one
+holds every value that was a new minimum when it was pushed, the other every
+value that was a new maximum. The current min/max is always on top of them,
+and popping an element pops the auxiliary stacks only when the popped value
+was that min/max.
+
+Pros:
+    push/pop/peek/min/max in O(1)
+    Works with any ordering (custom comparator)
+
+Cons:
+    Up to three times the memory of a plain stack in the worst case
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,130 @@
+#ifndef MINMAXSTACK_H
+#define MINMAXSTACK_H
+
+#include <Stack.h>
+
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+// Min-max stack (O(1) min/max with auxiliary monotonic stacks)
+
+template <class T, class Compare = std::less<T>> class MinMaxStack {
+private:
+  Stack<T> stack;
+  Stack<T> mins;
+  Stack<T> maxs;
+  Compare comp;
+
+public:
+  // constructors
+  inline explicit MinMaxStack<T, Compare>(const int capacity = 10,
+                                          Compare comp = Compare())
+      : stack(capacity), mins(capacity), maxs(capacity), comp(comp){};
+  MinMaxStack<T, Compare>(const std::vector<T> &vec, Compare comp = Compare());
+
+  // resize array method
+  void resize(const int &new_capacity);
+
+  // getters
+  inline int get_size() const { return this->stack.get_size(); }
+  inline int get_capacity() const { return this->stack.get_capacity(); }
+  inline const Stack<T> &get_stack() const { return this->stack; }
+
+  // bool methods
+  inline bool is_empty() const { return this->stack.is_empty(); }
+  inline bool is_full() const { return this->stack.is_full(); }
+  inline bool contains(const T &value) const {
+    return this->stack.contains(value);
+  }
+
+  // adding to stack
+  void push(const T &value);
+
+  // deleting from stack
+  T pop();
+
+  // get element methods
+  inline T peek() const { return this->stack.peek(); }
+  inline T bottom() const { return this->stack.bottom(); }
+
+  // min/max find (O(1))
+  T min() const;
+  T max() const;
+
+  // converting methods
+  inline const std::vector<T> to_vector() const {
+    return this->stack.to_vector();
+  }
+  inline const std::string to_string() const {
+    return this->stack.to_string();
+  }
+};
+
+//----------
+// Constructors
+// ----------
+
+// Based on vector constructor
+template <typename T, class Compare>
+MinMaxStack<T, Compare>::MinMaxStack(const std::vector<T> &vec, Compare comp)
+    : MinMaxStack<T, Compare>(vec.empty() ? 1 : vec.size(), comp) {
+  for (const T &element : vec)
+    this->push(element);
+}
+
+// ---------
+// Methods
+// ---------
+
+// Resize all stacks
+template <typename T, class Compare>
+void MinMaxStack<T, Compare>::resize(const int &new_capacity) {
+  this->stack.resize(new_capacity);
+  this->mins.resize(new_capacity);
+  this->maxs.resize(new_capacity);
+}
+
+// Push to the stack (value goes to mins/maxs if it is a new min/max)
+template <typename T, class Compare>
+void MinMaxStack<T, Compare>::push(const T &value) {
+  this->stack.push(value);
+
+  if (this->mins.is_empty() || !this->comp(this->mins.peek(), value))
+    this->mins.push(value);
+
+  if (this->maxs.is_empty() || !this->comp(value, this->maxs.peek()))
+    this->maxs.push(value);
+}
+
+// Pop from the stack
+template <typename T, class Compare> T MinMaxStack<T, Compare>::pop() {
+  T popped = this->stack.pop();
+
+  if (!this->comp(this->mins.peek(), popped))
+    this->mins.pop();
+
+  if (!this->comp(popped, this->maxs.peek()))
+    this->maxs.pop();
+
+  return popped;
+}
+
+// Find min element
+template <typename T, class Compare> T MinMaxStack<T, Compare>::min() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return this->mins.peek();
+}
+
+// Find max element
+template <typename T, class Compare> T MinMaxStack<T, Compare>::max() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return this->maxs.peek();
+}
+
+#endif
@@ -0,0 +1,11 @@
+/*
+
+A monotonic stack keeps its elements ordered from the bottom to the top:
+pushing a value first pops every element that would break the order. Each
+element is pushed and popped at most once, so a whole pass over n elements
+is O(n). This answers "next greater / previous smaller element" style
+questions for every element of an array in a single pass.
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,150 @@
+#ifndef MONOTONICSTACK_H
+#define MONOTONICSTACK_H
+
+#include <DynamicArray.h>
+#include <Stack.h>
+
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+// Monotonic stack (comp(below, above) holds for every pair of neighbours)
+
+template <class T, class Compare = std::less<T>> class MonotonicStack {
+private:
+  Stack<T> stack;
+  Compare comp;
+
+  // batch query helper (index of the nearest element that beats each one)
+  template <int N, class Fn>
+  static DynamicArray<int> nearest(const DynamicArray<T, N> &array,
+                                   const bool forward, Fn beats);
+
+public:
+  // constructors
+  inline explicit MonotonicStack<T, Compare>(const int capacity = 10,
+                                             Compare comp = Compare())
+      : stack(capacity), comp(comp){};
+
+  // getters
+  inline int get_size() const { return this->stack.get_size(); }
+  inline int get_capacity() const { return this->stack.get_capacity(); }
+
+  // bool methods
+  inline bool is_empty() const { return this->stack.is_empty(); }
+
+  // adding to stack (pops every element that breaks the order first)
+  int push(const T &value);
+
+  // deleting from stack
+  inline T pop() { return this->stack.pop(); }
+
+  // get element methods
+  inline T peek() const { return this->stack.peek(); }
+  inline T bottom() const { return this->stack.bottom(); }
+
+  // converting methods
+  inline const std::vector<T> to_vector() const {
+    return this->stack.to_vector();
+  }
+
+  // batch queries over an array (indexes, -1 if there is no such element)
+  template <int N>
+  static DynamicArray<int> next_greater(const DynamicArray<T, N> &array);
+  template <int N>
+  static DynamicArray<int> next_smaller(const DynamicArray<T, N> &array);
+  template <int N>
+  static DynamicArray<int> previous_greater(const DynamicArray<T, N> &array);
+  template <int N>
+  static DynamicArray<int> previous_smaller(const DynamicArray<T, N> &array);
+};
+
+// ---------
+// Methods
+// ---------
+
+// Push to the stack (returns how many elements were popped)
+template <typename T, class Compare>
+int MonotonicStack<T, Compare>::push(const T &value) {
+  int popped = 0;
+  while (!this->stack.is_empty() && !this->comp(this->stack.peek(), value)) {
+    this->stack.pop();
+    popped++;
+  }
+
+  if (this->stack.is_full())
+    this->stack.resize(this->stack.get_capacity() * 2);
+
+  this->stack.push(value);
+  return popped;
+}
+
+//----------
+// Batch queries
+// ----------
+
+// Nearest element that beats each element (one pass, O(n))
+template <typename T, class Compare>
+template <int N, class Fn>
+DynamicArray<int>
+MonotonicStack<T, Compare>::nearest(const DynamicArray<T, N> &array,
+                                    const bool forward, Fn beats) {
+  const int size = array.get_size();
+  const T *data = array.get_array();
+
+  std::vector<int> result(size, -1);
+  Stack<int> indices(size > 0 ? size : 1);
+
+  for (int k = 0; k < size; k++) {
+    int i = forward ? k : size - 1 - k;
+    while (!indices.is_empty() && beats(data[i], data[indices.peek()]))
+      result[indices.pop()] = i;
+
+    indices.push(i);
+  }
+
+  return DynamicArray<int>(result);
+}
+
+// Index of the next greater element
+template <typename T, class Compare>
+template <int N>
+DynamicArray<int>
+MonotonicStack<T, Compare>::next_greater(const DynamicArray<T, N> &array) {
+  Compare comp;
+  return nearest(array, true,
+                 [&comp](const T &a, const T &b) { return comp(b, a); });
+}
+
+// Index of the next smaller element
+template <typename T, class Compare>
+template <int N>
+DynamicArray<int>
+MonotonicStack<T, Compare>::next_smaller(const DynamicArray<T, N> &array) {
+  Compare comp;
+  return nearest(array, true,
+                 [&comp](const T &a, const T &b) { return comp(a, b); });
+}
+
+// Index of the previous greater element
+template <typename T, class Compare>
+template <int N>
+DynamicArray<int>
+MonotonicStack<T, Compare>::previous_greater(const DynamicArray<T, N> &array) {
+  Compare comp;
+  return nearest(array, false,
+                 [&comp](const T &a, const T &b) { return comp(b, a); });
+}
+
+// Index of the previous smaller element
+template <typename T, class Compare>
+template <int N>
+DynamicArray<int>
+MonotonicStack<T, Compare>::previous_smaller(const DynamicArray<T, N> &array) {
+  Compare comp;
+  return nearest(array, false,
+                 [&comp](const T &a, const T &b) { return comp(a, b); });
+}
+
+#endif
@@ -0,0 +1,29 @@
+/*
+
+A pooled linked list is a doubly linked list whose nodes are not allocated
+one by one: they all live in one growable array (the pool) and link to each
+other by 32-bit slot indexes instead of 64-bit pointers. A removed node's
+slot goes on a free list threaded through the free slots themselves and is
+reused by the next insertion.
+
+compact() rewrites the pool in traversal order, so the node at position i
+ends up in slot i. Until the next insertion that is not at the end (or
+removal that is not at the end), traversals are plain array scans and
+access by index is O(1). Because links are indexes, a copy of the pool is a
+complete copy of the list, and for trivially copyable elements it can be
+written to a file as is.
+
+Pros:
+    Half the link memory of a pointer based list and no allocation per node
+    Removed slots are reused, node handles are checked in O(1)
+    Sequential memory after compaction
+
+Cons:
+    At most 2^32 - 2 nodes
+    Growing the pool moves all nodes (slot indexes stay valid, references
+    to elements do not)
+    compact() renumbers every node
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,671 @@
+#ifndef POOLEDLINKEDLIST_H
+#define POOLEDLINKEDLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Pooled linked list node (element with 32-bit links, which are slot indexes
+// in the pool; a free slot keeps the next free slot in next)
+
+template <class T> class PooledNode {
+public:
+  T data;
+  std::uint32_t next;
+  std::uint32_t prev;
+  PooledNode(const T &data, const std::uint32_t next, const std::uint32_t prev)
+      : data(data), next(next), prev(prev){};
+};
+
+template <class T> class PooledLinkedList;
+
+// Pooled List Iterator (bidirectional over slot indexes; end() holds the null
+// index and the list, so --end() is the tail)
+
+template <class T> class PooledListIterator {
+private:
+  using Index = std::uint32_t;
+
+  Index node;
+  PooledLinkedList<T> *list;
+
+public:
+  // iterator traits
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  // constructors
+  inline PooledListIterator<T>()
+      : node(PooledLinkedList<T>::null), list(nullptr){};
+  inline PooledListIterator<T>(const Index node, PooledLinkedList<T> *list)
+      : node(node), list(list){};
+
+  // getters
+  inline Index get_node() const { return this->node; }
+
+  // increment operators
+  inline PooledListIterator<T> &operator++() {
+    if (this->node != PooledLinkedList<T>::null)
+      this->node = this->list->next(this->node);
+
+    return *this;
+  }
+
+  inline PooledListIterator<T> operator++(int) {
+    PooledListIterator<T> temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  // decrement operators
+  inline PooledListIterator<T> &operator--() {
+    if (this->node != PooledLinkedList<T>::null)
+      this->node = this->list->prev(this->node);
+    else if (this->list != nullptr)
+      this->node = this->list->get_tail();
+
+    return *this;
+  }
+
+  inline PooledListIterator<T> operator--(int) {
+    PooledListIterator<T> temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  // get operators
+  inline T &operator*() const {
+    if (this->node == PooledLinkedList<T>::null)
+      throw std::out_of_range("Iterator is out of range");
+
+    return this->list->data(this->node);
+  }
+
+  inline T *operator->() const {
+    if (this->node == PooledLinkedList<T>::null)
+      throw std::out_of_range("Iterator is out of range");
+
+    return &this->list->data(this->node);
+  }
+
+  // equals to
+  inline bool operator==(const PooledListIterator<T> &other) const {
+    return this->node == other.node;
+  }
+
+  // not equals to
+  inline bool operator!=(const PooledListIterator<T> &other) const {
+    return !(*this == other);
+  }
+};
+
+// Pooled linked list (doubly linked list whose nodes live in one growable
+// array and link to each other by 32-bit slot indexes; removed slots go on an
+// intrusive free list and are reused, compact() renumbers the nodes in
+// traversal order)
+
+template <class T> class PooledLinkedList {
+public:
+  using Index = std::uint32_t;
+  static constexpr Index null = UINT32_MAX; // no node
+  static constexpr Index max_nodes = UINT32_MAX - 1;
+
+private:
+  static constexpr Index free_slot = UINT32_MAX - 1; // prev of a free slot
+
+  std::vector<PooledNode<T>> pool;
+  Index head;
+  Index tail;
+  Index length;
+  Index free_list;
+  Index free_count;
+
+  // true while the node at position i is in slot i and there are no free
+  // slots (after compact() and push_end), traversals are then array scans
+  bool sequential;
+
+  // slot helper functions
+  Index allocate(const T &element);
+  void release(const Index node);
+  void link(const Index node, const Index before);
+  void unlink(const Index node);
+  void check_handle(const Index node) const;
+
+public:
+  // constructors
+  inline explicit PooledLinkedList<T>()
+      : head(null), tail(null), length(0), free_list(null), free_count(0),
+        sequential(true){};
+  PooledLinkedList<T>(int size, const T &value);
+  PooledLinkedList<T>(const std::vector<T> &vec);
+  template <typename Iterator>
+  PooledLinkedList<T>(Iterator begin, Iterator end);
+
+  // getters
+  inline Index get_head() const { return this->head; }
+  inline Index get_tail() const { return this->tail; }
+  inline Index get_length() const { return this->length; }
+  inline Index get_capacity() const {
+    return static_cast<Index>(this->pool.size());
+  }
+  inline Index get_free_count() const { return this->free_count; }
+  inline bool is_compact() const { return this->sequential; }
+  Index get_node_by_value(const T &element) const;
+  Index get_node_by_index(const Index index) const;
+
+  // node access by slot index (no checks, like dereferencing a node pointer)
+  inline T &data(const Index node) { return this->pool[node].data; }
+  inline const T &data(const Index node) const {
+    return this->pool[node].data;
+  }
+  inline Index next(const Index node) const { return this->pool[node].next; }
+  inline Index prev(const Index node) const { return this->pool[node].prev; }
+
+  // bool methods
+  inline bool is_empty() const { return this->length == 0; }
+  bool contains(const T &element) const;
+
+  // slot holds a live node (O(1)); slot indexes carry no generation, so a
+  // removed slot reused by a later push is owned again
+  inline bool owns(const Index node) const {
+    return node < this->pool.size() && this->pool[node].prev != free_slot;
+  }
+
+  // adding to the list (returns the slot of the new node)
+  Index push_end(const T &element);
+  Index push_begin(const T &element);
+  Index push_after(const Index node, const T &element);
+  Index push_before(const Index node, const T &element);
+  Index push_index(const Index index, const T &element);
+
+  // removing from the list
+  void remove_end();
+  void remove_begin();
+  void remove_node(const Index node);
+  inline void remove_index(const Index index) {
+    this->remove_node(this->get_node_by_index(index));
+  }
+  inline void remove_value(const T &element) {
+    this->remove_node(this->get_node_by_value(element));
+  }
+  void remove_all(const T &element);
+  void remove_if(std::function<bool(T)> fn);
+
+  // storage methods
+  void reserve(const Index capacity);
+  void compact();
+
+  // converting methods
+  const std::vector<T> to_vector(const bool order = true) const;
+  static inline PooledLinkedList<T> from_vector(const std::vector<T> &vec) {
+    return PooledLinkedList<T>(vec);
+  }
+  const std::string to_string(const bool order = true) const;
+
+  // useful methods
+  void clear();
+  template <class Fn> void for_each(Fn fn) const;
+
+  // iterators (half-open: end() is one past the tail)
+  inline PooledListIterator<T> begin() {
+    return PooledListIterator<T>(this->head, this);
+  }
+  inline PooledListIterator<T> end() {
+    return PooledListIterator<T>(null, this);
+  }
+
+  // compare methods
+  bool operator==(const PooledLinkedList<T> &other) const;
+  bool operator!=(const PooledLinkedList<T> &other) const;
+};
+
+// ---------
+// Constructors
+// ---------
+
+// Fill constructor of a given size
+template <typename T>
+PooledLinkedList<T>::PooledLinkedList(int size, const T &value)
+    : PooledLinkedList<T>() {
+  this->reserve(size > 0 ? static_cast<Index>(size) : 0);
+  while (size-- > 0)
+    this->push_end(value);
+}
+
+// Based on vector constructor
+template <typename T>
+PooledLinkedList<T>::PooledLinkedList(const std::vector<T> &vec)
+    : PooledLinkedList<T>() {
+  this->reserve(static_cast<Index>(vec.size()));
+  for (const T &element : vec)
+    this->push_end(element);
+}
+
+// Based on range iterator constructor
+template <typename T>
+template <typename Iterator>
+PooledLinkedList<T>::PooledLinkedList(Iterator begin, Iterator end)
+    : PooledLinkedList<T>() {
+  for (Iterator it = begin; it != end; ++it)
+    this->push_end(*it);
+}
+
+// ---------
+// Slots
+// ---------
+
+// Take a slot from the free list, or a new one at the end of the pool
+template <typename T>
+typename PooledLinkedList<T>::Index
+PooledLinkedList<T>::allocate(const T &element) {
+  if (this->free_list != null) {
+    Index node = this->free_list;
+    this->free_list = this->pool[node].next;
+    this->free_count--;
+
+    this->pool[node].data = element;
+    return node;
+  }
+
+  if (this->pool.size() >= max_nodes)
+    throw std::length_error("Pool is full!");
+
+  this->pool.push_back(PooledNode<T>(element, null, null));
+  return static_cast<Index>(this->pool.size() - 1);
+}
+
+// Put a slot on the free list (the last slot of a sequential pool is popped
+// instead, an emptied list drops the whole pool)
+template <typename T> void PooledLinkedList<T>::release(const Index node) {
+  if (this->length == 0) {
+    this->pool.clear();
+    this->free_list = null;
+    this->free_count = 0;
+    this->sequential = true;
+    return;
+  }
+
+  if (this->sequential && node == this->pool.size() - 1) {
+    this->pool.pop_back();
+    return;
+  }
+
+  this->pool[node].data = T();
+  this->pool[node].prev = free_slot;
+  this->pool[node].next = this->free_list;
+  this->free_list = node;
+  this->free_count++;
+  this->sequential = false;
+}
+
+// Link a slot before another node (at the end if it is null)
+template <typename T>
+void PooledLinkedList<T>::link(const Index node, const Index before) {
+  Index after = before != null ? this->pool[before].prev : this->tail;
+  this->pool[node].prev = after;
+  this->pool[node].next = before;
+
+  if (after != null)
+    this->pool[after].next = node;
+  else
+    this->head = node;
+
+  if (before != null)
+    this->pool[before].prev = node;
+  else
+    this->tail = node;
+
+  this->length++;
+  this->sequential =
+      this->sequential && node == this->tail && node == this->length - 1;
+}
+
+// Unlink a node (its slot is not released)
+template <typename T> void PooledLinkedList<T>::unlink(const Index node) {
+  Index after = this->pool[node].prev, before = this->pool[node].next;
+
+  if (after != null)
+    this->pool[after].next = before;
+  else
+    this->head = before;
+
+  if (before != null)
+    this->pool[before].prev = after;
+  else
+    this->tail = after;
+
+  this->length--;
+}
+
+// Check that a slot holds a live node (O(1), free slots are marked; a stale
+// index of a reused slot passes, like a dangling pointer would)
+template <typename T>
+void PooledLinkedList<T>::check_handle(const Index node) const {
+  if (!this->owns(node))
+    throw std::invalid_argument("Provided node was not found in the list!");
+}
+
+// ---------
+// Methods
+// ---------
+
+// Push element at the end
+template <typename T>
+typename PooledLinkedList<T>::Index
+PooledLinkedList<T>::push_end(const T &element) {
+  Index node = this->allocate(element);
+  this->link(node, null);
+  return node;
+}
+
+// Push element at the beginning
+template <typename T>
+typename PooledLinkedList<T>::Index
+PooledLinkedList<T>::push_begin(const T &element) {
+  Index node = this->allocate(element);
+  this->link(node, this->head);
+  return node;
+}
+
+// Push element after the node
+template <typename T>
+typename PooledLinkedList<T>::Index
+PooledLinkedList<T>::push_after(const Index node, const T &element) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  this->check_handle(node);
+
+  Index add = this->allocate(element);
+  this->link(add, this->pool[node].next);
+  return add;
+}
+
+// Push element before the node
+template <typename T>
+typename PooledLinkedList<T>::Index
+PooledLinkedList<T>::push_before(const Index node, const T &element) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  this->check_handle(node);
+
+  Index add = this->allocate(element);
+  this->link(add, node);
+  return add;
+}
+
+// Push element at given position (index in [0, length])
+template <typename T>
+typename PooledLinkedList<T>::Index
+PooledLinkedList<T>::push_index(const Index index, const T &element) {
+  if (index > this->length)
+    throw std::out_of_range("Provided index is out of range!");
+
+  Index before = index == this->length ? null : this->get_node_by_index(index);
+  Index add = this->allocate(element);
+  this->link(add, before);
+  return add;
+}
+
+// Remove the last node
+template <typename T> void PooledLinkedList<T>::remove_end() {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  this->remove_node(this->tail);
+}
+
+// Remove the first node
+template <typename T> void PooledLinkedList<T>::remove_begin() {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  this->remove_node(this->head);
+}
+
+// Remove the node
+template <typename T> void PooledLinkedList<T>::remove_node(const Index node) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  this->check_handle(node);
+
+  this->unlink(node);
+  this->release(node);
+}
+
+// Remove all occurences of a value
+template <typename T> void PooledLinkedList<T>::remove_all(const T &element) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  if (!this->contains(element))
+    throw std::invalid_argument("Node with provided value was not found!");
+
+  this->remove_if([&element](const T &value) { return value == element; });
+}
+
+// Remove by predicate
+template <typename T>
+void PooledLinkedList<T>::remove_if(std::function<bool(T)> fn) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  Index node = this->head;
+  while (node != null) {
+    Index next = this->pool[node].next;
+    if (fn(this->pool[node].data)) {
+      this->unlink(node);
+      this->release(node);
+    }
+
+    node = next;
+  }
+}
+
+// Get the first node with a value
+template <typename T>
+typename PooledLinkedList<T>::Index
+PooledLinkedList<T>::get_node_by_value(const T &element) const {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  Index node = this->head;
+  while (node != null && this->pool[node].data != element)
+    node = this->pool[node].next;
+
+  if (node == null)
+    throw std::invalid_argument("Node by provided value was not found!");
+
+  return node;
+}
+
+// Get node by index (O(1) when compact, otherwise walks from the nearer end)
+template <typename T>
+typename PooledLinkedList<T>::Index
+PooledLinkedList<T>::get_node_by_index(const Index index) const {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  if (index >= this->length)
+    throw std::out_of_range("Provided index is out of range!");
+
+  if (this->sequential)
+    return index;
+
+  Index node;
+  if (index < this->length / 2) {
+    node = this->head;
+    for (Index i = 0; i < index; i++)
+      node = this->pool[node].next;
+  } else {
+    node = this->tail;
+    for (Index i = this->length - 1; i > index; i--)
+      node = this->pool[node].prev;
+  }
+
+  return node;
+}
+
+// If the value is in the list (stops at the first match, a scan of the pool
+// when compact)
+template <typename T>
+bool PooledLinkedList<T>::contains(const T &element) const {
+  if (this->sequential) {
+    for (const PooledNode<T> &node : this->pool) {
+      if (node.data == element)
+        return true;
+    }
+
+    return false;
+  }
+
+  for (Index node = this->head; node != null; node = this->pool[node].next) {
+    if (this->pool[node].data == element)
+      return true;
+  }
+
+  return false;
+}
+
+// ---------
+// Storage
+// ---------
+
+// Reserve slots (no reallocation until the pool grows past them)
+template <typename T> void PooledLinkedList<T>::reserve(const Index capacity) {
+  this->pool.reserve(capacity);
+}
+
+// Rewrite the pool in traversal order (node at position i goes to slot i),
+// drops the free slots and the spare capacity; every slot index changes
+template <typename T> void PooledLinkedList<T>::compact() {
+  if (this->sequential && this->pool.capacity() == this->pool.size())
+    return;
+
+  std::vector<PooledNode<T>> packed;
+  packed.reserve(this->length);
+
+  Index position = 0;
+  for (Index node = this->head; node != null;
+       node = this->pool[node].next, position++) {
+    packed.push_back(PooledNode<T>(
+        std::move(this->pool[node].data),
+        position + 1 == this->length ? null : position + 1,
+        position == 0 ? null : position - 1));
+  }
+
+  this->pool.swap(packed);
+  this->head = this->length == 0 ? null : 0;
+  this->tail = this->length == 0 ? null : this->length - 1;
+  this->free_list = null;
+  this->free_count = 0;
+  this->sequential = true;
+}
+
+// ---------
+// Converting
+// ---------
+
+// Visit every element from the head to the tail (a scan of the pool when
+// compact)
+template <typename T>
+template <class Fn>
+void PooledLinkedList<T>::for_each(Fn fn) const {
+  if (this->sequential) {
+    for (const PooledNode<T> &node : this->pool)
+      fn(node.data);
+
+    return;
+  }
+
+  for (Index node = this->head; node != null; node = this->pool[node].next)
+    fn(this->pool[node].data);
+}
+
+// To vector
+template <typename T>
+const std::vector<T> PooledLinkedList<T>::to_vector(const bool order) const {
+  std::vector<T> vec;
+  vec.reserve(this->length);
+
+  if (order) {
+    this->for_each([&vec](const T &element) { vec.push_back(element); });
+  } else {
+    for (Index node = this->tail; node != null; node = this->pool[node].prev)
+      vec.push_back(this->pool[node].data);
+  }
+
+  return vec;
+}
+
+// To string
+template <typename T>
+const std::string PooledLinkedList<T>::to_string(const bool order) const {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  std::stringstream ss;
+  Index node = order ? this->head : this->tail;
+
+  while (node != null) {
+    ss << this->pool[node].data;
+    node = order ? this->pool[node].next : this->pool[node].prev;
+    if (node != null)
+      ss << " <-> ";
+  }
+
+  return ss.str();
+}
+
+// ---------
+// Useful methods
+// ---------
+
+// Clear the list (the pool keeps its capacity)
+template <typename T> void PooledLinkedList<T>::clear() {
+  this->pool.clear();
+  this->head = this->tail = this->free_list = null;
+  this->length = this->free_count = 0;
+  this->sequential = true;
+}
+
+// ---------
+// Compare
+// ---------
+
+// Equal to (same elements in the same order, slots do not matter)
+template <typename T>
+bool PooledLinkedList<T>::operator==(const PooledLinkedList<T> &other) const {
+  if (this->length != other.length)
+    return false;
+
+  Index a = this->head, b = other.head;
+  while (a != null) {
+    if (this->pool[a].data != other.pool[b].data)
+      return false;
+
+    a = this->pool[a].next;
+    b = other.pool[b].next;
+  }
+
+  return true;
+}
+
+// Not equal to
+template <typename T>
+bool PooledLinkedList<T>::operator!=(const PooledLinkedList<T> &other) const {
+  return !(*this == other);
+}
+
+#endif
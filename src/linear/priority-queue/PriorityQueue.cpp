@@ -0,0 +1,21 @@
+/*
+
+A priority queue always gives back its highest priority element first. This
+one is a d-ary heap stored in one contiguous array: the children of the
+element at index i are at i * d + 1 ... i * d + d. A binary heap (d = 2) does
+the fewest comparisons per level, while 4-ary and 8-ary heaps are shallower
+and read all children of a node from one or two cache lines.
+
+Pros:
+    Top element in O(1)
+    Push/Pop in O(log n)
+    Building from n elements (heapify) in O(n)
+    Contiguous memory, no allocation per element
+
+Cons:
+    Searching for an arbitrary element is O(n)
+    Elements are not sorted, only the top one is known
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,319 @@
+#ifndef PRIORITYQUEUE_H
+#define PRIORITYQUEUE_H
+
+#include <DynamicArray.h>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Priority queue (d-ary heap, the top is the greatest element by Compare;
+// pass std::greater<T> for a min-heap)
+
+template <class T, class Compare = std::less<T>, int Arity = 2>
+class PriorityQueue {
+  static_assert(Arity >= 2, "Arity should be >= 2!");
+
+private:
+  T *heap;
+  int size;
+  int capacity;
+  Compare comp;
+
+  // heap helper functions
+  void sift_up(int index);
+  void sift_down(int index);
+  void heapify();
+
+public:
+  // constructors
+  inline explicit PriorityQueue<T, Compare, Arity>(
+      const int capacity = 10, const Compare &comp = Compare())
+      : size(0), capacity(capacity), comp(comp) {
+    if (capacity < 0)
+      throw std::invalid_argument("Capacity should not be < 0!");
+
+    this->heap = new T[capacity];
+  };
+  PriorityQueue<T, Compare, Arity>(const std::vector<T> &vec,
+                                   const Compare &comp = Compare());
+  template <int N>
+  PriorityQueue<T, Compare, Arity>(const DynamicArray<T, N> &array,
+                                   const Compare &comp = Compare());
+  PriorityQueue<T, Compare, Arity>(
+      const PriorityQueue<T, Compare, Arity> &other);
+
+  // destructor
+  inline ~PriorityQueue<T, Compare, Arity>() {
+    delete[] this->heap;
+    this->heap = nullptr;
+  };
+
+  // equal operator
+  PriorityQueue<T, Compare, Arity> &
+  operator=(const PriorityQueue<T, Compare, Arity> &other);
+
+  // resize array method
+  void reserve(const int &new_capacity);
+
+  // getters
+  inline int get_size() const { return this->size; }
+  inline int get_capacity() const { return this->capacity; }
+  static constexpr int get_arity() { return Arity; }
+
+  // bool methods
+  inline bool is_empty() const { return this->size == 0; }
+
+  // adding to the queue
+  void push(const T &value);
+  template <class It> void push_range(It first, It last); // any input range
+  inline void push_range(const std::vector<T> &vec) {
+    this->push_range(vec.begin(), vec.end());
+  }
+
+  // removing from the queue
+  T pop();
+  T pop_push(const T &value);
+  inline void clear() { this->size = 0; }
+
+  // get element methods
+  T top() const;
+
+  // converting methods
+  inline const std::vector<T> to_vector() const {
+    return std::vector<T>(this->heap, this->heap + this->size);
+  }
+  const std::vector<T> to_sorted_vector() const;
+};
+
+//----------
+// Constructors
+// ----------
+
+// Based on vector constructor (heapify, O(n))
+template <typename T, typename Compare, int Arity>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(const std::vector<T> &vec,
+                                                const Compare &comp)
+    : PriorityQueue<T, Compare, Arity>(vec.size(), comp) {
+  std::copy(vec.begin(), vec.end(), this->heap);
+  this->size = vec.size();
+  this->heapify();
+}
+
+// Based on dynamic array constructor (heapify, O(n))
+template <typename T, typename Compare, int Arity>
+template <int N>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(const DynamicArray<T, N> &array,
+                                                const Compare &comp)
+    : PriorityQueue<T, Compare, Arity>(array.get_size(), comp) {
+  std::copy(array.get_array(), array.get_array() + array.get_size(),
+            this->heap);
+  this->size = array.get_size();
+  this->heapify();
+}
+
+// Copy constructor (deep copy)
+template <typename T, typename Compare, int Arity>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(
+    const PriorityQueue<T, Compare, Arity> &other)
+    : size(other.size), capacity(other.capacity), comp(other.comp) {
+  this->heap = new T[other.capacity];
+  std::copy(other.heap, other.heap + other.size, this->heap);
+}
+
+// Equal operator
+template <typename T, typename Compare, int Arity>
+PriorityQueue<T, Compare, Arity> &PriorityQueue<T, Compare, Arity>::operator=(
+    const PriorityQueue<T, Compare, Arity> &other) {
+  if (this == &other)
+    return *this;
+
+  T *new_heap = new T[other.capacity];
+  std::copy(other.heap, other.heap + other.size, new_heap);
+
+  delete[] this->heap;
+  this->heap = new_heap;
+  this->size = other.size;
+  this->capacity = other.capacity;
+  this->comp = other.comp;
+
+  return *this;
+}
+
+// ---------
+// Heap helpers
+// ---------
+
+// Move the element up while it beats its parent (one move per level)
+template <typename T, typename Compare, int Arity>
+void PriorityQueue<T, Compare, Arity>::sift_up(int index) {
+  T value = std::move(this->heap[index]);
+
+  while (index > 0) {
+    int parent = (index - 1) / Arity;
+    if (!this->comp(this->heap[parent], value))
+      break;
+
+    this->heap[index] = std::move(this->heap[parent]);
+    index = parent;
+  }
+
+  this->heap[index] = std::move(value);
+}
+
+// Move the element down while one of its children beats it
+template <typename T, typename Compare, int Arity>
+void PriorityQueue<T, Compare, Arity>::sift_down(int index) {
+  T value = std::move(this->heap[index]);
+
+  while (true) {
+    int first = index * Arity + 1;
+    if (first >= this->size)
+      break;
+
+    int last = std::min(first + Arity, this->size);
+    int best = first;
+    for (int child = first + 1; child < last; child++) {
+      if (this->comp(this->heap[best], this->heap[child]))
+        best = child;
+    }
+
+    if (!this->comp(value, this->heap[best]))
+      break;
+
+    this->heap[index] = std::move(this->heap[best]);
+    index = best;
+  }
+
+  this->heap[index] = std::move(value);
+}
+
+// Build the heap bottom-up (O(n))
+template <typename T, typename Compare, int Arity>
+void PriorityQueue<T, Compare, Arity>::heapify() {
+  if (this->size < 2)
+    return;
+
+  for (int i = (this->size - 2) / Arity; i >= 0; i--)
+    this->sift_down(i);
+}
+
+// ---------
+// Methods
+// ---------
+
+// Resize array
+template <typename T, typename Compare, int Arity>
+void PriorityQueue<T, Compare, Arity>::reserve(const int &new_capacity) {
+  if (new_capacity <= this->capacity)
+    return;
+
+  T *new_heap = new T[new_capacity];
+  std::move(this->heap, this->heap + this->size, new_heap);
+
+  delete[] this->heap;
+  this->heap = new_heap;
+  this->capacity = new_capacity;
+}
+
+// Push to the queue
+template <typename T, typename Compare, int Arity>
+void PriorityQueue<T, Compare, Arity>::push(const T &value) {
+  if (this->size == this->capacity)
+    this->reserve(std::max(1, this->capacity * 2));
+
+  this->heap[this->size] = value;
+  this->sift_up(this->size++);
+}
+
+// Push many elements (re-heapify when the batch is at least as big as the
+// heap, sift up one by one otherwise); a single-pass range is buffered
+// first, it is counted and then copied
+template <typename T, typename Compare, int Arity>
+template <class It>
+void PriorityQueue<T, Compare, Arity>::push_range(It first, It last) {
+  if constexpr (!std::is_base_of<
+                    std::forward_iterator_tag,
+                    typename std::iterator_traits<It>::iterator_category>::
+                    value) {
+    std::vector<T> buffer(first, last);
+    this->push_range(buffer.begin(), buffer.end());
+  } else {
+    int count = std::distance(first, last);
+    if (count <= 0)
+      return;
+
+    if (this->size + count > this->capacity)
+      this->reserve(std::max(this->size + count, this->capacity * 2));
+
+    if (count >= this->size) {
+      std::copy(first, last, this->heap + this->size);
+      this->size += count;
+      this->heapify();
+      return;
+    }
+
+    for (It it = first; it != last; ++it) {
+      this->heap[this->size] = *it;
+      this->sift_up(this->size++);
+    }
+  }
+}
+
+// Pop the top element
+template <typename T, typename Compare, int Arity>
+T PriorityQueue<T, Compare, Arity>::pop() {
+  if (this->is_empty())
+    throw std::length_error("Priority queue is empty!");
+
+  T popped = std::move(this->heap[0]);
+  if (--this->size > 0) {
+    this->heap[0] = std::move(this->heap[this->size]);
+    this->sift_down(0);
+  }
+
+  return popped;
+}
+
+// Pop the top element and push a new one (one sift instead of two)
+template <typename T, typename Compare, int Arity>
+T PriorityQueue<T, Compare, Arity>::pop_push(const T &value) {
+  if (this->is_empty())
+    throw std::length_error("Priority queue is empty!");
+
+  T popped = std::move(this->heap[0]);
+  this->heap[0] = value;
+  this->sift_down(0);
+
+  return popped;
+}
+
+// Get the top element
+template <typename T, typename Compare, int Arity>
+T PriorityQueue<T, Compare, Arity>::top() const {
+  if (this->is_empty())
+    throw std::length_error("Priority queue is empty!");
+
+  return this->heap[0];
+}
+
+// To vector in pop order (pops a copy, O(n log n))
+template <typename T, typename Compare, int Arity>
+const std::vector<T>
+PriorityQueue<T, Compare, Arity>::to_sorted_vector() const {
+  PriorityQueue<T, Compare, Arity> copy(*this);
+
+  std::vector<T> sorted;
+  sorted.reserve(this->size);
+  while (!copy.is_empty())
+    sorted.push_back(copy.pop());
+
+  return sorted;
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
+#include <MatchMask.h>
+#include <ListSort.h>
 #include <QueueIterator.h>
 
 #include <functional>
@@ -18,7 +20,8 @@ public:
   QueueNode(const T &data) : data(data), next(nullptr) {}
 };
 
-// Queue on linked list
+// Queue on linked list (const at() and get_index() move the cached finger,
+// so even const access to one queue needs external locking across threads)
 
 template <class T> class Queue {
 private:
@@ -26,6 +29,11 @@ private:
   QueueNode<T> *tail;
   int length;
 
+  // last node reached by position and its index (null when unknown), walks
+  // start from it when the target is not before it
+  mutable QueueNode<T> *finger = nullptr;
+  mutable int finger_index = 0;
+
 public:
   // constructors
   inline explicit Queue<T>() : head(nullptr), tail(nullptr), length(0){};
@@ -72,6 +80,15 @@ public:
   std::vector<QueueIterator<T>> find_all(const T &element) const;
   std::vector<QueueIterator<T>> find_if(std::function<bool(T)> fn) const;
 
+  // compact find (indexes, bitmap of matches, visitor without results)
+  std::vector<int> find_all_indices(const T &element) const;
+  template <class Fn> std::vector<int> find_if_indices(Fn fn) const;
+  MatchMask match_mask(const T &element) const;
+  template <class Fn> MatchMask match_mask_if(Fn fn) const;
+  template <class Fn> void for_each_match(const T &element, Fn fn) const;
+  template <class Fn, class Visit>
+  void for_each_match_if(Fn fn, Visit visit) const;
+
   // replace
   void replace(const T &element, const T &replace);
   void replace(const QueueIterator<T> qit, const T &replace);
@@ -97,6 +114,12 @@ public:
   Queue<T> reversed() const;
   void remove_duplicates();
 
+  // sorting by relinking nodes (stable, no allocation; merge expects both
+  // queues sorted by comp and moves every node of other into this queue)
+  template <class Compare = std::less<T>> void sort(Compare comp = Compare());
+  template <class Compare = std::less<T>>
+  void merge(Queue<T> &other, Compare comp = Compare());
+
   // min/max find
   QueueNode<T> *max() const;
   QueueNode<T> *max(std::function<int(T)> fn) const;
@@ -105,9 +128,9 @@ public:
   QueueNode<T> *min(std::function<int(T)> fn) const;
   QueueNode<T> *min_if(std::function<bool(T)> fn) const;
 
-  // iterators
+  // iterators (half-open: end() is one past the tail)
   inline QueueIterator<T> begin() const { return QueueIterator<T>(this->head); }
-  inline QueueIterator<T> end() const { return QueueIterator<T>(this->tail); }
+  inline QueueIterator<T> end() const { return QueueIterator<T>(nullptr); }
 
   // compare methods
   bool operator>(const Queue<T> &other) const;
@@ -176,6 +199,7 @@ template <typename T> void Queue<T>::enqueue(const T &element) {
 // Insert element at given iterator
 template <typename T>
 void Queue<T>::insert(const QueueIterator<T> qit, const T &element) {
+  this->finger = nullptr;
   QueueNode<T> *target = qit.get_node();
   ++this->length;
 
@@ -201,6 +225,9 @@ void Queue<T>::insert(const QueueIterator<T> qit, const T &element) {
     QueueNode<T> *add = new QueueNode<T>(element);
     prev->next = add;
     add->next = target;
+
+    if (target == nullptr)
+      this->tail = add;
   }
 }
 
@@ -210,6 +237,7 @@ void Queue<T>::insert(const QueueIterator<T> qit, const std::vector<T> &vec) {
   if (vec.empty())
     throw std::invalid_argument("Empty vector cannot be inserted!");
 
+  this->finger = nullptr;
   QueueNode<T> *target = qit.get_node();
 
   if (!this->head || this->head == target) {
@@ -244,6 +272,8 @@ void Queue<T>::insert(const QueueIterator<T> qit, const std::vector<T> &vec) {
     }
 
     prev->next = target;
+    if (target == nullptr)
+      this->tail = prev;
   }
 }
 
@@ -256,6 +286,14 @@ template <typename T> T Queue<T>::dequeue() {
   T element = this->head->data;
   this->head = temp->next;
 
+  if (this->finger == temp)
+    this->finger = nullptr;
+  else
+    this->finger_index--;
+
+  if (!this->head)
+    this->tail = nullptr;
+
   delete temp;
   --this->length;
 
@@ -267,6 +305,8 @@ template <typename T> void Queue<T>::erase(const T &element) {
   if (this->is_empty())
     throw std::length_error("Queue is empty!");
 
+  this->finger = nullptr;
+
   if (!this->contains(element))
     throw std::invalid_argument("Element was not found!");
 
@@ -284,6 +324,7 @@ template <typename T> void Queue<T>::erase(const T &element) {
 
     delete temp->next;
     temp->next = nullptr;
+    this->tail = temp;
 
     return;
   }
@@ -304,7 +345,12 @@ template <typename T> void Queue<T>::erase(const QueueIterator<T> qit) {
   if (this->is_empty())
     throw std::length_error("Queue is empty!");
 
+  this->finger = nullptr;
+
   QueueNode<T> *target = qit.get_node();
+  if (target == nullptr)
+    throw std::out_of_range("Cannot erase the end() iterator!");
+
   --this->length;
 
   if (this->head == target) {
@@ -337,40 +383,67 @@ template <typename T> void Queue<T>::erase_all(const T &element) {
   if (this->is_empty())
     throw std::length_error("Queue is empty!");
 
+  this->finger = nullptr;
+
   if (!this->contains(element))
     throw std::invalid_argument("Element was not found!");
 
-  while (this->head && this->head->data == element)
-    this->head = this->head->next;
-
   QueueNode<T> *temp1 = this->head, *temp2 = nullptr;
 
   while (temp1 != nullptr) {
+    QueueNode<T> *next = temp1->next;
     if (temp1->data == element) {
-      temp2->next = temp1->next;
+      if (temp2 == nullptr)
+        this->head = next;
+      else
+        temp2->next = next;
+
+      delete temp1;
       --this->length;
     } else
       temp2 = temp1;
 
-    temp1 = temp1->next;
+    temp1 = next;
   }
+
+  this->tail = temp2;
 }
 
-// Get index of a node (first occurence)
+// Get index of a node (length if it is not in the queue)
 template <typename T> int Queue<T>::get_index(const QueueNode<T> *node) const {
   if (this->is_empty())
     throw std::length_error("Queue is empty!");
 
+  // search from the finger to the tail first, then from the head to it
   int index = 0;
   QueueNode<T> *temp = this->head;
-  while (temp != nullptr) {
-    if (temp == node)
-      break;
+  if (this->finger != nullptr) {
+    index = this->finger_index;
+    temp = this->finger;
+  }
 
+  while (temp != nullptr && temp != node) {
     temp = temp->next;
     index++;
   }
 
+  if (temp == nullptr && this->finger != nullptr) {
+    index = 0;
+    temp = this->head;
+    while (temp != this->finger && temp != node) {
+      temp = temp->next;
+      index++;
+    }
+
+    if (temp != node)
+      return this->length;
+  }
+
+  if (temp != nullptr) {
+    this->finger = temp;
+    this->finger_index = index;
+  }
+
   return index;
 }
 
@@ -392,7 +465,7 @@ template <typename T> int Queue<T>::get_index(const T &element) const {
   return index;
 }
 
-// Get node by index
+// Get node by index (walks from the finger when it is not past the index)
 template <typename T> QueueNode<T> *Queue<T>::at(const int &index) const {
   if (this->is_empty())
     throw std::length_error("Queue is empty!");
@@ -400,13 +473,19 @@ template <typename T> QueueNode<T> *Queue<T>::at(const int &index) const {
   if (index < 0 || index > this->get_length() - 1)
     throw std::out_of_range("Provided index is out of range!");
 
-  int idx = index;
+  int idx = 0;
   QueueNode<T> *temp = this->head;
-  while (idx > 0) {
-    temp = temp->next;
-    --idx;
+  if (this->finger != nullptr && this->finger_index <= index) {
+    idx = this->finger_index;
+    temp = this->finger;
   }
 
+  for (; idx < index; ++idx)
+    temp = temp->next;
+
+  this->finger = temp;
+  this->finger_index = index;
+
   return temp;
 }
 
@@ -444,9 +523,9 @@ template <typename T> QueueIterator<T> Queue<T>::find(const T &element) const {
   if (this->is_empty())
     throw std::length_error("Queue is empty!");
 
-  for (QueueIterator<T> qit = begin(); qit != end().get_node()->next; ++qit) {
+  for (QueueIterator<T> qit = begin(); qit != end(); ++qit) {
     if (*qit == element)
-      return QueueIterator<T>(qit, true);
+      return qit;
   }
 
   return end();
@@ -459,7 +538,7 @@ std::vector<QueueIterator<T>> Queue<T>::find_all(const T &element) const {
     throw std::length_error("Queue is empty!");
 
   std::vector<QueueIterator<T>> iterators;
-  for (QueueIterator<T> qit = begin(); qit != end().get_node()->next; ++qit) {
+  for (QueueIterator<T> qit = begin(); qit != end(); ++qit) {
     if (*qit == element)
       iterators.push_back(qit);
   }
@@ -475,7 +554,7 @@ Queue<T>::find_if(std::function<bool(T)> fn) const {
     throw std::length_error("Queue is empty!");
 
   std::vector<QueueIterator<T>> iterators;
-  for (QueueIterator<T> qit = begin(); qit != end().get_node()->next; ++qit) {
+  for (QueueIterator<T> qit = begin(); qit != end(); ++qit) {
     if (fn(*qit))
       iterators.push_back(qit);
   }
@@ -483,6 +562,78 @@ Queue<T>::find_if(std::function<bool(T)> fn) const {
   return iterators;
 }
 
+//----------
+// Compact find
+// ----------
+
+// Indexes of all occurrences
+template <typename T>
+std::vector<int> Queue<T>::find_all_indices(const T &element) const {
+  std::vector<int> indices;
+  this->for_each_match(element, [&indices](const int index, const T &) {
+    indices.push_back(index);
+  });
+
+  return indices;
+}
+
+// Indexes of all elements that satisfy the predicate
+template <typename T>
+template <class Fn>
+std::vector<int> Queue<T>::find_if_indices(Fn fn) const {
+  std::vector<int> indices;
+  this->for_each_match_if(fn, [&indices](const int index, const T &) {
+    indices.push_back(index);
+  });
+
+  return indices;
+}
+
+// Bitmap of all occurrences
+template <typename T>
+MatchMask Queue<T>::match_mask(const T &element) const {
+  MatchMask mask(this->length);
+  this->for_each_match(
+      element, [&mask](const int index, const T &) { mask.set(index); });
+
+  return mask;
+}
+
+// Bitmap of all elements that satisfy the predicate
+template <typename T>
+template <class Fn>
+MatchMask Queue<T>::match_mask_if(Fn fn) const {
+  MatchMask mask(this->length);
+  this->for_each_match_if(
+      fn, [&mask](const int index, const T &) { mask.set(index); });
+
+  return mask;
+}
+
+// Visit (index, value) of every occurrence
+template <typename T>
+template <class Fn>
+void Queue<T>::for_each_match(const T &element, Fn fn) const {
+  this->for_each_match_if([&element](const T &x) { return x == element; },
+                          fn);
+}
+
+// Visit (index, value) of every element that satisfies the predicate
+template <typename T>
+template <class Fn, class Visit>
+void Queue<T>::for_each_match_if(Fn fn, Visit visit) const {
+  if (this->is_empty())
+    throw std::length_error("Queue is empty!");
+
+  int index = 0;
+  for (QueueNode<T> *temp = this->head; temp != nullptr; temp = temp->next) {
+    if (fn(temp->data))
+      visit(index, temp->data);
+
+    index++;
+  }
+}
+
 // Replace first occurrence of a given element
 template <typename T>
 void Queue<T>::replace(const T &element, const T &replace) {
@@ -521,7 +672,7 @@ void Queue<T>::replace_if(std::function<bool(T)> fn, const T &replace) {
     *qit = replace;
 }
 
-// Replace all elements in a ragne
+// Replace all elements in the range [qit1, qit2)
 template <typename T>
 void Queue<T>::replace_range(const QueueIterator<T> qit1,
                              const QueueIterator<T> qit2, const T &replace) {
@@ -536,8 +687,6 @@ void Queue<T>::replace_range(const QueueIterator<T> qit1,
 
   for (QueueIterator<T> qit = qit1; qit != qit2; ++qit)
     *qit = replace;
-
-  *qit2 = replace;
 }
 
 // To vector
@@ -582,6 +731,7 @@ template <typename T> void Queue<T>::clear() {
     this->dequeue();
 
   this->tail = nullptr;
+  this->finger = nullptr;
 }
 
 // Swapping two queues
@@ -591,6 +741,42 @@ template <typename T> void Queue<T>::swap(Queue<T> &a, Queue<T> &b) {
   b = temp;
 }
 
+// Sort the queue (bottom-up merge sort on the links, then one pass to find
+// the tail)
+template <typename T>
+template <class Compare>
+void Queue<T>::sort(Compare comp) {
+  if (this->length < 2)
+    return;
+
+  this->finger = nullptr;
+  this->head = merge_sort_chain(this->head, comp);
+
+  this->tail = this->head;
+  while (this->tail->next != nullptr)
+    this->tail = this->tail->next;
+}
+
+// Merge another sorted queue into this one in O(n + m) (on ties the nodes of
+// this queue go first, other is left empty)
+template <typename T>
+template <class Compare>
+void Queue<T>::merge(Queue<T> &other, Compare comp) {
+  if (this == &other || other.is_empty())
+    return;
+
+  // the last node overall is the last of the queue that runs out later
+  if (this->is_empty() || !comp(other.tail->data, this->tail->data))
+    this->tail = other.tail;
+
+  this->finger = other.finger = nullptr;
+  this->head = merge_chains(this->head, other.head, comp);
+  this->length += other.length;
+
+  other.head = other.tail = nullptr;
+  other.length = 0;
+}
+
 // Count element in the queue
 template <typename T> int Queue<T>::count(const T &element) const {
   int count = 0;
@@ -642,6 +828,8 @@ template <typename T> void Queue<T>::reverse() {
   if (this->is_empty())
     throw std::length_error("Queue is empty!");
 
+  this->finger = nullptr;
+
   QueueNode<T> *temp = nullptr, *prev = nullptr, *current = this->head;
 
   while (current != nullptr) {
@@ -651,6 +839,7 @@ template <typename T> void Queue<T>::reverse() {
     current = temp;
   }
 
+  this->tail = this->head;
   this->head = prev;
 }
 
@@ -683,6 +872,8 @@ template <typename T> void Queue<T>::remove_duplicates() {
   if (this->is_empty())
     throw std::length_error("Queue is empty!");
 
+  this->finger = nullptr;
+
   QueueNode<T> *temp1 = this->head, *temp2, *duplicate;
 
   while (temp1 != nullptr && temp1->next != nullptr) {
@@ -693,10 +884,13 @@ template <typename T> void Queue<T>::remove_duplicates() {
         duplicate = temp2->next;
         temp2->next = temp2->next->next;
         delete duplicate;
+        --this->length;
       } else
         temp2 = temp2->next;
     }
 
+    // temp2 stopped at the last node
+    this->tail = temp2;
     temp1 = temp1->next;
   }
 }
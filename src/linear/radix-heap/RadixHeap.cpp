@@ -0,0 +1,21 @@
+/*
+
+A radix heap is a monotone priority queue for unsigned integer keys: a key
+can be pushed only if it is not less than the last popped key. Keys are put
+into buckets by the highest bit in which they differ from the last popped
+key, so a push is O(1). A pop empties the first non-empty bucket into lower
+ones, and every key moves down at most once per bit, so a pop is amortized
+O(log C), where C is the largest key. That fits Dijkstra's algorithm with
+integer weights and event schedulers with integer timestamps.
+
+Pros:
+    Push in O(1)
+    Pop in O(log C) amortized, no key comparisons on push
+
+Cons:
+    Only unsigned integer keys
+    Keys should never go below the last popped key
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,150 @@
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Radix heap (monotone min-heap for unsigned integer keys: a pushed key
+// should not be less than the last popped key)
+
+template <class Key, class Value> class RadixHeap {
+  static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value,
+                "Key should be an unsigned integer type!");
+
+private:
+  static constexpr int bits = std::numeric_limits<Key>::digits;
+
+  // bucket i > 0 holds keys whose highest bit differing from last is i - 1
+  std::vector<std::pair<Key, Value>> buckets[bits + 1];
+  Key last;
+  int size;
+
+  // bucket helper functions
+  static inline int bit_width(std::uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return x == 0 ? 0 : 64 - __builtin_clzll(x);
+#else
+    int width = 0;
+    for (; x != 0; x >>= 1)
+      width++;
+
+    return width;
+#endif
+  }
+  inline int bucket_of(const Key &key) const {
+    return bit_width(static_cast<std::uint64_t>(key ^ this->last));
+  }
+  void pull();
+
+public:
+  // constructors
+  inline RadixHeap<Key, Value>() : last(0), size(0){};
+
+  // getters
+  inline int get_size() const { return this->size; }
+  inline Key get_last_key() const { return this->last; }
+
+  // bool methods
+  inline bool is_empty() const { return this->size == 0; }
+
+  // adding to the heap
+  void push(const Key &key, const Value &value);
+
+  // removing from the heap
+  std::pair<Key, Value> pop();
+  void clear();
+
+  // get element methods (does not move the last popped key)
+  std::pair<Key, Value> top() const;
+};
+
+// ---------
+// Methods
+// ---------
+
+// Move the smallest keys into bucket 0 (each key only moves to a lower
+// bucket, so this is amortized O(log C) per key)
+template <typename Key, typename Value> void RadixHeap<Key, Value>::pull() {
+  if (!this->buckets[0].empty())
+    return;
+
+  int i = 1;
+  while (this->buckets[i].empty())
+    i++;
+
+  Key min = this->buckets[i][0].first;
+  for (const std::pair<Key, Value> &item : this->buckets[i]) {
+    if (item.first < min)
+      min = item.first;
+  }
+
+  this->last = min;
+  for (std::pair<Key, Value> &item : this->buckets[i])
+    this->buckets[this->bucket_of(item.first)].push_back(std::move(item));
+
+  this->buckets[i].clear();
+}
+
+// Push a key with its value
+template <typename Key, typename Value>
+void RadixHeap<Key, Value>::push(const Key &key, const Value &value) {
+  if (key < this->last)
+    throw std::invalid_argument(
+        "Key should not be less than the last popped key!");
+
+  this->buckets[this->bucket_of(key)].emplace_back(key, value);
+  this->size++;
+}
+
+// Pop the smallest key
+template <typename Key, typename Value>
+std::pair<Key, Value> RadixHeap<Key, Value>::pop() {
+  if (this->is_empty())
+    throw std::length_error("Radix heap is empty!");
+
+  this->pull();
+
+  std::pair<Key, Value> popped = std::move(this->buckets[0].back());
+  this->buckets[0].pop_back();
+  this->size--;
+
+  return popped;
+}
+
+// Get the smallest key (keys of a lower bucket are all smaller, so only the
+// first non-empty bucket is scanned and nothing is redistributed)
+template <typename Key, typename Value>
+std::pair<Key, Value> RadixHeap<Key, Value>::top() const {
+  if (this->is_empty())
+    throw std::length_error("Radix heap is empty!");
+
+  if (!this->buckets[0].empty())
+    return this->buckets[0].back();
+
+  int i = 1;
+  while (this->buckets[i].empty())
+    i++;
+
+  const std::pair<Key, Value> *min = &this->buckets[i][0];
+  for (const std::pair<Key, Value> &item : this->buckets[i]) {
+    if (item.first < min->first)
+      min = &item;
+  }
+
+  return *min;
+}
+
+// Clear the heap (keeps the last popped key)
+template <typename Key, typename Value> void RadixHeap<Key, Value>::clear() {
+  for (std::vector<std::pair<Key, Value>> &bucket : this->buckets)
+    bucket.clear();
+
+  this->size = 0;
+}
+
+#endif
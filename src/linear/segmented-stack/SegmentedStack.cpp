@@ -0,0 +1,20 @@
+/*
+
+A segmented stack stores its elements in fixed-size chunks linked together
+instead of one contiguous array. When the top chunk is full a new chunk is
+linked on top, so the stack never has to reallocate and copy everything it
+holds. One emptied chunk is kept as a spare, so pushing and popping across
+a chunk boundary does not allocate and free memory over and over.
+
+Pros:
+    push/pop/peek in O(1) worst case (no big reallocation)
+    Element addresses stay valid while the element is on the stack
+    No capacity limit
+
+Cons:
+    Access by index costs O(n / chunk size)
+    Elements are not contiguous in memory
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,436 @@
+#ifndef SEGMENTEDSTACK_H
+#define SEGMENTEDSTACK_H
+
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// Segmented stack chunk class (fixed-size block of elements)
+
+template <class T> class StackChunk {
+public:
+  T *data;
+  StackChunk<T> *prev;
+  StackChunk<T> *next;
+  explicit StackChunk(const int &capacity)
+      : data(new T[capacity]), prev(nullptr), next(nullptr) {}
+  ~StackChunk() { delete[] data; }
+};
+
+// Segmented stack (linked fixed-size chunks, no reallocation)
+
+template <class T, int ChunkSize = 1024> class SegmentedStack {
+  static_assert(ChunkSize > 0, "Chunk size must be > 0!");
+
+private:
+  StackChunk<T> *first;
+  StackChunk<T> *last;
+  StackChunk<T> *spare;
+  int top_count;
+  int size;
+  int chunks;
+
+  // chunk helper functions
+  void add_chunk();
+  void drop_chunk();
+
+public:
+  // constructors
+  inline explicit SegmentedStack<T, ChunkSize>()
+      : first(nullptr), last(nullptr), spare(nullptr), top_count(0), size(0),
+        chunks(0){};
+  SegmentedStack<T, ChunkSize>(const int &size, const T &value);
+  SegmentedStack<T, ChunkSize>(const std::vector<T> &vec);
+  template <typename Iterator>
+  SegmentedStack<T, ChunkSize>(Iterator begin, Iterator end);
+  SegmentedStack<T, ChunkSize>(const SegmentedStack<T, ChunkSize> &other);
+
+  // destructor
+  inline ~SegmentedStack<T, ChunkSize>() {
+    this->clear();
+    delete this->spare;
+    this->spare = nullptr;
+  };
+
+  // equal operator
+  SegmentedStack<T, ChunkSize> &
+  operator=(const SegmentedStack<T, ChunkSize> &other);
+
+  // getters
+  inline int get_size() const { return this->size; }
+  inline int get_chunk_count() const { return this->chunks; }
+  inline int get_chunk_size() const { return ChunkSize; }
+  inline bool has_spare() const { return this->spare != nullptr; }
+
+  // bool methods
+  inline bool is_empty() const { return this->size == 0; }
+  bool contains(const T &value) const;
+
+  // adding to stack (returns the stored element, its address is stable)
+  T &push(const T &value);
+
+  // deleting from stack
+  T pop();
+  void clear();
+
+  // get element methods
+  T peek() const;
+  T &top();
+  T bottom() const;
+  T at(const int &index) const;
+  inline T operator[](const int &index) const { return this->at(index); }
+
+  // converting methods
+  const std::vector<T> to_vector() const;
+  const std::string to_string() const;
+
+  // useful methods
+  int count(const T &element) const;
+  int count_if(std::function<bool(T)> fn) const;
+  template <class Fn> void for_each(Fn fn) const;
+
+  // min/max find
+  T max() const;
+  T min() const;
+
+  // compare methods
+  bool operator==(const SegmentedStack<T, ChunkSize> &other) const;
+  bool operator!=(const SegmentedStack<T, ChunkSize> &other) const;
+};
+
+//----------
+// Constructors
+// ----------
+
+// Fill constructor
+template <typename T, int ChunkSize>
+SegmentedStack<T, ChunkSize>::SegmentedStack(const int &size, const T &value)
+    : SegmentedStack<T, ChunkSize>() {
+  for (int i = 0; i < size; i++)
+    this->push(value);
+}
+
+// Based on vector constructor
+template <typename T, int ChunkSize>
+SegmentedStack<T, ChunkSize>::SegmentedStack(const std::vector<T> &vec)
+    : SegmentedStack<T, ChunkSize>() {
+  for (const T &element : vec)
+    this->push(element);
+}
+
+// Based on range iterator constructor
+template <typename T, int ChunkSize>
+template <typename Iterator>
+SegmentedStack<T, ChunkSize>::SegmentedStack(Iterator begin, Iterator end)
+    : SegmentedStack<T, ChunkSize>() {
+  for (Iterator it = begin; it != end; ++it)
+    this->push(*it);
+}
+
+// Copy constructor (deep copy)
+template <typename T, int ChunkSize>
+SegmentedStack<T, ChunkSize>::SegmentedStack(
+    const SegmentedStack<T, ChunkSize> &other)
+    : SegmentedStack<T, ChunkSize>() {
+  other.for_each([this](const T &element) { this->push(element); });
+}
+
+// Equal operator
+template <typename T, int ChunkSize>
+SegmentedStack<T, ChunkSize> &
+SegmentedStack<T, ChunkSize>::operator=(
+    const SegmentedStack<T, ChunkSize> &other) {
+  if (this == &other)
+    return *this;
+
+  this->clear();
+  other.for_each([this](const T &element) { this->push(element); });
+
+  return *this;
+}
+
+// ---------
+// Chunks
+// ---------
+
+// Link a chunk on top (reuses the spare chunk if there is one)
+template <typename T, int ChunkSize>
+void SegmentedStack<T, ChunkSize>::add_chunk() {
+  StackChunk<T> *chunk = this->spare;
+  if (chunk != nullptr)
+    this->spare = nullptr;
+  else
+    chunk = new StackChunk<T>(ChunkSize);
+
+  chunk->prev = this->last;
+  chunk->next = nullptr;
+
+  if (this->last != nullptr)
+    this->last->next = chunk;
+  else
+    this->first = chunk;
+
+  this->last = chunk;
+  this->top_count = 0;
+  this->chunks++;
+}
+
+// Unlink the empty top chunk (keeps it as the spare chunk)
+template <typename T, int ChunkSize>
+void SegmentedStack<T, ChunkSize>::drop_chunk() {
+  StackChunk<T> *chunk = this->last;
+  this->last = chunk->prev;
+
+  if (this->last != nullptr)
+    this->last->next = nullptr;
+  else
+    this->first = nullptr;
+
+  delete this->spare;
+  this->spare = chunk;
+
+  this->top_count = this->last != nullptr ? ChunkSize : 0;
+  this->chunks--;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Push to the stack
+template <typename T, int ChunkSize>
+T &SegmentedStack<T, ChunkSize>::push(const T &value) {
+  if (this->last == nullptr || this->top_count == ChunkSize)
+    this->add_chunk();
+
+  T &slot = this->last->data[this->top_count++];
+  slot = value;
+  this->size++;
+
+  return slot;
+}
+
+// Pop from the stack
+template <typename T, int ChunkSize> T SegmentedStack<T, ChunkSize>::pop() {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  T popped = this->last->data[--this->top_count];
+  this->size--;
+
+  if (this->top_count == 0)
+    this->drop_chunk();
+
+  return popped;
+}
+
+// Clear the stack (the spare chunk is kept)
+template <typename T, int ChunkSize>
+void SegmentedStack<T, ChunkSize>::clear() {
+  while (this->last != nullptr) {
+    StackChunk<T> *prev = this->last->prev;
+    delete this->last;
+    this->last = prev;
+  }
+
+  this->first = nullptr;
+  this->top_count = this->size = this->chunks = 0;
+}
+
+// Get top element from the stack
+template <typename T, int ChunkSize>
+T SegmentedStack<T, ChunkSize>::peek() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return this->last->data[this->top_count - 1];
+}
+
+// Get reference to the top element
+template <typename T, int ChunkSize> T &SegmentedStack<T, ChunkSize>::top() {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return this->last->data[this->top_count - 1];
+}
+
+// Get bottom element from the stack
+template <typename T, int ChunkSize>
+T SegmentedStack<T, ChunkSize>::bottom() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return this->first->data[0];
+}
+
+// Get by index (from the bottom)
+template <typename T, int ChunkSize>
+T SegmentedStack<T, ChunkSize>::at(const int &index) const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  if (index < 0 || index >= this->size)
+    throw std::out_of_range("Provided index is out of range!");
+
+  StackChunk<T> *chunk = this->first;
+  for (int i = 0; i < index / ChunkSize; i++)
+    chunk = chunk->next;
+
+  return chunk->data[index % ChunkSize];
+}
+
+// Contains in stack
+template <typename T, int ChunkSize>
+bool SegmentedStack<T, ChunkSize>::contains(const T &value) const {
+  for (StackChunk<T> *chunk = this->first; chunk != nullptr;
+       chunk = chunk->next) {
+    int n = chunk == this->last ? this->top_count : ChunkSize;
+    for (int i = 0; i < n; i++) {
+      if (chunk->data[i] == value)
+        return true;
+    }
+  }
+
+  return false;
+}
+
+// Visit every element from the bottom to the top
+template <typename T, int ChunkSize>
+template <class Fn>
+void SegmentedStack<T, ChunkSize>::for_each(Fn fn) const {
+  for (StackChunk<T> *chunk = this->first; chunk != nullptr;
+       chunk = chunk->next) {
+    int n = chunk == this->last ? this->top_count : ChunkSize;
+    for (int i = 0; i < n; i++)
+      fn(chunk->data[i]);
+  }
+}
+
+// To vector (from the bottom to the top)
+template <typename T, int ChunkSize>
+const std::vector<T> SegmentedStack<T, ChunkSize>::to_vector() const {
+  std::vector<T> vec;
+  vec.reserve(this->size);
+  this->for_each([&vec](const T &element) { vec.push_back(element); });
+
+  return vec;
+}
+
+// To string (from the top to the bottom)
+template <typename T, int ChunkSize>
+const std::string SegmentedStack<T, ChunkSize>::to_string() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  std::stringstream ss;
+  int left = this->size;
+  for (StackChunk<T> *chunk = this->last; chunk != nullptr;
+       chunk = chunk->prev) {
+    int n = chunk == this->last ? this->top_count : ChunkSize;
+    for (int i = n - 1; i >= 0; i--) {
+      ss << chunk->data[i] << std::endl;
+      if (--left != 0)
+        ss << "---" << std::endl;
+    }
+  }
+
+  return ss.str();
+}
+
+//----------
+// Useful functions
+// ----------
+
+// Count element
+template <typename T, int ChunkSize>
+int SegmentedStack<T, ChunkSize>::count(const T &element) const {
+  int count = 0;
+  this->for_each([&](const T &value) {
+    if (value == element)
+      count++;
+  });
+
+  return count;
+}
+
+// Count element by predicate
+template <typename T, int ChunkSize>
+int SegmentedStack<T, ChunkSize>::count_if(std::function<bool(T)> fn) const {
+  int count = 0;
+  this->for_each([&](const T &value) {
+    if (fn(value))
+      count++;
+  });
+
+  return count;
+}
+
+//----------
+// Min/max
+// ----------
+
+// Find max element
+template <typename T, int ChunkSize>
+T SegmentedStack<T, ChunkSize>::max() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  T max = this->first->data[0];
+  this->for_each([&max](const T &value) {
+    if (max < value)
+      max = value;
+  });
+
+  return max;
+}
+
+// Find min element
+template <typename T, int ChunkSize>
+T SegmentedStack<T, ChunkSize>::min() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  T min = this->first->data[0];
+  this->for_each([&min](const T &value) {
+    if (min > value)
+      min = value;
+  });
+
+  return min;
+}
+
+// ---------
+// Compare
+// ---------
+
+// Equal to
+template <typename T, int ChunkSize>
+bool SegmentedStack<T, ChunkSize>::operator==(
+    const SegmentedStack<T, ChunkSize> &other) const {
+  if (this->size != other.size)
+    return false;
+
+  StackChunk<T> *a = this->first, *b = other.first;
+  for (int i = 0; i < this->size; i++) {
+    if (i != 0 && i % ChunkSize == 0) {
+      a = a->next;
+      b = b->next;
+    }
+
+    if (a->data[i % ChunkSize] != b->data[i % ChunkSize])
+      return false;
+  }
+
+  return true;
+}
+
+// Not equal to
+template <typename T, int ChunkSize>
+bool SegmentedStack<T, ChunkSize>::operator!=(
+    const SegmentedStack<T, ChunkSize> &other) const {
+  return !(*this == other);
+}
+
+#endif
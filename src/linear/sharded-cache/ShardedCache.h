@@ -0,0 +1,205 @@
+#ifndef SHARDEDCACHE_H
+#define SHARDEDCACHE_H
+
+#include <CacheEntry.h>
+#include <LruCache.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+// Sharded cache for many threads: keys are spread by hash over independent
+// caches (LruCache or LfuCache), each behind its own mutex, so threads only
+// wait for each other when their keys land on the same shard. A shard only
+// holds its part of the capacity, so with a weigher an entry heavier than
+// capacity / shards is rejected by put even if the whole cache has room.
+
+template <class K, class V, class Hash = std::hash<K>,
+          class Cache = LruCache<K, V, Hash>>
+class ShardedCache {
+private:
+  // own cache line, so locking one shard does not slow down its neighbours
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    Cache cache;
+    Shard(const std::size_t capacity, const CacheWeigher<K, V> &weigher)
+        : cache(capacity, weigher){};
+  };
+
+  std::vector<std::unique_ptr<Shard>> shards;
+  std::size_t mask;
+  Hash hash;
+
+  // helper functions (the hash is mixed, std::hash of integers is identity)
+  inline Shard &shard_of(const K &key) const {
+    std::uint64_t h = static_cast<std::uint64_t>(this->hash(key));
+    return *this->shards[((h * 0x9E3779B97F4A7C15ull) >> 32) & this->mask];
+  }
+
+public:
+  // constructors (the capacity is split between the shards, the first ones
+  // take the remainder; the shard count has to be a power of two)
+  explicit ShardedCache<K, V, Hash, Cache>(
+      const std::size_t capacity, const int shards = 16,
+      const CacheWeigher<K, V> &weigher = nullptr);
+
+  // getters (sums over the shards, exact only while no thread uses the
+  // cache)
+  inline int get_shards() const {
+    return static_cast<int>(this->shards.size());
+  }
+  std::size_t get_capacity() const;
+  int get_length() const;
+  std::size_t get_weight() const;
+  CacheStats get_stats() const;
+
+  // bool methods (contains does not count as a use)
+  inline bool is_empty() const { return this->get_length() == 0; }
+  bool contains(const K &key) const;
+
+  // using the cache (same as the shard cache, under the shard lock: put
+  // throws if the entry is heavier than the capacity of its shard)
+  bool get(const K &key, V &value);
+  bool put(const K &key, const V &value);
+  bool erase(const K &key);
+
+  // useful methods
+  void reset_stats();
+  void clear();
+};
+
+// ---------
+// Constructors
+// ---------
+
+// One empty cache per shard
+template <typename K, typename V, typename Hash, typename Cache>
+ShardedCache<K, V, Hash, Cache>::ShardedCache(
+    const std::size_t capacity, const int shards,
+    const CacheWeigher<K, V> &weigher)
+    : mask(static_cast<std::size_t>(shards) - 1) {
+  if (shards <= 0 || (shards & (shards - 1)) != 0)
+    throw std::invalid_argument("Shard count should be a power of two!");
+
+  if (capacity < static_cast<std::size_t>(shards))
+    throw std::invalid_argument("Capacity should be at least one per shard!");
+
+  std::size_t share = capacity / shards, remainder = capacity % shards;
+  this->shards.reserve(shards);
+  for (int i = 0; i < shards; i++)
+    this->shards.emplace_back(
+        new Shard(share + (static_cast<std::size_t>(i) < remainder ? 1 : 0),
+                  weigher));
+}
+
+// ---------
+// Getters
+// ---------
+
+// Capacity of every shard
+template <typename K, typename V, typename Hash, typename Cache>
+std::size_t ShardedCache<K, V, Hash, Cache>::get_capacity() const {
+  std::size_t capacity = 0;
+  for (const std::unique_ptr<Shard> &shard : this->shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    capacity += shard->cache.get_capacity();
+  }
+
+  return capacity;
+}
+
+// Entries in every shard
+template <typename K, typename V, typename Hash, typename Cache>
+int ShardedCache<K, V, Hash, Cache>::get_length() const {
+  int length = 0;
+  for (const std::unique_ptr<Shard> &shard : this->shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    length += shard->cache.get_length();
+  }
+
+  return length;
+}
+
+// Weight of every shard
+template <typename K, typename V, typename Hash, typename Cache>
+std::size_t ShardedCache<K, V, Hash, Cache>::get_weight() const {
+  std::size_t weight = 0;
+  for (const std::unique_ptr<Shard> &shard : this->shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    weight += shard->cache.get_weight();
+  }
+
+  return weight;
+}
+
+// Counters of every shard added up
+template <typename K, typename V, typename Hash, typename Cache>
+CacheStats ShardedCache<K, V, Hash, Cache>::get_stats() const {
+  CacheStats stats;
+  for (const std::unique_ptr<Shard> &shard : this->shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    stats += shard->cache.get_stats();
+  }
+
+  return stats;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Check if the key is cached
+template <typename K, typename V, typename Hash, typename Cache>
+bool ShardedCache<K, V, Hash, Cache>::contains(const K &key) const {
+  Shard &shard = this->shard_of(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.cache.contains(key);
+}
+
+// Copy the value of the key into value and mark it as used
+template <typename K, typename V, typename Hash, typename Cache>
+bool ShardedCache<K, V, Hash, Cache>::get(const K &key, V &value) {
+  Shard &shard = this->shard_of(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.cache.get(key, value);
+}
+
+// Insert or replace the value of the key (evicts inside its shard only)
+template <typename K, typename V, typename Hash, typename Cache>
+bool ShardedCache<K, V, Hash, Cache>::put(const K &key, const V &value) {
+  Shard &shard = this->shard_of(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.cache.put(key, value);
+}
+
+// Remove the key, false if it was not cached
+template <typename K, typename V, typename Hash, typename Cache>
+bool ShardedCache<K, V, Hash, Cache>::erase(const K &key) {
+  Shard &shard = this->shard_of(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.cache.erase(key);
+}
+
+// Reset the counters of every shard
+template <typename K, typename V, typename Hash, typename Cache>
+void ShardedCache<K, V, Hash, Cache>::reset_stats() {
+  for (const std::unique_ptr<Shard> &shard : this->shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    shard->cache.reset_stats();
+  }
+}
+
+// Remove every entry of every shard
+template <typename K, typename V, typename Hash, typename Cache>
+void ShardedCache<K, V, Hash, Cache>::clear() {
+  for (const std::unique_ptr<Shard> &shard : this->shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    shard->cache.clear();
+  }
+}
+
+#endif
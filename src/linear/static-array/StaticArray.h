@@ -0,0 +1,340 @@
+#ifndef STATICARRAY_H
+#define STATICARRAY_H
+
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// Static array (fixed capacity, in-object storage, constexpr)
+
+template <class T, int N> class StaticArray {
+  static_assert(N > 0, "Capacity of a static array must be > 0!");
+
+private:
+  T array[N] = {};
+  int size = 0;
+
+public:
+  // constructors
+  constexpr StaticArray<T, N>() = default;
+  constexpr StaticArray<T, N>(const int &size, const T &value);
+  constexpr StaticArray<T, N>(std::initializer_list<T> list);
+
+  // getters
+  constexpr const T *get_array() const { return this->array; }
+  constexpr int get_size() const { return this->size; }
+  constexpr int get_capacity() const { return N; }
+
+  // bool methods
+  constexpr bool is_empty() const { return this->size == 0; }
+  constexpr bool is_full() const { return this->size >= N; }
+  constexpr bool contains(const T &value) const {
+    return this->find(value) != -1;
+  }
+
+  // get element
+  constexpr const T &at(const int &index) const;
+  constexpr T &at(const int &index);
+  constexpr const T &operator[](const int &index) const {
+    return this->at(index);
+  }
+  constexpr T &operator[](const int &index) { return this->at(index); }
+
+  // adding to the array
+  constexpr void push_back(const T &value);
+  constexpr void push_begin(const T &value);
+  constexpr void insert(const int &index, const T &value);
+
+  // removing from the array
+  constexpr void erase_back();
+  constexpr void erase_begin();
+
+  // find (index of the first occurrence, -1 if not found)
+  constexpr int find(const T &element) const;
+
+  // converting methods
+  const std::vector<T> to_vector() const {
+    return std::vector<T>(this->array, this->array + this->size);
+  }
+  const std::string to_string() const;
+
+  // useful functions
+  constexpr int count(const T &element) const;
+  template <class Fn> constexpr int count_if(Fn fn) const;
+  template <class Fn> constexpr T reduce(T init, Fn fn) const;
+  constexpr void reverse();
+
+  // min/max find
+  constexpr T max() const;
+  constexpr T min() const;
+
+  // sorting (insertion sort, usable in constant expressions)
+  template <class Compare = std::less<T>>
+  constexpr void sort(Compare comp = Compare());
+
+  // compare methods
+  constexpr bool operator==(const StaticArray<T, N> &other) const;
+  constexpr bool operator!=(const StaticArray<T, N> &other) const {
+    return !(*this == other);
+  }
+};
+
+//----------
+// Constructors
+// ----------
+
+// Fill constructor
+template <typename T, int N>
+constexpr StaticArray<T, N>::StaticArray(const int &size, const T &value) {
+  if (size < 0 || size > N)
+    throw std::out_of_range("Size is out of capacity range!");
+
+  for (int i = 0; i < size; i++)
+    this->array[i] = value;
+
+  this->size = size;
+}
+
+// Initializer list constructor
+template <typename T, int N>
+constexpr StaticArray<T, N>::StaticArray(std::initializer_list<T> list) {
+  if (static_cast<int>(list.size()) > N)
+    throw std::out_of_range("Size is out of capacity range!");
+
+  for (const T &element : list)
+    this->array[this->size++] = element;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Get element by index
+template <typename T, int N>
+constexpr const T &StaticArray<T, N>::at(const int &index) const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  if (index < 0 || index >= this->size)
+    throw std::out_of_range("Provided index is out of range!");
+
+  return this->array[index];
+}
+
+template <typename T, int N>
+constexpr T &StaticArray<T, N>::at(const int &index) {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  if (index < 0 || index >= this->size)
+    throw std::out_of_range("Provided index is out of range!");
+
+  return this->array[index];
+}
+
+// Push back
+template <typename T, int N>
+constexpr void StaticArray<T, N>::push_back(const T &value) {
+  if (this->is_full())
+    throw std::length_error("Array is full!");
+
+  this->array[this->size++] = value;
+}
+
+// Push begin
+template <typename T, int N>
+constexpr void StaticArray<T, N>::push_begin(const T &value) {
+  this->insert(0, value);
+}
+
+// Insert at given index
+template <typename T, int N>
+constexpr void StaticArray<T, N>::insert(const int &index, const T &value) {
+  if (this->is_full())
+    throw std::length_error("Array is full!");
+
+  if (index < 0 || index > this->size)
+    throw std::out_of_range("Provided index is out of range!");
+
+  for (int i = this->size; i > index; i--)
+    this->array[i] = this->array[i - 1];
+
+  this->array[index] = value;
+  ++this->size;
+}
+
+// Erase from back
+template <typename T, int N> constexpr void StaticArray<T, N>::erase_back() {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  this->size--;
+}
+
+// Erase from begin
+template <typename T, int N> constexpr void StaticArray<T, N>::erase_begin() {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  for (int i = 0; i < this->size - 1; i++)
+    this->array[i] = this->array[i + 1];
+
+  this->size--;
+}
+
+// Find element
+template <typename T, int N>
+constexpr int StaticArray<T, N>::find(const T &element) const {
+  for (int i = 0; i < this->size; i++) {
+    if (this->array[i] == element)
+      return i;
+  }
+
+  return -1;
+}
+
+// To string
+template <typename T, int N>
+const std::string StaticArray<T, N>::to_string() const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  std::stringstream ss;
+  for (int i = 0; i < this->size; i++) {
+    if (i != 0)
+      ss << ", ";
+
+    ss << this->array[i];
+  }
+
+  ss << ".";
+  return ss.str();
+}
+
+//----------
+// Useful functions
+// ----------
+
+// Count element
+template <typename T, int N>
+constexpr int StaticArray<T, N>::count(const T &element) const {
+  int count = 0;
+  for (int i = 0; i < this->size; i++) {
+    if (this->array[i] == element)
+      count++;
+  }
+
+  return count;
+}
+
+// Count element by predicate
+template <typename T, int N>
+template <class Fn>
+constexpr int StaticArray<T, N>::count_if(Fn fn) const {
+  int count = 0;
+  for (int i = 0; i < this->size; i++) {
+    if (fn(this->array[i]))
+      count++;
+  }
+
+  return count;
+}
+
+// Reduce
+template <typename T, int N>
+template <class Fn>
+constexpr T StaticArray<T, N>::reduce(T init, Fn fn) const {
+  for (int i = 0; i < this->size; i++)
+    init = fn(init, this->array[i]);
+
+  return init;
+}
+
+// Reverse array
+template <typename T, int N> constexpr void StaticArray<T, N>::reverse() {
+  int i = 0, j = this->size - 1;
+  while (i < j) {
+    T temp = this->array[i];
+    this->array[i] = this->array[j];
+    this->array[j] = temp;
+    i++;
+    j--;
+  }
+}
+
+//----------
+// Min/max
+// ----------
+
+// Find max element
+template <typename T, int N> constexpr T StaticArray<T, N>::max() const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  T max = this->array[0];
+  for (int i = 1; i < this->size; i++) {
+    if (max < this->array[i])
+      max = this->array[i];
+  }
+
+  return max;
+}
+
+// Find min element
+template <typename T, int N> constexpr T StaticArray<T, N>::min() const {
+  if (this->is_empty())
+    throw std::length_error("Array is empty, try to add elements!");
+
+  T min = this->array[0];
+  for (int i = 1; i < this->size; i++) {
+    if (min > this->array[i])
+      min = this->array[i];
+  }
+
+  return min;
+}
+
+//----------
+// Sorting
+// ----------
+
+// Insertion sort
+template <typename T, int N>
+template <class Compare>
+constexpr void StaticArray<T, N>::sort(Compare comp) {
+  for (int i = 1; i < this->size; i++) {
+    T key = this->array[i];
+    int j = i - 1;
+
+    while (j >= 0 && comp(key, this->array[j])) {
+      this->array[j + 1] = this->array[j];
+      j--;
+    }
+
+    this->array[j + 1] = key;
+  }
+}
+
+// ---------
+// Compare
+// ---------
+
+// Equal to
+template <typename T, int N>
+constexpr bool
+StaticArray<T, N>::operator==(const StaticArray<T, N> &other) const {
+  if (this->size != other.size)
+    return false;
+
+  for (int i = 0; i < this->size; i++) {
+    if (this->array[i] != other.array[i])
+      return false;
+  }
+
+  return true;
+}
+
+#endif
@@ -0,0 +1,11 @@
+/*
+
+A static stack is a LIFO stack with a fixed capacity known at compile time.
+The elements are stored inside the object itself, so pushing and popping
+never allocates memory, and the stack can be used in constant expressions.
+It fits bounded work stacks (e.g. iterative tree traversal with a known
+maximum depth).
+
+*/
+
+int main() { return 0; }
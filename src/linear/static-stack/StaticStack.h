@@ -0,0 +1,284 @@
+#ifndef STATICSTACK_H
+#define STATICSTACK_H
+
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// Static stack (fixed capacity, in-object storage, constexpr)
+
+template <class T, int N> class StaticStack {
+  static_assert(N > 0, "Capacity of a static stack must be > 0!");
+
+private:
+  T stack[N] = {};
+  int top = -1;
+
+public:
+  // constructors
+  constexpr StaticStack<T, N>() = default;
+  constexpr StaticStack<T, N>(const int &size, const T &value);
+  constexpr StaticStack<T, N>(std::initializer_list<T> list);
+
+  // getters
+  constexpr const T *get_stack() const { return this->stack; }
+  constexpr int get_top() const { return this->top; }
+  constexpr int get_capacity() const { return N; }
+  constexpr int get_size() const { return (this->top + 1); }
+
+  // bool methods
+  constexpr bool is_empty() const { return this->top < 0; }
+  constexpr bool is_full() const { return this->top >= (N - 1); }
+  constexpr bool contains(const T &value) const {
+    return this->find(value) != -1;
+  }
+
+  // adding to stack
+  constexpr void push(const T &value);
+
+  // deleting from stack
+  constexpr T pop();
+
+  // get element methods
+  constexpr T peek() const;
+  constexpr T bottom() const;
+  constexpr T at(const int &index) const;
+  constexpr T operator[](const int &index) const { return this->at(index); }
+
+  // find (index from the bottom, -1 if not found)
+  constexpr int find(const T &element) const;
+
+  // converting methods
+  const std::vector<T> to_vector() const {
+    return std::vector<T>(this->stack, this->stack + this->get_size());
+  }
+  const std::string to_string() const;
+
+  // useful methods
+  constexpr int count(const T &element) const;
+  template <class Fn> constexpr int count_if(Fn fn) const;
+
+  // min/max find
+  constexpr T max() const;
+  constexpr T min() const;
+
+  // sorting from bottom to top (insertion sort)
+  template <class Compare = std::less<T>>
+  constexpr void sort(Compare comp = Compare());
+
+  // compare methods
+  constexpr bool operator==(const StaticStack<T, N> &other) const;
+  constexpr bool operator!=(const StaticStack<T, N> &other) const {
+    return !(*this == other);
+  }
+};
+
+//----------
+// Constructors
+// ----------
+
+// Fill constructor
+template <typename T, int N>
+constexpr StaticStack<T, N>::StaticStack(const int &size, const T &value) {
+  if (size < 0 || size > N)
+    throw std::overflow_error("Stack overflow!");
+
+  for (int i = 0; i < size; i++)
+    this->stack[i] = value;
+
+  this->top = size - 1;
+}
+
+// Initializer list constructor (last element ends up on top)
+template <typename T, int N>
+constexpr StaticStack<T, N>::StaticStack(std::initializer_list<T> list) {
+  if (static_cast<int>(list.size()) > N)
+    throw std::overflow_error("Stack overflow!");
+
+  for (const T &element : list)
+    this->stack[++this->top] = element;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Push to the stack
+template <typename T, int N>
+constexpr void StaticStack<T, N>::push(const T &value) {
+  if (this->is_full())
+    throw std::overflow_error("Stack overflow!");
+
+  this->stack[++this->top] = value;
+}
+
+// Pop from the stack
+template <typename T, int N> constexpr T StaticStack<T, N>::pop() {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return this->stack[this->top--];
+}
+
+// Get top element from the stack
+template <typename T, int N> constexpr T StaticStack<T, N>::peek() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return this->stack[this->top];
+}
+
+// Get bottom element from the stack
+template <typename T, int N> constexpr T StaticStack<T, N>::bottom() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  return this->stack[0];
+}
+
+// Get by index
+template <typename T, int N>
+constexpr T StaticStack<T, N>::at(const int &index) const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  if (index < 0 || index > this->top)
+    throw std::out_of_range("Provided index is out of range!");
+
+  return this->stack[index];
+}
+
+// Find element
+template <typename T, int N>
+constexpr int StaticStack<T, N>::find(const T &element) const {
+  for (int i = 0; i <= this->top; i++) {
+    if (this->stack[i] == element)
+      return i;
+  }
+
+  return -1;
+}
+
+// To string
+template <typename T, int N>
+const std::string StaticStack<T, N>::to_string() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  std::stringstream ss;
+  for (int i = 0; i <= this->top; i++) {
+    if (i != 0)
+      ss << ", ";
+
+    ss << this->stack[i];
+  }
+
+  ss << ".";
+  return ss.str();
+}
+
+//----------
+// Useful methods
+// ----------
+
+// Count element
+template <typename T, int N>
+constexpr int StaticStack<T, N>::count(const T &element) const {
+  int count = 0;
+  for (int i = 0; i <= this->top; i++) {
+    if (this->stack[i] == element)
+      count++;
+  }
+
+  return count;
+}
+
+// Count element by predicate
+template <typename T, int N>
+template <class Fn>
+constexpr int StaticStack<T, N>::count_if(Fn fn) const {
+  int count = 0;
+  for (int i = 0; i <= this->top; i++) {
+    if (fn(this->stack[i]))
+      count++;
+  }
+
+  return count;
+}
+
+//----------
+// Min/max
+// ----------
+
+// Find max element
+template <typename T, int N> constexpr T StaticStack<T, N>::max() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  T max = this->stack[0];
+  for (int i = 1; i <= this->top; i++) {
+    if (max < this->stack[i])
+      max = this->stack[i];
+  }
+
+  return max;
+}
+
+// Find min element
+template <typename T, int N> constexpr T StaticStack<T, N>::min() const {
+  if (this->is_empty())
+    throw std::underflow_error("Stack underflow!");
+
+  T min = this->stack[0];
+  for (int i = 1; i <= this->top; i++) {
+    if (min > this->stack[i])
+      min = this->stack[i];
+  }
+
+  return min;
+}
+
+//----------
+// Sorting
+// ----------
+
+// Insertion sort
+template <typename T, int N>
+template <class Compare>
+constexpr void StaticStack<T, N>::sort(Compare comp) {
+  for (int i = 1; i <= this->top; i++) {
+    T key = this->stack[i];
+    int j = i - 1;
+
+    while (j >= 0 && comp(key, this->stack[j])) {
+      this->stack[j + 1] = this->stack[j];
+      j--;
+    }
+
+    this->stack[j + 1] = key;
+  }
+}
+
+// ---------
+// Compare
+// ---------
+
+// Equal to
+template <typename T, int N>
+constexpr bool
+StaticStack<T, N>::operator==(const StaticStack<T, N> &other) const {
+  if (this->top != other.top)
+    return false;
+
+  for (int i = 0; i <= this->top; i++) {
+    if (this->stack[i] != other.stack[i])
+      return false;
+  }
+
+  return true;
+}
+
+#endif
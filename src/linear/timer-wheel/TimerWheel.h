@@ -0,0 +1,439 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Timer node class (intrusive doubly linked bucket node; the prev of the
+// head of a bucket is its tail)
+
+template <class T> class TimerNode {
+public:
+  T data;
+  std::uint64_t expires;
+  TimerNode<T> *prev;
+  TimerNode<T> *next;
+  int level;                // -1 when free (fired, cancelled or never used)
+  std::uint32_t generation; // bumped every time the node goes back to the pool
+  TimerNode()
+      : data(), expires(0), prev(nullptr), next(nullptr), level(-1),
+        generation(0) {}
+};
+
+// Timer handle returned by schedule (pool nodes are reused, the generation
+// tells a pending timer from a later one in the same node)
+
+template <class T> class TimerHandle {
+public:
+  TimerNode<T> *node;
+  std::uint32_t generation;
+  TimerHandle() : node(nullptr), generation(0) {}
+  TimerHandle(TimerNode<T> *node)
+      : node(node), generation(node != nullptr ? node->generation : 0) {}
+};
+
+// Hierarchical timer wheel (Levels wheels of 2^SlotBits buckets each, times
+// are absolute ticks)
+
+template <class T, int SlotBits = 6, int Levels = 6> class TimerWheel {
+  static_assert(SlotBits >= 1 && SlotBits <= 6,
+                "SlotBits should be in [1, 6] (one bitmap word per level)!");
+  static_assert(Levels >= 1 && SlotBits * Levels <= 63,
+                "SlotBits * Levels should be in [1, 63]!");
+
+private:
+  static constexpr int slots = 1 << SlotBits;
+  static constexpr std::uint64_t mask = slots - 1;
+  static constexpr int overflow = Levels;    // beyond the last level
+  static constexpr int expired = Levels + 1; // expiry <= now
+  static constexpr int firing = Levels + 2;  // detached batch being fired
+  static constexpr int block_size = 1024;
+
+  TimerNode<T> *wheel[Levels][slots] = {};
+  std::uint64_t occupied[Levels] = {}; // bit per non-empty bucket
+  TimerNode<T> *overflow_list;
+  TimerNode<T> *expired_list;
+  TimerNode<T> *firing_list;
+  std::uint64_t now;
+  int size;
+
+  // node pool
+  std::vector<TimerNode<T> *> blocks;
+  TimerNode<T> *free_list;
+
+  // bucket helper functions
+  static inline int bit_width(std::uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return x == 0 ? 0 : 64 - __builtin_clzll(x);
+#else
+    int width = 0;
+    for (; x != 0; x >>= 1)
+      width++;
+
+    return width;
+#endif
+  }
+  static inline int lowest_bit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while ((word & 1) == 0) {
+      word >>= 1;
+      bit++;
+    }
+
+    return bit;
+#endif
+  }
+  inline int slot_of(const TimerNode<T> *node) const {
+    return (node->expires >> (node->level * SlotBits)) & mask;
+  }
+  TimerNode<T> *&bucket(const int &level, const int &slot);
+  void link(TimerNode<T> *node, const int &level);
+  void unlink(TimerNode<T> *node);
+  TimerNode<T> *detach(const int &level, const int &slot);
+  void place(TimerNode<T> *node);
+  std::uint64_t next_event() const;
+  void cascade();
+  template <class Fn> int fire(const int &level, const int &slot, Fn &fn);
+
+  // pool helper functions
+  TimerNode<T> *acquire();
+  void release(TimerNode<T> *node);
+
+public:
+  // constructors
+  inline explicit TimerWheel<T, SlotBits, Levels>(const std::uint64_t now = 0)
+      : overflow_list(nullptr), expired_list(nullptr), firing_list(nullptr),
+        now(now), size(0), free_list(nullptr){};
+
+  // handles point into the wheel, so it cannot be copied
+  TimerWheel<T, SlotBits, Levels>(const TimerWheel<T, SlotBits, Levels> &) =
+      delete;
+  TimerWheel<T, SlotBits, Levels> &
+  operator=(const TimerWheel<T, SlotBits, Levels> &) = delete;
+
+  // destructor
+  inline ~TimerWheel<T, SlotBits, Levels>() {
+    for (TimerNode<T> *block : this->blocks)
+      delete[] block;
+  };
+
+  // getters
+  inline std::uint64_t get_now() const { return this->now; }
+  inline int get_size() const { return this->size; }
+  static constexpr std::uint64_t get_horizon() {
+    return std::uint64_t(1) << (SlotBits * Levels);
+  }
+
+  // bool methods
+  inline bool is_empty() const { return this->size == 0; }
+  inline bool is_pending(const TimerHandle<T> &handle) const {
+    return handle.node != nullptr && handle.node->level != -1 &&
+           handle.node->generation == handle.generation;
+  }
+
+  // scheduling (expiry <= now fires on the next advance; a handle stays safe
+  // to test and cancel after its timer fired or was cancelled)
+  TimerHandle<T> schedule(const std::uint64_t &expires, const T &value);
+  inline TimerHandle<T> schedule_after(const std::uint64_t &delay,
+                                       const T &value) {
+    return this->schedule(this->now + delay, value);
+  }
+  void cancel(const TimerHandle<T> &handle);
+  void clear();
+
+  // moving time forward (fires every timer with expiry <= to and returns
+  // how many fired: in expiry order, equal expiries in scheduling order;
+  // timers already due when scheduled fire first, in scheduling order)
+  template <class Fn> int advance(const std::uint64_t &to, Fn fn);
+  std::vector<T> advance(const std::uint64_t &to);
+};
+
+// ---------
+// Pool helpers
+// ---------
+
+// Take a node from the free list (allocates a new block when empty)
+template <typename T, int SlotBits, int Levels>
+TimerNode<T> *TimerWheel<T, SlotBits, Levels>::acquire() {
+  if (this->free_list == nullptr) {
+    TimerNode<T> *block = new TimerNode<T>[block_size];
+    this->blocks.push_back(block);
+
+    for (int i = block_size - 1; i >= 0; i--) {
+      block[i].next = this->free_list;
+      this->free_list = &block[i];
+    }
+  }
+
+  TimerNode<T> *node = this->free_list;
+  this->free_list = node->next;
+
+  return node;
+}
+
+// Give the node back to the free list (outstanding handles become stale)
+template <typename T, int SlotBits, int Levels>
+void TimerWheel<T, SlotBits, Levels>::release(TimerNode<T> *node) {
+  node->level = -1;
+  node->generation++;
+  node->prev = nullptr;
+  node->next = this->free_list;
+  this->free_list = node;
+}
+
+// ---------
+// Bucket helpers
+// ---------
+
+// Head of the bucket list
+template <typename T, int SlotBits, int Levels>
+TimerNode<T> *&TimerWheel<T, SlotBits, Levels>::bucket(const int &level,
+                                                       const int &slot) {
+  if (level == overflow)
+    return this->overflow_list;
+
+  if (level == expired)
+    return this->expired_list;
+
+  if (level == firing)
+    return this->firing_list;
+
+  return this->wheel[level][slot];
+}
+
+// Append the node to the end of its bucket (buckets fire head first, so
+// timers of one bucket fire in the order they were linked)
+template <typename T, int SlotBits, int Levels>
+void TimerWheel<T, SlotBits, Levels>::link(TimerNode<T> *node,
+                                           const int &level) {
+  node->level = level;
+  int slot = level < Levels ? this->slot_of(node) : 0;
+
+  TimerNode<T> *&head = this->bucket(level, slot);
+  node->next = nullptr;
+  if (head != nullptr) {
+    node->prev = head->prev;
+    head->prev->next = node;
+    head->prev = node;
+  } else {
+    node->prev = node;
+    head = node;
+  }
+
+  if (level < Levels)
+    this->occupied[level] |= std::uint64_t(1) << slot;
+}
+
+// Remove the node from its bucket
+template <typename T, int SlotBits, int Levels>
+void TimerWheel<T, SlotBits, Levels>::unlink(TimerNode<T> *node) {
+  int slot = node->level < Levels ? this->slot_of(node) : 0;
+  TimerNode<T> *&head = this->bucket(node->level, slot);
+
+  if (node == head)
+    head = node->next;
+  else
+    node->prev->next = node->next;
+
+  // the tail is the prev of the head
+  if (node->next != nullptr)
+    node->next->prev = node->prev;
+  else if (head != nullptr)
+    head->prev = node->prev;
+
+  if (node->level < Levels && this->wheel[node->level][slot] == nullptr)
+    this->occupied[node->level] &= ~(std::uint64_t(1) << slot);
+}
+
+// Take the whole bucket list out
+template <typename T, int SlotBits, int Levels>
+TimerNode<T> *TimerWheel<T, SlotBits, Levels>::detach(const int &level,
+                                                      const int &slot) {
+  TimerNode<T> *&head = this->bucket(level, slot);
+  TimerNode<T> *list = head;
+
+  head = nullptr;
+  if (level < Levels)
+    this->occupied[level] &= ~(std::uint64_t(1) << slot);
+
+  return list;
+}
+
+// Put the node on the lowest level whose current window holds its expiry
+// (the highest bit where expiry and now differ picks the level)
+template <typename T, int SlotBits, int Levels>
+void TimerWheel<T, SlotBits, Levels>::place(TimerNode<T> *node) {
+  if (node->expires <= this->now) {
+    this->link(node, expired);
+    return;
+  }
+
+  int level = (bit_width(node->expires ^ this->now) - 1) / SlotBits;
+  this->link(node, level < Levels ? level : overflow);
+}
+
+// First tick after now where a bucket has to be fired or cascaded
+template <typename T, int SlotBits, int Levels>
+std::uint64_t TimerWheel<T, SlotBits, Levels>::next_event() const {
+  for (int level = 0; level < Levels; level++) {
+    int shift = level * SlotBits;
+    int current = (this->now >> shift) & mask;
+
+    // buckets of a level are always ahead of now's index on that level
+    std::uint64_t ahead = (this->occupied[level] >> current) >> 1;
+    if (ahead != 0) {
+      std::uint64_t window = this->now >> (shift + SlotBits) << SlotBits;
+      int slot = current + 1 + lowest_bit(ahead);
+
+      return (window | slot) << shift;
+    }
+  }
+
+  // only the overflow list is left, it is re-placed at the horizon
+  int shift = SlotBits * Levels;
+  return ((this->now >> shift) + 1) << shift;
+}
+
+// Spread the buckets whose window starts at now over the levels below
+template <typename T, int SlotBits, int Levels>
+void TimerWheel<T, SlotBits, Levels>::cascade() {
+  for (int level = Levels; level >= 1; level--) {
+    int shift = level * SlotBits;
+    if ((this->now & ((std::uint64_t(1) << shift) - 1)) != 0)
+      continue;
+
+    int slot = level < Levels ? (this->now >> shift) & mask : 0;
+    TimerNode<T> *node = this->detach(level, slot);
+
+    while (node != nullptr) {
+      TimerNode<T> *next = node->next;
+      this->place(node);
+      node = next;
+    }
+  }
+}
+
+// Fire a whole bucket (the list is moved to the firing list first, so fn may
+// schedule, and may cancel a timer of the same batch before it fires)
+template <typename T, int SlotBits, int Levels>
+template <class Fn>
+int TimerWheel<T, SlotBits, Levels>::fire(const int &level, const int &slot,
+                                          Fn &fn) {
+  this->firing_list = this->detach(level, slot);
+  for (TimerNode<T> *node = this->firing_list; node != nullptr;
+       node = node->next)
+    node->level = firing;
+
+  int fired = 0;
+  while (this->firing_list != nullptr) {
+    TimerNode<T> *node = this->firing_list;
+    T value = std::move(node->data);
+
+    this->unlink(node);
+    this->release(node);
+    this->size--;
+    fired++;
+
+    fn(value);
+  }
+
+  return fired;
+}
+
+// ---------
+// Methods
+// ---------
+
+// Schedule a value at the given tick
+template <typename T, int SlotBits, int Levels>
+TimerHandle<T> TimerWheel<T, SlotBits, Levels>::schedule(
+    const std::uint64_t &expires, const T &value) {
+  TimerNode<T> *node = this->acquire();
+  node->data = value;
+  node->expires = expires;
+
+  this->place(node);
+  this->size++;
+
+  return TimerHandle<T>(node);
+}
+
+// Cancel a pending timer
+template <typename T, int SlotBits, int Levels>
+void TimerWheel<T, SlotBits, Levels>::cancel(const TimerHandle<T> &handle) {
+  if (!this->is_pending(handle))
+    throw std::invalid_argument("Timer is not pending!");
+
+  this->unlink(handle.node);
+  this->release(handle.node);
+  this->size--;
+}
+
+// Cancel all pending timers
+template <typename T, int SlotBits, int Levels>
+void TimerWheel<T, SlotBits, Levels>::clear() {
+  for (int level = 0; level <= firing; level++) {
+    int count = level < Levels ? slots : 1;
+
+    for (int slot = 0; slot < count; slot++) {
+      TimerNode<T> *node = this->detach(level, slot);
+      while (node != nullptr) {
+        TimerNode<T> *next = node->next;
+        this->release(node);
+        node = next;
+      }
+    }
+  }
+
+  this->size = 0;
+}
+
+// Move time forward to the given tick, firing expired timers in batches
+template <typename T, int SlotBits, int Levels>
+template <class Fn>
+int TimerWheel<T, SlotBits, Levels>::advance(const std::uint64_t &to, Fn fn) {
+  if (to < this->now)
+    throw std::invalid_argument("Time should not go backwards!");
+
+  int fired = this->fire(expired, 0, fn);
+
+  while (this->now < to) {
+    if (this->is_empty()) {
+      this->now = to;
+      break;
+    }
+
+    std::uint64_t next = this->next_event();
+    if (next > to) {
+      this->now = to;
+      break;
+    }
+
+    this->now = next;
+    this->cascade();
+
+    // level 0 bucket of now and timers cascaded straight to expired
+    fired += this->fire(0, this->now & mask, fn);
+    fired += this->fire(expired, 0, fn);
+  }
+
+  return fired;
+}
+
+// Move time forward and collect the values of expired timers
+template <typename T, int SlotBits, int Levels>
+std::vector<T> TimerWheel<T, SlotBits, Levels>::advance(
+    const std::uint64_t &to) {
+  std::vector<T> values;
+  this->advance(to, [&values](T &value) { values.push_back(value); });
+
+  return values;
+}
+
+#endif
@@ -0,0 +1,26 @@
+/*
+
+An unrolled linked list is a doubly linked list of blocks, every block keeps
+several elements in a small inline array. Compared to one node per element
+it needs far fewer allocations and pointers, and a traversal reads whole
+blocks that are contiguous in memory. Blocks are aligned to a cache line
+and by default hold as many elements as fit in it after the count and links.
+
+Inserting into a full block splits it in half, removing from a block that
+drops under half full borrows an element from the next block or merges with
+it, so every block except the last stays at least half full.
+
+Pros:
+    Much less memory per element than a linked list (no pointers per element)
+    Traversal and search touch one cache line per block of small elements
+    Insertion and removal in the middle move at most one block of elements
+
+Cons:
+    Access by index walks the blocks, O(n / B)
+    Elements move between blocks, so their addresses and iterators are not
+    stable across insertions and removals
+    Element type must be default constructible
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,929 @@
+#ifndef UNROLLEDLINKEDLIST_H
+#define UNROLLEDLINKEDLIST_H
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Block header (count and links) in front of the elements, used to size the
+// default block
+
+template <class T> struct UnrolledBlockHeader {
+  int count;
+  void *next;
+  void *prev;
+  alignas(T) unsigned char data[sizeof(T)];
+};
+
+// Default block capacity: as many elements as fit in one 64-byte cache line
+// after the header (at least 4, larger elements span several lines)
+
+template <class T> constexpr int unrolled_block_capacity() {
+  constexpr std::size_t header = offsetof(UnrolledBlockHeader<T>, data);
+  return header + sizeof(T) * 4 >= 64
+             ? 4
+             : static_cast<int>((64 - header) / sizeof(T));
+}
+
+// Unrolled linked list block (up to B elements stored inline after the
+// header, the first count slots are used), aligned to a cache line
+
+template <class T, int B> class alignas(64) UnrolledNode {
+public:
+  int count;
+  UnrolledNode<T, B> *next;
+  UnrolledNode<T, B> *prev;
+  T data[B];
+  UnrolledNode() : count(0), next(nullptr), prev(nullptr){};
+};
+
+template <class T, int B> class UnrolledLinkedList;
+
+// Unrolled List Iterator (bidirectional, a block and an offset in it; end()
+// holds nullptr and the list, so --end() is the last element). Any insertion
+// or removal may move elements between blocks and invalidates iterators.
+
+template <class T, int B> class UnrolledListIterator {
+private:
+  UnrolledNode<T, B> *node;
+  int offset;
+  const UnrolledLinkedList<T, B> *list;
+
+public:
+  // iterator traits
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  // constructors
+  inline UnrolledListIterator<T, B>()
+      : node(nullptr), offset(0), list(nullptr){};
+  inline UnrolledListIterator<T, B>(
+      UnrolledNode<T, B> *node, const int offset = 0,
+      const UnrolledLinkedList<T, B> *list = nullptr)
+      : node(node), offset(offset), list(list){};
+
+  // getters
+  inline UnrolledNode<T, B> *get_node() const { return this->node; }
+  inline int get_offset() const { return this->offset; }
+
+  // increment operators
+  inline UnrolledListIterator<T, B> &operator++() {
+    if (this->node != nullptr && ++this->offset == this->node->count) {
+      this->node = this->node->next;
+      this->offset = 0;
+    }
+
+    return *this;
+  }
+
+  inline UnrolledListIterator<T, B> operator++(int) {
+    UnrolledListIterator<T, B> temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  // decrement operators
+  inline UnrolledListIterator<T, B> &operator--() {
+    if (this->node == nullptr) {
+      if (this->list != nullptr && this->list->get_tail() != nullptr) {
+        this->node = this->list->get_tail();
+        this->offset = this->node->count - 1;
+      }
+    } else if (this->offset > 0) {
+      --this->offset;
+    } else {
+      this->node = this->node->prev;
+      this->offset = this->node != nullptr ? this->node->count - 1 : 0;
+    }
+
+    return *this;
+  }
+
+  inline UnrolledListIterator<T, B> operator--(int) {
+    UnrolledListIterator<T, B> temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  // get operators
+  inline T &operator*() const {
+    if (this->node == nullptr)
+      throw std::out_of_range("Iterator is out of range");
+
+    return this->node->data[this->offset];
+  }
+
+  inline T *operator->() const {
+    if (this->node == nullptr)
+      throw std::out_of_range("Iterator is out of range");
+
+    return &this->node->data[this->offset];
+  }
+
+  // adding operation (stops at the last element, skips whole blocks)
+  inline UnrolledListIterator<T, B> operator+(const int &value) const {
+    if (value < 0)
+      throw std::invalid_argument("Position argument should not be < 0!");
+
+    UnrolledListIterator<T, B> temp = *this;
+    UnrolledListIterator<T, B>::advance(temp, value);
+    return temp;
+  }
+
+  // substraction operation (stops at the first element)
+  inline UnrolledListIterator<T, B> operator-(const int &value) const {
+    if (value < 0)
+      throw std::invalid_argument("Position argument should not be < 0!");
+
+    int n = value;
+    UnrolledListIterator<T, B> temp = *this;
+    if (temp.node == nullptr && n > 0) {
+      --temp;
+      --n;
+    }
+
+    UnrolledListIterator<T, B>::advance(temp, -n);
+    return temp;
+  }
+
+  // advance method (stops at the first and the last element)
+  inline static void advance(UnrolledListIterator<T, B> &it, int n) {
+    if (it.node == nullptr)
+      return;
+
+    while (n > 0) {
+      int room = it.node->count - 1 - it.offset;
+      if (n <= room) {
+        it.offset += n;
+        return;
+      }
+
+      if (it.node->next == nullptr) {
+        it.offset = it.node->count - 1;
+        return;
+      }
+
+      n -= room + 1;
+      it.node = it.node->next;
+      it.offset = 0;
+    }
+
+    while (n < 0) {
+      if (-n <= it.offset) {
+        it.offset += n;
+        return;
+      }
+
+      if (it.node->prev == nullptr) {
+        it.offset = 0;
+        return;
+      }
+
+      n += it.offset + 1;
+      it.node = it.node->prev;
+      it.offset = it.node->count - 1;
+    }
+  }
+
+  // equals to
+  inline bool operator==(const UnrolledListIterator<T, B> &other) const {
+    return this->node == other.node && this->offset == other.offset;
+  }
+
+  // not equals to
+  inline bool operator!=(const UnrolledListIterator<T, B> &other) const {
+    return !(*this == other);
+  }
+};
+
+// Unrolled linked list (doubly linked blocks of up to B elements; full blocks
+// split in half on insertion, blocks under half full borrow from or merge
+// with a neighbour on removal)
+
+template <class T, int B = unrolled_block_capacity<T>()>
+class UnrolledLinkedList {
+  static_assert(B >= 2, "Block capacity must be >= 2!");
+
+private:
+  UnrolledNode<T, B> *head;
+  UnrolledNode<T, B> *tail;
+  int length;
+  int blocks;
+
+  // block helper functions
+  UnrolledNode<T, B> *add_block(UnrolledNode<T, B> *after);
+  void drop_block(UnrolledNode<T, B> *node);
+  void split(UnrolledNode<T, B> *node);
+  UnrolledNode<T, B> *locate(const int &index, int &offset) const;
+
+  // element helper functions (both return the position of the element that
+  // is now at the given place)
+  UnrolledListIterator<T, B> insert_at(UnrolledNode<T, B> *node, int offset,
+                                       const T &element);
+  UnrolledListIterator<T, B> erase_at(UnrolledNode<T, B> *node, int offset);
+
+public:
+  // constructors
+  inline explicit UnrolledLinkedList<T, B>()
+      : head(nullptr), tail(nullptr), length(0), blocks(0){};
+  UnrolledLinkedList<T, B>(int size, const T &value);
+  UnrolledLinkedList<T, B>(const std::vector<T> &vec);
+  template <typename Iterator>
+  UnrolledLinkedList<T, B>(Iterator begin, Iterator end);
+  UnrolledLinkedList<T, B>(const UnrolledLinkedList<T, B> &other);
+
+  // destructor
+  inline ~UnrolledLinkedList<T, B>() { this->clear(); }
+
+  // equal operator
+  UnrolledLinkedList<T, B> &operator=(const UnrolledLinkedList<T, B> &other);
+
+  // getters
+  inline UnrolledNode<T, B> *get_head() const { return this->head; }
+  inline UnrolledNode<T, B> *get_tail() const { return this->tail; }
+  inline int get_length() const { return this->length; }
+  inline int get_block_count() const { return this->blocks; }
+  inline int get_block_capacity() const { return B; }
+
+  // bool methods
+  inline bool is_empty() const { return this->length == 0; }
+  bool contains(const T &element) const;
+
+  // get element methods
+  T &at(const int &index) const;
+  inline T &operator[](const int &index) const { return this->at(index); }
+  T &front() const;
+  T &back() const;
+
+  // find (end() if there is no such element)
+  UnrolledListIterator<T, B> find(const T &element) const;
+  UnrolledListIterator<T, B> find_if(std::function<bool(T)> fn) const;
+  int get_index(const T &element) const;
+
+  // adding to the list (returns the position of the new element)
+  void push_end(const T &element);
+  void push_begin(const T &element);
+  UnrolledListIterator<T, B> push_after(const UnrolledListIterator<T, B> it,
+                                        const T &element);
+  UnrolledListIterator<T, B> push_before(const UnrolledListIterator<T, B> it,
+                                         const T &element);
+  void push_index(const int index, const T &element);
+  void push_middle(const T &element);
+  void push_vector(const int index, const std::vector<T> &vec);
+  template <class InputIt>
+  void push_range(const int index, InputIt first, InputIt last);
+
+  // removing from the list
+  void remove_end();
+  void remove_begin();
+  void remove_index(const int &index);
+  void remove_value(const T &element);
+  void remove_all(const T &element);
+  void remove_if(std::function<bool(T)> fn);
+  UnrolledListIterator<T, B> erase(const UnrolledListIterator<T, B> it);
+
+  // converting methods
+  const std::vector<T> to_vector(const bool order = true) const;
+  static inline UnrolledLinkedList<T, B>
+  from_vector(const std::vector<T> &vec) {
+    return UnrolledLinkedList<T, B>(vec);
+  }
+  const std::string to_string(const bool order = true) const;
+
+  // useful methods
+  void clear();
+  template <class Fn> void for_each(Fn fn) const;
+
+  // iterators (half-open: end() is one past the last element)
+  inline UnrolledListIterator<T, B> begin() const {
+    return UnrolledListIterator<T, B>(this->head, 0, this);
+  }
+  inline UnrolledListIterator<T, B> end() const {
+    return UnrolledListIterator<T, B>(nullptr, 0, this);
+  }
+
+  // compare methods
+  bool operator==(const UnrolledLinkedList<T, B> &other) const;
+  bool operator!=(const UnrolledLinkedList<T, B> &other) const;
+};
+
+// ---------
+// Constructors
+// ---------
+
+// Fill constructor of a given size
+template <typename T, int B>
+UnrolledLinkedList<T, B>::UnrolledLinkedList(int size, const T &value)
+    : UnrolledLinkedList<T, B>() {
+  while (size-- > 0)
+    this->push_end(value);
+}
+
+// Based on vector constructor
+template <typename T, int B>
+UnrolledLinkedList<T, B>::UnrolledLinkedList(const std::vector<T> &vec)
+    : UnrolledLinkedList<T, B>() {
+  for (const T &element : vec)
+    this->push_end(element);
+}
+
+// Based on range iterator constructor
+template <typename T, int B>
+template <typename Iterator>
+UnrolledLinkedList<T, B>::UnrolledLinkedList(Iterator begin, Iterator end)
+    : UnrolledLinkedList<T, B>() {
+  for (Iterator it = begin; it != end; ++it)
+    this->push_end(*it);
+}
+
+// Copy constructor (deep copy, blocks are packed full)
+template <typename T, int B>
+UnrolledLinkedList<T, B>::UnrolledLinkedList(
+    const UnrolledLinkedList<T, B> &other)
+    : UnrolledLinkedList<T, B>() {
+  other.for_each([this](const T &element) { this->push_end(element); });
+}
+
+// Equal operator
+template <typename T, int B>
+UnrolledLinkedList<T, B> &
+UnrolledLinkedList<T, B>::operator=(const UnrolledLinkedList<T, B> &other) {
+  if (this == &other)
+    return *this;
+
+  this->clear();
+  other.for_each([this](const T &element) { this->push_end(element); });
+
+  return *this;
+}
+
+// ---------
+// Blocks
+// ---------
+
+// Link a new empty block after the given one (at the front if it is null)
+template <typename T, int B>
+UnrolledNode<T, B> *UnrolledLinkedList<T, B>::add_block(
+    UnrolledNode<T, B> *after) {
+  UnrolledNode<T, B> *node = new UnrolledNode<T, B>();
+  node->prev = after;
+  node->next = after != nullptr ? after->next : this->head;
+
+  if (node->next != nullptr)
+    node->next->prev = node;
+  else
+    this->tail = node;
+
+  if (after != nullptr)
+    after->next = node;
+  else
+    this->head = node;
+
+  this->blocks++;
+  return node;
+}
+
+// Unlink and delete a block (its elements are not counted anymore)
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::drop_block(UnrolledNode<T, B> *node) {
+  if (node->prev != nullptr)
+    node->prev->next = node->next;
+  else
+    this->head = node->next;
+
+  if (node->next != nullptr)
+    node->next->prev = node->prev;
+  else
+    this->tail = node->prev;
+
+  delete node;
+  this->blocks--;
+}
+
+// Move the upper half of a block into a new block after it
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::split(UnrolledNode<T, B> *node) {
+  UnrolledNode<T, B> *add = this->add_block(node);
+  int keep = node->count / 2;
+
+  for (int i = keep; i < node->count; i++)
+    add->data[i - keep] = std::move(node->data[i]);
+
+  add->count = node->count - keep;
+  node->count = keep;
+}
+
+// Find the block holding an index and the offset in it (walks blocks from
+// the nearer end, the index should be in [0, length))
+template <typename T, int B>
+UnrolledNode<T, B> *UnrolledLinkedList<T, B>::locate(const int &index,
+                                                     int &offset) const {
+  UnrolledNode<T, B> *node;
+  if (index < this->length / 2) {
+    node = this->head;
+    offset = index;
+    while (offset >= node->count) {
+      offset -= node->count;
+      node = node->next;
+    }
+  } else {
+    node = this->tail;
+    int from_end = this->length - 1 - index;
+    while (from_end >= node->count) {
+      from_end -= node->count;
+      node = node->prev;
+    }
+    offset = node->count - 1 - from_end;
+  }
+
+  return node;
+}
+
+// ---------
+// Element helpers
+// ---------
+
+// Insert before the element at (node, offset), a null node means the end
+template <typename T, int B>
+UnrolledListIterator<T, B>
+UnrolledLinkedList<T, B>::insert_at(UnrolledNode<T, B> *node, int offset,
+                                    const T &element) {
+  if (node == nullptr) {
+    node = this->tail;
+    offset = node != nullptr ? node->count : 0;
+  }
+
+  // the front of a block is also the back of the previous one
+  if (node != nullptr && offset == 0 && node->count == B &&
+      node->prev != nullptr && node->prev->count < B) {
+    node = node->prev;
+    offset = node->count;
+  }
+
+  if (node == nullptr) {
+    node = this->add_block(nullptr);
+  } else if (node->count == B) {
+    // appending or prepending to the whole list starts a new block, so
+    // sequential pushes keep blocks full instead of half full
+    if (offset == B && node->next == nullptr) {
+      node = this->add_block(node);
+      offset = 0;
+    } else if (offset == 0 && node->prev == nullptr) {
+      node = this->add_block(nullptr);
+    } else {
+      this->split(node);
+      if (offset > node->count) {
+        offset -= node->count;
+        node = node->next;
+      }
+    }
+  }
+
+  for (int i = node->count; i > offset; i--)
+    node->data[i] = std::move(node->data[i - 1]);
+
+  node->data[offset] = element;
+  node->count++;
+  this->length++;
+
+  return UnrolledListIterator<T, B>(node, offset, this);
+}
+
+// Remove the element at (node, offset) and keep blocks at least half full
+template <typename T, int B>
+UnrolledListIterator<T, B>
+UnrolledLinkedList<T, B>::erase_at(UnrolledNode<T, B> *node, int offset) {
+  for (int i = offset; i < node->count - 1; i++)
+    node->data[i] = std::move(node->data[i + 1]);
+
+  node->count--;
+  this->length--;
+
+  if (node->count == 0) {
+    UnrolledNode<T, B> *next = node->next;
+    this->drop_block(node);
+    return UnrolledListIterator<T, B>(next, 0, this);
+  }
+
+  if (node->count < B / 2) {
+    UnrolledNode<T, B> *next = node->next, *prev = node->prev;
+    if (next != nullptr && node->count + next->count <= B) {
+      for (int i = 0; i < next->count; i++)
+        node->data[node->count + i] = std::move(next->data[i]);
+
+      node->count += next->count;
+      this->drop_block(next);
+    } else if (next != nullptr) {
+      node->data[node->count++] = std::move(next->data[0]);
+      for (int i = 0; i < next->count - 1; i++)
+        next->data[i] = std::move(next->data[i + 1]);
+
+      next->count--;
+    } else if (prev != nullptr && prev->count + node->count <= B) {
+      for (int i = 0; i < node->count; i++)
+        prev->data[prev->count + i] = std::move(node->data[i]);
+
+      offset += prev->count;
+      prev->count += node->count;
+      this->drop_block(node);
+      node = prev;
+    }
+  }
+
+  if (offset < node->count)
+    return UnrolledListIterator<T, B>(node, offset, this);
+
+  return UnrolledListIterator<T, B>(node->next, 0, this);
+}
+
+// ---------
+// Methods
+// ---------
+
+// Push element at the end
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::push_end(const T &element) {
+  this->insert_at(nullptr, 0, element);
+}
+
+// Push element at the beginning
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::push_begin(const T &element) {
+  this->insert_at(this->head, 0, element);
+}
+
+// Push element after the given position
+template <typename T, int B>
+UnrolledListIterator<T, B>
+UnrolledLinkedList<T, B>::push_after(const UnrolledListIterator<T, B> it,
+                                     const T &element) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  if (it.get_node() == nullptr)
+    throw std::invalid_argument("Cannot push after the end() iterator!");
+
+  return this->insert_at(it.get_node(), it.get_offset() + 1, element);
+}
+
+// Push element before the given position (end() pushes at the end)
+template <typename T, int B>
+UnrolledListIterator<T, B>
+UnrolledLinkedList<T, B>::push_before(const UnrolledListIterator<T, B> it,
+                                      const T &element) {
+  return this->insert_at(it.get_node(), it.get_offset(), element);
+}
+
+// Push element at given position (index in [0, length])
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::push_index(const int index, const T &element) {
+  if (index < 0 || index > this->length)
+    throw std::out_of_range("Provided index is out of range!");
+
+  if (index == this->length) {
+    this->push_end(element);
+    return;
+  }
+
+  int offset;
+  UnrolledNode<T, B> *node = this->locate(index, offset);
+  this->insert_at(node, offset, element);
+}
+
+// Push element at the middle of a list (after the element (length - 1) / 2)
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::push_middle(const T &element) {
+  if (this->length < 2) {
+    this->push_end(element);
+    return;
+  }
+
+  this->push_index((this->length - 1) / 2 + 1, element);
+}
+
+// Push vector at the given position
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::push_vector(const int index,
+                                           const std::vector<T> &vec) {
+  if (vec.empty())
+    throw std::invalid_argument("Vector should not be empty!");
+
+  this->push_range(index, vec.begin(), vec.end());
+}
+
+// Push a range at the given position (index in [0, length], one walk to the
+// index, then every element goes right after the previous one)
+template <typename T, int B>
+template <class InputIt>
+void UnrolledLinkedList<T, B>::push_range(const int index, InputIt first,
+                                          InputIt last) {
+  if (index < 0 || index > this->length)
+    throw std::out_of_range("Provided index is out of range!");
+
+  int offset = 0;
+  UnrolledNode<T, B> *node =
+      index == this->length ? nullptr : this->locate(index, offset);
+
+  for (; first != last; ++first) {
+    UnrolledListIterator<T, B> added = this->insert_at(node, offset, *first);
+    node = added.get_node();
+    offset = added.get_offset() + 1;
+
+    // the next insertion point is the element that followed the new one
+    if (offset == node->count) {
+      node = node->next;
+      offset = 0;
+    }
+  }
+}
+
+// Remove the last element
+template <typename T, int B> void UnrolledLinkedList<T, B>::remove_end() {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  this->erase_at(this->tail, this->tail->count - 1);
+}
+
+// Remove the first element
+template <typename T, int B> void UnrolledLinkedList<T, B>::remove_begin() {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  this->erase_at(this->head, 0);
+}
+
+// Remove by index
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::remove_index(const int &index) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  if (index < 0 || index > this->length - 1)
+    throw std::out_of_range("Provided index is out of range!");
+
+  int offset;
+  UnrolledNode<T, B> *node = this->locate(index, offset);
+  this->erase_at(node, offset);
+}
+
+// Remove the first occurence of a value
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::remove_value(const T &element) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  UnrolledListIterator<T, B> it = this->find(element);
+  if (it == this->end())
+    throw std::invalid_argument("Node by provided value was not found!");
+
+  this->erase_at(it.get_node(), it.get_offset());
+}
+
+// Remove all occurences of a value
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::remove_all(const T &element) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  if (!this->contains(element))
+    throw std::invalid_argument("Node with provided value was not found!");
+
+  this->remove_if([&element](const T &value) { return value == element; });
+}
+
+// Remove by predicate (one pass, compacts every block in place)
+template <typename T, int B>
+void UnrolledLinkedList<T, B>::remove_if(std::function<bool(T)> fn) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  UnrolledNode<T, B> *node = this->head;
+  while (node != nullptr) {
+    UnrolledNode<T, B> *next = node->next;
+
+    int kept = 0;
+    for (int i = 0; i < node->count; i++) {
+      if (fn(node->data[i])) {
+        this->length--;
+        continue;
+      }
+
+      if (kept != i)
+        node->data[kept] = std::move(node->data[i]);
+      kept++;
+    }
+    node->count = kept;
+
+    if (kept == 0) {
+      this->drop_block(node);
+    } else if (node->prev != nullptr && node->prev->count + kept <= B) {
+      UnrolledNode<T, B> *prev = node->prev;
+      for (int i = 0; i < kept; i++)
+        prev->data[prev->count + i] = std::move(node->data[i]);
+
+      prev->count += kept;
+      this->drop_block(node);
+    }
+
+    node = next;
+  }
+}
+
+// Remove the element at the given position (returns the position of the
+// element after it)
+template <typename T, int B>
+UnrolledListIterator<T, B>
+UnrolledLinkedList<T, B>::erase(const UnrolledListIterator<T, B> it) {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  if (it.get_node() == nullptr)
+    throw std::out_of_range("Cannot erase the end() iterator!");
+
+  return this->erase_at(it.get_node(), it.get_offset());
+}
+
+// Get element by index
+template <typename T, int B>
+T &UnrolledLinkedList<T, B>::at(const int &index) const {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  if (index < 0 || index > this->length - 1)
+    throw std::out_of_range("Provided index is out of range!");
+
+  int offset;
+  UnrolledNode<T, B> *node = this->locate(index, offset);
+  return node->data[offset];
+}
+
+// Get the first element
+template <typename T, int B> T &UnrolledLinkedList<T, B>::front() const {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  return this->head->data[0];
+}
+
+// Get the last element
+template <typename T, int B> T &UnrolledLinkedList<T, B>::back() const {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  return this->tail->data[this->tail->count - 1];
+}
+
+// Find the first occurence of a value
+template <typename T, int B>
+UnrolledListIterator<T, B>
+UnrolledLinkedList<T, B>::find(const T &element) const {
+  for (UnrolledNode<T, B> *node = this->head; node != nullptr;
+       node = node->next) {
+    for (int i = 0; i < node->count; i++) {
+      if (node->data[i] == element)
+        return UnrolledListIterator<T, B>(node, i, this);
+    }
+  }
+
+  return this->end();
+}
+
+// Find the first element matching a predicate
+template <typename T, int B>
+UnrolledListIterator<T, B>
+UnrolledLinkedList<T, B>::find_if(std::function<bool(T)> fn) const {
+  for (UnrolledNode<T, B> *node = this->head; node != nullptr;
+       node = node->next) {
+    for (int i = 0; i < node->count; i++) {
+      if (fn(node->data[i]))
+        return UnrolledListIterator<T, B>(node, i, this);
+    }
+  }
+
+  return this->end();
+}
+
+// Get index of a value (first occurence, -1 if there is none)
+template <typename T, int B>
+int UnrolledLinkedList<T, B>::get_index(const T &element) const {
+  int index = 0;
+  for (UnrolledNode<T, B> *node = this->head; node != nullptr;
+       node = node->next) {
+    for (int i = 0; i < node->count; i++) {
+      if (node->data[i] == element)
+        return index + i;
+    }
+
+    index += node->count;
+  }
+
+  return -1;
+}
+
+// If the value is in the list
+template <typename T, int B>
+bool UnrolledLinkedList<T, B>::contains(const T &element) const {
+  return this->find(element) != this->end();
+}
+
+// Visit every element from the first to the last
+template <typename T, int B>
+template <class Fn>
+void UnrolledLinkedList<T, B>::for_each(Fn fn) const {
+  for (UnrolledNode<T, B> *node = this->head; node != nullptr;
+       node = node->next) {
+    for (int i = 0; i < node->count; i++)
+      fn(node->data[i]);
+  }
+}
+
+// To vector
+template <typename T, int B>
+const std::vector<T> UnrolledLinkedList<T, B>::to_vector(
+    const bool order) const {
+  std::vector<T> vec;
+  vec.reserve(this->length);
+
+  if (order) {
+    this->for_each([&vec](const T &element) { vec.push_back(element); });
+  } else {
+    for (UnrolledNode<T, B> *node = this->tail; node != nullptr;
+         node = node->prev) {
+      for (int i = node->count - 1; i >= 0; i--)
+        vec.push_back(node->data[i]);
+    }
+  }
+
+  return vec;
+}
+
+// To string
+template <typename T, int B>
+const std::string UnrolledLinkedList<T, B>::to_string(const bool order) const {
+  if (this->is_empty())
+    throw std::length_error("List is empty!");
+
+  std::stringstream ss;
+  int left = this->length;
+  for (const T &element : this->to_vector(order)) {
+    ss << element;
+    if (--left != 0)
+      ss << " <-> ";
+  }
+
+  return ss.str();
+}
+
+// ---------
+// Useful methods
+// ---------
+
+// Clear the list
+template <typename T, int B> void UnrolledLinkedList<T, B>::clear() {
+  while (this->head != nullptr) {
+    UnrolledNode<T, B> *next = this->head->next;
+    delete this->head;
+    this->head = next;
+  }
+
+  this->tail = nullptr;
+  this->length = this->blocks = 0;
+}
+
+// ---------
+// Compare
+// ---------
+
+// Equal to (same elements in the same order, block layout does not matter)
+template <typename T, int B>
+bool UnrolledLinkedList<T, B>::operator==(
+    const UnrolledLinkedList<T, B> &other) const {
+  if (this->length != other.length)
+    return false;
+
+  UnrolledListIterator<T, B> a = this->begin(), b = other.begin();
+  for (; a != this->end(); ++a, ++b) {
+    if (*a != *b)
+      return false;
+  }
+
+  return true;
+}
+
+// Not equal to
+template <typename T, int B>
+bool UnrolledLinkedList<T, B>::operator!=(
+    const UnrolledLinkedList<T, B> &other) const {
+  return !(*this == other);
+}
+
+#endif
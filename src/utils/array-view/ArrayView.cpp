@@ -0,0 +1,11 @@
+/*
+
+An array view is a non-owning window over contiguous memory: a pointer plus
+a length (and a stride to skip elements). Creating or slicing a view is O(1)
+and never allocates, so read-only algorithms can run over any part of a
+larger buffer without copying it. The view does not manage the lifetime of
+the data, so it must not outlive the container it was taken from.
+
+*/
+
+int main() { return 0; }
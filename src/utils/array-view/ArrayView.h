@@ -0,0 +1,270 @@
+#ifndef ARRAYVIEW_H
+#define ARRAYVIEW_H
+
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Array view (non-owning pointer + length + stride; ArrayView<const T> is
+// read-only and a mutable view converts to it)
+
+template <class T> class ArrayView {
+private:
+  T *data;
+  int length;
+  int stride;
+
+  // heap sort helper function
+  void sift_down(int root, int end, std::function<bool(T, T)> comp) const;
+
+public:
+  using value_type = typename std::remove_const<T>::type;
+
+  // constructors
+  inline ArrayView<T>() : data(nullptr), length(0), stride(1){};
+  inline ArrayView<T>(T *data, const int length, const int stride = 1)
+      : data(data), length(length), stride(stride) {
+    if (length < 0)
+      throw std::invalid_argument("Length should not be < 0!");
+
+    if (stride < 1)
+      throw std::invalid_argument("Stride should be > 0!");
+  };
+  template <class U, class = typename std::enable_if<
+                         std::is_same<const U, T>::value &&
+                         !std::is_same<U, T>::value>::type>
+  inline ArrayView<T>(const ArrayView<U> &other)
+      : data(other.get_data()), length(other.get_size()),
+        stride(other.get_stride()){};
+
+  // getters
+  inline T *get_data() const { return this->data; }
+  inline int get_size() const { return this->length; }
+  inline int get_stride() const { return this->stride; }
+
+  // bool methods
+  inline bool is_empty() const { return this->length == 0; }
+  inline bool is_contiguous() const { return this->stride == 1; }
+  bool contains(const T &value) const;
+
+  // get element
+  T &at(const int &index) const;
+  inline T &operator[](const int &index) const { return this->at(index); }
+
+  // slicing
+  ArrayView<T> slice(const int &from, const int &to) const;
+  ArrayView<T> strided(const int &step) const;
+
+  // converting methods
+  const std::vector<value_type> to_vector() const;
+  const std::string to_string() const;
+
+  // read-only algorithms
+  int find(const T &element) const;
+  int count(const T &element) const;
+  int count_if(std::function<bool(T)> fn) const;
+  value_type reduce(value_type init,
+                    std::function<value_type(value_type, value_type)> fn =
+                        std::plus<value_type>()) const;
+  value_type max() const;
+  value_type min() const;
+
+  // algorithms modifying the viewed elements (mutable views only)
+  void reverse() const;
+  void sort(std::function<bool(T, T)> comp = std::less<T>()) const;
+};
+
+// ---------
+// Methods
+// ---------
+
+// Get element by index
+template <typename T> T &ArrayView<T>::at(const int &index) const {
+  if (this->is_empty())
+    throw std::length_error("View is empty!");
+
+  if (index < 0 || index >= this->length)
+    throw std::out_of_range("Provided index is out of range!");
+
+  return this->data[index * this->stride];
+}
+
+// Sub-view of elements [from, to)
+template <typename T>
+ArrayView<T> ArrayView<T>::slice(const int &from, const int &to) const {
+  if (from < 0 || to > this->length)
+    throw std::out_of_range("Provided index is out of range!");
+
+  if (from > to)
+    throw std::invalid_argument("1st index must not be greater than 2nd!");
+
+  return ArrayView<T>(this->data + from * this->stride, to - from,
+                      this->stride);
+}
+
+// View of every step-th element
+template <typename T>
+ArrayView<T> ArrayView<T>::strided(const int &step) const {
+  if (step < 1)
+    throw std::invalid_argument("Step should be > 0!");
+
+  return ArrayView<T>(this->data, (this->length + step - 1) / step,
+                      this->stride * step);
+}
+
+// Contains element in the view
+template <typename T> bool ArrayView<T>::contains(const T &value) const {
+  return this->find(value) != -1;
+}
+
+// To vector
+template <typename T>
+const std::vector<typename ArrayView<T>::value_type>
+ArrayView<T>::to_vector() const {
+  std::vector<value_type> vec;
+  vec.reserve(this->length);
+
+  for (int i = 0; i < this->length; i++)
+    vec.push_back(this->data[i * this->stride]);
+
+  return vec;
+}
+
+// To string
+template <typename T> const std::string ArrayView<T>::to_string() const {
+  if (this->is_empty())
+    throw std::length_error("View is empty!");
+
+  std::stringstream ss;
+  for (int i = 0; i < this->length; i++) {
+    if (i != 0)
+      ss << ", ";
+
+    ss << this->data[i * this->stride];
+  }
+
+  ss << ".";
+  return ss.str();
+}
+
+// Index of the first occurrence of an element (-1 if not found)
+template <typename T> int ArrayView<T>::find(const T &element) const {
+  for (int i = 0; i < this->length; i++) {
+    if (this->data[i * this->stride] == element)
+      return i;
+  }
+
+  return -1;
+}
+
+// Count element
+template <typename T> int ArrayView<T>::count(const T &element) const {
+  int count = 0;
+  for (int i = 0; i < this->length; i++) {
+    if (this->data[i * this->stride] == element)
+      count++;
+  }
+
+  return count;
+}
+
+// Count element by predicate
+template <typename T>
+int ArrayView<T>::count_if(std::function<bool(T)> fn) const {
+  int count = 0;
+  for (int i = 0; i < this->length; i++) {
+    if (fn(this->data[i * this->stride]))
+      count++;
+  }
+
+  return count;
+}
+
+// Reduce
+template <typename T>
+typename ArrayView<T>::value_type ArrayView<T>::reduce(
+    value_type init,
+    std::function<value_type(value_type, value_type)> fn) const {
+  for (int i = 0; i < this->length; i++)
+    init = fn(init, this->data[i * this->stride]);
+
+  return init;
+}
+
+// Find max element
+template <typename T>
+typename ArrayView<T>::value_type ArrayView<T>::max() const {
+  if (this->is_empty())
+    throw std::length_error("View is empty!");
+
+  value_type max = this->data[0];
+  for (int i = 1; i < this->length; i++) {
+    if (max < this->data[i * this->stride])
+      max = this->data[i * this->stride];
+  }
+
+  return max;
+}
+
+// Find min element
+template <typename T>
+typename ArrayView<T>::value_type ArrayView<T>::min() const {
+  if (this->is_empty())
+    throw std::length_error("View is empty!");
+
+  value_type min = this->data[0];
+  for (int i = 1; i < this->length; i++) {
+    if (min > this->data[i * this->stride])
+      min = this->data[i * this->stride];
+  }
+
+  return min;
+}
+
+// Reverse the viewed elements
+template <typename T> void ArrayView<T>::reverse() const {
+  int i = 0, j = this->length - 1;
+  while (i < j) {
+    std::swap(this->data[i * this->stride], this->data[j * this->stride]);
+    i++;
+    j--;
+  }
+}
+
+// Sort the viewed elements in place (heap sort, no allocation)
+template <typename T>
+void ArrayView<T>::sort(std::function<bool(T, T)> comp) const {
+  for (int i = this->length / 2 - 1; i >= 0; i--)
+    this->sift_down(i, this->length, comp);
+
+  for (int end = this->length - 1; end > 0; end--) {
+    std::swap(this->data[0], this->data[end * this->stride]);
+    this->sift_down(0, end, comp);
+  }
+}
+
+// Heap sort helper function
+template <typename T>
+void ArrayView<T>::sift_down(int root, int end,
+                             std::function<bool(T, T)> comp) const {
+  while (2 * root + 1 < end) {
+    int child = 2 * root + 1;
+    if (child + 1 < end && comp(this->data[child * this->stride],
+                                this->data[(child + 1) * this->stride]))
+      child++;
+
+    if (!comp(this->data[root * this->stride],
+              this->data[child * this->stride]))
+      return;
+
+    std::swap(this->data[root * this->stride],
+              this->data[child * this->stride]);
+    root = child;
+  }
+}
+
+#endif
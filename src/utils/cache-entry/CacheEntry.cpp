@@ -0,0 +1,12 @@
+/*
+
+Cache entry helpers are shared by the caches (LruCache, LfuCache and
+ShardedCache): the entry stored in their lists (key, value and weight), the
+weigher that turns an entry into the amount of capacity it uses, and the
+hit/miss/eviction counters. With no weigher every entry weighs 1 and the
+capacity is a number of entries, with a weigher returning sizes in bytes
+the capacity is a number of bytes.
+
+*/
+
+int main() { return 0; }
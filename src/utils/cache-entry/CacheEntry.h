@@ -0,0 +1,46 @@
+#ifndef CACHEENTRY_H
+#define CACHEENTRY_H
+
+#include <cstddef>
+#include <functional>
+
+// Cache entry (weight is what the entry counts against the capacity)
+
+template <class K, class V> class CacheEntry {
+public:
+  K key;
+  V value;
+  std::size_t weight;
+  CacheEntry(const K &key, const V &value, const std::size_t weight)
+      : key(key), value(value), weight(weight){};
+};
+
+// Weight of an entry (e.g. its size in bytes), an empty weigher counts
+// every entry as 1 so the capacity is a number of entries
+
+template <class K, class V>
+using CacheWeigher = std::function<std::size_t(const K &, const V &)>;
+
+// Cache counters (hits and misses of get, entries evicted for room)
+
+class CacheStats {
+public:
+  long long hits;
+  long long misses;
+  long long evictions;
+  CacheStats() : hits(0), misses(0), evictions(0){};
+
+  inline double hit_ratio() const {
+    long long lookups = this->hits + this->misses;
+    return lookups == 0 ? 0.0 : static_cast<double>(this->hits) / lookups;
+  }
+
+  inline CacheStats &operator+=(const CacheStats &other) {
+    this->hits += other.hits;
+    this->misses += other.misses;
+    this->evictions += other.evictions;
+    return *this;
+  }
+};
+
+#endif
@@ -0,0 +1,23 @@
+/*
+
+Epoch based reclamation frees the nodes of a lock-free structure without
+locks and without reference counts. A thread reads shared nodes only inside
+a guard, which publishes the global epoch the guard started in. A node that
+a writer unlinks is retired with the current epoch instead of deleted, and
+the epoch only moves forward when every active guard is already in it.
+After two moves no guard can have started before the node was unlinked, so
+it is freed.
+
+Pros:
+    Readers pay one slot claim and two stores per guard, not per node
+    Retiring is a push on a lock-free stack
+
+Cons:
+    A guard that never ends stops every node from being freed
+    Guard slots come in blocks of 64; more active guards link in another
+    block, which is kept until the domain is destroyed and scanned by every
+    collection
+
+*/
+
+int main() { return 0; }
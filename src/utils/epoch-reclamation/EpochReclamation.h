@@ -0,0 +1,287 @@
+#ifndef EPOCHRECLAMATION_H
+#define EPOCHRECLAMATION_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+// Epoch based reclamation domain: threads read shared nodes inside an
+// EpochGuard, a node unlinked by a writer is retired instead of deleted and
+// freed once every guard that could still see it has ended. Guards take a
+// slot each; when every slot is in use another block of slots is linked in,
+// so entering never waits for another thread (blocks live until the
+// destructor, collecting scans all of them).
+
+class EpochDomain {
+public:
+  static constexpr int slots = 64;         // guard slots per block
+  static constexpr int collect_every = 64; // retires between collections
+
+private:
+  // a slot holds the epoch its guard entered in, 0 when idle
+  struct alignas(64) Slot {
+    std::atomic<std::uint64_t> epoch;
+    std::atomic<bool> used;
+  };
+
+  struct SlotBlock {
+    Slot table[slots];
+    std::atomic<SlotBlock *> next;
+    SlotBlock() : next(nullptr) {
+      for (Slot &slot : this->table) {
+        slot.epoch.store(0, std::memory_order_relaxed);
+        slot.used.store(false, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  struct Retired {
+    void *ptr;
+    void (*deleter)(void *);
+    std::uint64_t epoch;
+    Retired *next;
+  };
+
+  std::atomic<std::uint64_t> epoch;
+  SlotBlock first;
+  std::atomic<int> blocks;
+  std::atomic<Retired *> retired;
+  std::atomic<int> waiting; // retired and not freed yet
+  std::atomic<int> since_collect;
+
+  // guard helper functions
+  Slot *enter();
+  void exit(Slot *slot);
+
+  // collection helper functions
+  bool try_advance();
+  void free_retired(const bool all);
+
+  friend class EpochGuard;
+
+public:
+  // constructors
+  inline EpochDomain()
+      : epoch(1), blocks(1), retired(nullptr), waiting(0), since_collect(0){};
+
+  // guards point into the domain, so it cannot be copied
+  EpochDomain(const EpochDomain &) = delete;
+  EpochDomain &operator=(const EpochDomain &) = delete;
+
+  // destructor (no guard may be active anymore, frees everything retired)
+  ~EpochDomain();
+
+  // getters
+  inline std::uint64_t get_epoch() const {
+    return this->epoch.load(std::memory_order_acquire);
+  }
+  inline int get_waiting() const {
+    return this->waiting.load(std::memory_order_relaxed);
+  }
+  inline int get_slots() const {
+    return this->blocks.load(std::memory_order_relaxed) * slots;
+  }
+
+  // retiring an unlinked node (deleted later with delete)
+  template <class T> inline void retire(T *ptr) {
+    this->retire(ptr, [](void *p) { delete static_cast<T *>(p); });
+  }
+  void retire(void *ptr, void (*deleter)(void *));
+
+  // advance the epoch if every active guard is in the current one and free
+  // what no guard can see anymore
+  void collect();
+
+  // free everything retired (only while no guard is active)
+  void drain();
+};
+
+// Epoch guard (RAII critical section, pointers read inside it stay valid
+// until it ends)
+
+class EpochGuard {
+private:
+  EpochDomain &domain;
+  EpochDomain::Slot *slot;
+
+public:
+  inline explicit EpochGuard(EpochDomain &domain)
+      : domain(domain), slot(domain.enter()){};
+  inline ~EpochGuard() { this->domain.exit(this->slot); }
+
+  EpochGuard(const EpochGuard &) = delete;
+  EpochGuard &operator=(const EpochGuard &) = delete;
+};
+
+// ---------
+// Destructor
+// ---------
+
+// Free everything retired and the grown slot blocks
+inline EpochDomain::~EpochDomain() {
+  this->free_retired(true);
+
+  SlotBlock *block = this->first.next.load(std::memory_order_relaxed);
+  while (block != nullptr) {
+    SlotBlock *next = block->next.load(std::memory_order_relaxed);
+    delete block;
+    block = next;
+  }
+}
+
+// ---------
+// Guard helpers
+// ---------
+
+// Take a free slot (starting from a slot picked by the thread, so threads
+// rarely collide; a block that is full is passed, the last one grows the
+// chain) and publish the current epoch in it
+inline EpochDomain::Slot *EpochDomain::enter() {
+  thread_local const int start = static_cast<int>(
+      std::hash<std::thread::id>()(std::this_thread::get_id()) % slots);
+
+  Slot *slot = nullptr;
+  SlotBlock *block = &this->first;
+  while (true) {
+    for (int i = 0; i < slots && slot == nullptr; i++) {
+      Slot &candidate = block->table[(start + i) % slots];
+      bool expected = false;
+      if (!candidate.used.load(std::memory_order_relaxed) &&
+          candidate.used.compare_exchange_strong(expected, true,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_relaxed))
+        slot = &candidate;
+    }
+
+    if (slot != nullptr)
+      break;
+
+    SlotBlock *next = block->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      SlotBlock *grown = new SlotBlock();
+      if (block->next.compare_exchange_strong(next, grown,
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_acquire)) {
+        this->blocks.fetch_add(1, std::memory_order_relaxed);
+        next = grown;
+      } else {
+        delete grown;
+      }
+    }
+
+    block = next;
+  }
+
+  // the epoch has to be published before any shared pointer is read, check
+  // that it did not move meanwhile
+  std::uint64_t current = this->epoch.load(std::memory_order_seq_cst);
+  while (true) {
+    slot->epoch.store(current, std::memory_order_seq_cst);
+    std::uint64_t again = this->epoch.load(std::memory_order_seq_cst);
+    if (again == current)
+      break;
+
+    current = again;
+  }
+
+  return slot;
+}
+
+// Leave the critical section and give the slot back
+inline void EpochDomain::exit(Slot *slot) {
+  slot->epoch.store(0, std::memory_order_release);
+  slot->used.store(false, std::memory_order_release);
+}
+
+// ---------
+// Collection helpers
+// ---------
+
+// Move to the next epoch if no active guard is still in an older one
+inline bool EpochDomain::try_advance() {
+  std::uint64_t current = this->epoch.load(std::memory_order_seq_cst);
+
+  for (const SlotBlock *block = &this->first; block != nullptr;
+       block = block->next.load(std::memory_order_acquire)) {
+    for (const Slot &slot : block->table) {
+      std::uint64_t seen = slot.epoch.load(std::memory_order_seq_cst);
+      if (seen != 0 && seen != current)
+        return false;
+    }
+  }
+
+  return this->epoch.compare_exchange_strong(current, current + 1,
+                                             std::memory_order_seq_cst);
+}
+
+// Free retired nodes two epochs old or more (everything with all, when no
+// guard can be active), the rest goes back to the list
+inline void EpochDomain::free_retired(const bool all) {
+  Retired *list = this->retired.exchange(nullptr, std::memory_order_acquire);
+  std::uint64_t current = this->epoch.load(std::memory_order_seq_cst);
+  Retired *keep = nullptr, *keep_tail = nullptr;
+  int freed = 0;
+
+  while (list != nullptr) {
+    Retired *next = list->next;
+
+    if (all || list->epoch + 2 <= current) {
+      list->deleter(list->ptr);
+      delete list;
+      freed++;
+    } else {
+      list->next = keep;
+      keep = list;
+      if (keep_tail == nullptr)
+        keep_tail = list;
+    }
+
+    list = next;
+  }
+
+  if (keep != nullptr) {
+    Retired *top = this->retired.load(std::memory_order_relaxed);
+    do {
+      keep_tail->next = top;
+    } while (!this->retired.compare_exchange_weak(top, keep,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed));
+  }
+
+  this->waiting.fetch_sub(freed, std::memory_order_relaxed);
+}
+
+// ---------
+// Methods
+// ---------
+
+// Retire an unlinked node, collects every collect_every retires
+inline void EpochDomain::retire(void *ptr, void (*deleter)(void *)) {
+  Retired *node = new Retired{
+      ptr, deleter, this->epoch.load(std::memory_order_seq_cst), nullptr};
+
+  Retired *top = this->retired.load(std::memory_order_relaxed);
+  do {
+    node->next = top;
+  } while (!this->retired.compare_exchange_weak(
+      top, node, std::memory_order_release, std::memory_order_relaxed));
+
+  this->waiting.fetch_add(1, std::memory_order_relaxed);
+  if (this->since_collect.fetch_add(1, std::memory_order_relaxed) + 1 >=
+      collect_every) {
+    this->since_collect.store(0, std::memory_order_relaxed);
+    this->collect();
+  }
+}
+
+// Advance the epoch when possible and free what is old enough
+inline void EpochDomain::collect() {
+  this->try_advance();
+  this->free_retired(false);
+}
+
+// Free everything retired, whatever its epoch
+inline void EpochDomain::drain() { this->free_retired(true); }
+
+#endif
@@ -1,89 +1,146 @@
 #ifndef ITERATOR_H
 #define ITERATOR_H
 
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 
-// Iterator
+// Bounds checking policy: on in debug builds, off when NDEBUG is defined.
+// Define ITERATOR_CHECKED=0/1 before including to override it.
+#ifndef ITERATOR_CHECKED
+#ifdef NDEBUG
+#define ITERATOR_CHECKED 0
+#else
+#define ITERATOR_CHECKED 1
+#endif
+#endif
+
+// Iterator (random access over [0, size), size is the one-past-the-end index;
+// Checked = false is the thin pointer specialization below, no throws)
 
-template <class T> class Iterator {
+template <class T, bool Checked = ITERATOR_CHECKED> class Iterator {
 private:
   T *iter;
   int index;
   int size;
-  bool found;
 
 public:
+  // iterator traits
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_cv_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  static constexpr bool is_checked = Checked;
+
   // constructors
-  inline Iterator<T>(T *iter, const int size, const int index = 0,
-                     const bool found = false)
-      : iter(iter), size(size), index(index), found(found) {
-    if (index < 0 || index > size)
+  inline Iterator<T, Checked>() : iter(nullptr), index(0), size(0){};
+  inline Iterator<T, Checked>(T *iter, const int size, const int index = 0)
+      : iter(iter), index(index), size(size) {
+    if (Checked && (index < 0 || index > size))
       throw std::out_of_range("Index is out of range!");
   };
 
-  inline Iterator<T>(const Iterator<T> &it, const bool found = false)
-      : iter(it.iter), size(it.size), index(it.index), found(found) {
-    if (index < 0 || index > size)
-      throw std::out_of_range("Index is out of range!");
-  };
+  // conversion of an iterator over T to one over const T
+  template <class U, class = std::enable_if_t<std::is_same<const U, T>::value &&
+                                              !std::is_same<U, T>::value>>
+  inline Iterator<T, Checked>(const Iterator<U, Checked> &other)
+      : iter(other.get_iterable()), index(other.get_index()),
+        size(other.get_size()){};
 
   // getters
   inline T *get_iterable() const { return this->iter; }
   inline int get_size() const { return this->size; }
   inline int get_index() const { return this->index; }
+  inline T *get_pointer() const { return this->iter + this->index; }
 
-  // increment operator
-  inline Iterator<T> &operator++() {
+  // increment operators
+  inline Iterator<T, Checked> &operator++() {
     ++this->index;
     return *this;
   }
 
-  // decrement operator
-  inline Iterator<T> &operator--() {
+  inline Iterator<T, Checked> operator++(int) {
+    Iterator<T, Checked> temp = *this;
+    ++this->index;
+    return temp;
+  }
+
+  // decrement operators
+  inline Iterator<T, Checked> &operator--() {
     --this->index;
     return *this;
   }
 
+  inline Iterator<T, Checked> operator--(int) {
+    Iterator<T, Checked> temp = *this;
+    --this->index;
+    return temp;
+  }
+
   // get operators
   inline T &operator*() const {
-    if (this->index < 0 || this->index > this->size)
+    if (Checked && (this->index < 0 || this->index >= this->size))
       throw std::out_of_range("Index is out of range!");
 
     return this->iter[this->index];
   }
 
   inline T *operator->() const {
-    if (this->index < 0 || this->index >= this->size)
+    if (Checked && (this->index < 0 || this->index >= this->size))
       throw std::out_of_range("Index is out of range!");
 
     return &this->iter[this->index];
   }
 
-  // adding operation
-  inline Iterator<T> operator+(const int &value) const {
-    int new_index = this->index + value;
-    if (new_index < 0 || new_index > this->size)
+  inline T &operator[](const difference_type &n) const {
+    return *(*this + n);
+  }
+
+  // compound assignment operations
+  inline Iterator<T, Checked> &operator+=(const difference_type &value) {
+    difference_type new_index = this->index + value;
+    if (Checked && (new_index < 0 || new_index > this->size))
       throw std::out_of_range("Resulting index cannot be out of range!");
 
-    return Iterator<T>(this->iter, this->size, new_index);
+    this->index = static_cast<int>(new_index);
+    return *this;
   }
 
-  // substraction operation
-  inline Iterator<T> operator-(const int &value) const {
-    int new_index = this->index - value;
-    if (new_index < 0 || new_index > this->size)
-      throw std::out_of_range("Resulting index cannot be out of range!");
+  inline Iterator<T, Checked> &operator-=(const difference_type &value) {
+    return *this += -value;
+  }
 
-    return Iterator<T>(this->iter, this->size, new_index);
+  // adding operation
+  inline Iterator<T, Checked> operator+(const difference_type &value) const {
+    Iterator<T, Checked> temp = *this;
+    return temp += value;
   }
 
-  // advance method
-  inline static void advance(Iterator<T> &it, int pos) {
+  inline friend Iterator<T, Checked> operator+(const difference_type &value,
+                                               const Iterator<T, Checked> &it) {
+    return it + value;
+  }
+
+  // substraction operations
+  inline Iterator<T, Checked> operator-(const difference_type &value) const {
+    Iterator<T, Checked> temp = *this;
+    return temp -= value;
+  }
+
+  inline difference_type operator-(const Iterator<T, Checked> &other) const {
+    return static_cast<difference_type>(this->index) - other.index;
+  }
+
+  // advance method (stops at begin and end)
+  inline static void advance(Iterator<T, Checked> &it, int pos) {
     int n = pos;
     if (pos > 0) {
-      int remaining = it.size - it.index - 1;
-      n = std::min(pos, remaining);
+      n = std::min(pos, it.size - it.index);
     } else {
       n = std::max(pos, -static_cast<int>(it.index));
     }
@@ -92,35 +149,149 @@ public:
   };
 
   // equals to
-  inline bool operator==(const Iterator<T> &other) const {
-    return this->iter == other.iter && this->index == other.index &&
-           this->found == other.found;
+  inline bool operator==(const Iterator<T, Checked> &other) const {
+    return this->iter == other.iter && this->index == other.index;
   }
 
   // not equals to
-  inline bool operator!=(const Iterator<T> &other) const {
+  inline bool operator!=(const Iterator<T, Checked> &other) const {
     return !(*this == other);
   }
 
   // less than
-  inline bool operator<(const Iterator<T> &other) const {
+  inline bool operator<(const Iterator<T, Checked> &other) const {
     return this->index < other.index;
   }
 
   // greater than
-  inline bool operator>(const Iterator<T> &other) const {
+  inline bool operator>(const Iterator<T, Checked> &other) const {
     return this->index > other.index;
   }
 
   // less equal than
-  inline bool operator<=(const Iterator<T> &other) const {
+  inline bool operator<=(const Iterator<T, Checked> &other) const {
     return this->index <= other.index;
   }
 
   // greater equal than
-  inline bool operator>=(const Iterator<T> &other) const {
+  inline bool operator>=(const Iterator<T, Checked> &other) const {
     return this->index >= other.index;
   }
 };
 
+// Unchecked iterator (only the pointer to the current element, as cheap as a
+// raw pointer; containers check the positions they are given themselves)
+
+template <class T> class Iterator<T, false> {
+private:
+  T *ptr;
+
+public:
+  // iterator traits
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_cv_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  static constexpr bool is_checked = false;
+
+  // constructors (size is not kept, nothing is checked)
+  inline Iterator<T, false>() : ptr(nullptr){};
+  inline Iterator<T, false>(T *iter, const int size, const int index = 0)
+      : ptr(iter + index) {
+    (void)size;
+  };
+
+  // conversion of an iterator over T to one over const T
+  template <class U, class = std::enable_if_t<std::is_same<const U, T>::value &&
+                                              !std::is_same<U, T>::value>>
+  inline Iterator<T, false>(const Iterator<U, false> &other)
+      : ptr(other.get_pointer()){};
+
+  // getters
+  inline T *get_pointer() const { return this->ptr; }
+
+  // increment operators
+  inline Iterator<T, false> &operator++() {
+    ++this->ptr;
+    return *this;
+  }
+
+  inline Iterator<T, false> operator++(int) {
+    Iterator<T, false> temp = *this;
+    ++this->ptr;
+    return temp;
+  }
+
+  // decrement operators
+  inline Iterator<T, false> &operator--() {
+    --this->ptr;
+    return *this;
+  }
+
+  inline Iterator<T, false> operator--(int) {
+    Iterator<T, false> temp = *this;
+    --this->ptr;
+    return temp;
+  }
+
+  // get operators
+  inline T &operator*() const { return *this->ptr; }
+  inline T *operator->() const { return this->ptr; }
+  inline T &operator[](const difference_type &n) const { return this->ptr[n]; }
+
+  // compound assignment operations
+  inline Iterator<T, false> &operator+=(const difference_type &value) {
+    this->ptr += value;
+    return *this;
+  }
+
+  inline Iterator<T, false> &operator-=(const difference_type &value) {
+    this->ptr -= value;
+    return *this;
+  }
+
+  // adding operation
+  inline Iterator<T, false> operator+(const difference_type &value) const {
+    Iterator<T, false> temp = *this;
+    return temp += value;
+  }
+
+  inline friend Iterator<T, false> operator+(const difference_type &value,
+                                             const Iterator<T, false> &it) {
+    return it + value;
+  }
+
+  // substraction operations
+  inline Iterator<T, false> operator-(const difference_type &value) const {
+    Iterator<T, false> temp = *this;
+    return temp -= value;
+  }
+
+  inline difference_type operator-(const Iterator<T, false> &other) const {
+    return this->ptr - other.ptr;
+  }
+
+  // comparison operators
+  inline bool operator==(const Iterator<T, false> &other) const {
+    return this->ptr == other.ptr;
+  }
+  inline bool operator!=(const Iterator<T, false> &other) const {
+    return this->ptr != other.ptr;
+  }
+  inline bool operator<(const Iterator<T, false> &other) const {
+    return this->ptr < other.ptr;
+  }
+  inline bool operator>(const Iterator<T, false> &other) const {
+    return this->ptr > other.ptr;
+  }
+  inline bool operator<=(const Iterator<T, false> &other) const {
+    return this->ptr <= other.ptr;
+  }
+  inline bool operator>=(const Iterator<T, false> &other) const {
+    return this->ptr >= other.ptr;
+  }
+};
+
 #endif
@@ -1,27 +1,37 @@
 #ifndef LISTITERATOR_H
 #define LISTITERATOR_H
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
 
 template <typename T> struct ListNode;
 template <typename T> class LinkedList;
 
-// List Iterator (doubly linked list)
+// List Iterator (doubly linked list, bidirectional; end() holds nullptr and
+// the list, so --end() is the tail)
 
 template <class T> class ListIterator {
 private:
   ListNode<T> *node;
-  bool found;
+  const LinkedList<T> *list;
 
 public:
+  // iterator traits
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
   // constructors
+  inline ListIterator<T>() : node(nullptr), list(nullptr){};
   inline ListIterator<T>(const LinkedList<T> &list)
-      : node(list.get_head()), found(false){};
-  inline ListIterator<T>(ListNode<T> *node, const bool found = false)
-      : node(node), found(found){};
-  inline ListIterator<T>(const ListIterator<T> &lit, const bool found = false)
-      : node(lit.node), found(found){};
+      : node(list.get_head()), list(&list){};
+  inline ListIterator<T>(ListNode<T> *node,
+                         const LinkedList<T> *list = nullptr)
+      : node(node), list(list){};
 
   // getters
   inline ListNode<T> *get_node() const { return this->node; }
@@ -34,7 +44,7 @@ public:
     return *this;
   }
 
-  inline ListIterator<T> &operator++(int) {
+  inline ListIterator<T> operator++(int) {
     ListIterator<T> temp = *this;
     ++(*this);
     return temp;
@@ -44,11 +54,13 @@ public:
   inline ListIterator<T> &operator--() {
     if (node)
       node = node->prev;
+    else if (list)
+      node = list->get_tail();
 
     return *this;
   }
 
-  inline ListIterator<T> &operator--(int) {
+  inline ListIterator<T> operator--(int) {
     ListIterator<T> temp = *this;
     --(*this);
     return temp;
@@ -69,30 +81,35 @@ public:
     return &(this->node->data);
   }
 
-  // adding operation
+  // adding operation (stops at the last node)
   inline ListIterator<T> operator+(const int &value) const {
     if (value < 0)
       throw std::invalid_argument("Position argument should not be < 0!");
 
     int n = value;
     ListNode<T> *temp = this->node;
-    while (n-- && temp->next != nullptr)
+    while (n-- && temp != nullptr && temp->next != nullptr)
       temp = temp->next;
 
-    return ListIterator<T>(temp);
+    return ListIterator<T>(temp, this->list);
   }
 
-  // substraction operation
+  // substraction operation (stops at the first node)
   inline ListIterator<T> operator-(const int &value) const {
     if (value < 0)
       throw std::invalid_argument("Position argument should not be < 0!");
 
     int n = value;
-    ListNode<T> *temp = this->node;
-    while (n-- && temp->prev != nullptr)
-      temp = temp->prev;
+    ListIterator<T> temp = *this;
+    if (temp.node == nullptr && n > 0) {
+      --temp;
+      --n;
+    }
+
+    while (n-- && temp.node != nullptr && temp.node->prev != nullptr)
+      temp.node = temp.node->prev;
 
-    return ListIterator<T>(temp);
+    return temp;
   }
 
   // advance method
@@ -116,7 +133,7 @@ public:
 
   // equals to
   inline bool operator==(const ListIterator<T> &other) const {
-    return this->node == other.node && this->found == other.found;
+    return this->node == other.node;
   }
 
   // not equals to
@@ -0,0 +1,17 @@
+/*
+
+List sort helpers work on a chain of nodes linked by next (any node type with
+data and next members, so both ListNode and QueueNode). They only relink
+nodes: sorting never allocates and never copies an element.
+
+The merge sort is bottom-up and needs no recursion, only a fixed array of 64
+runs where run i is either empty or a sorted run of 2^i nodes. Every node is
+added like a carry into a binary counter: it is merged with run 0, the
+result with run 1, and so on until an empty run is found. Small runs are
+merged right after they were built, while their nodes are still in cache.
+Merging takes the node from the earlier run on ties, which makes the sort
+stable.
+
+*/
+
+int main() { return 0; }
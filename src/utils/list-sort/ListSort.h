@@ -0,0 +1,64 @@
+#ifndef LISTSORT_H
+#define LISTSORT_H
+
+// Merge two sorted chains (stable: on ties the node from a goes first),
+// returns the head of the result
+
+template <class Node, class Compare>
+Node *merge_chains(Node *a, Node *b, Compare &comp) {
+  Node *head = nullptr, **link = &head;
+
+  while (a != nullptr && b != nullptr) {
+    if (comp(b->data, a->data)) {
+      *link = b;
+      b = b->next;
+    } else {
+      *link = a;
+      a = a->next;
+    }
+
+    link = &(*link)->next;
+  }
+
+  *link = a != nullptr ? a : b;
+  return head;
+}
+
+// Bottom-up merge sort of a chain (stable, O(n log n), no allocation),
+// returns the head of the result. runs[i] holds a sorted run of 2^i nodes or
+// nothing: every node is merged into the runs like a carry into a binary
+// counter, so small runs are merged while they are still in cache and the
+// chain is never walked just to split it.
+
+template <class Node, class Compare>
+Node *merge_sort_chain(Node *head, Compare &comp) {
+  Node *runs[64] = {};
+  int used = 0;
+
+  while (head != nullptr) {
+    Node *carry = head;
+    head = head->next;
+    carry->next = nullptr;
+
+    int i = 0;
+    for (; i < used && runs[i] != nullptr; i++) {
+      carry = merge_chains(runs[i], carry, comp);
+      runs[i] = nullptr;
+    }
+
+    runs[i] = carry;
+    if (i == used)
+      used++;
+  }
+
+  // lower runs hold later nodes, so they go second to keep the sort stable
+  Node *result = nullptr;
+  for (int i = 0; i < used; i++) {
+    if (runs[i] != nullptr)
+      result = result == nullptr ? runs[i] : merge_chains(runs[i], result, comp);
+  }
+
+  return result;
+}
+
+#endif
@@ -0,0 +1,13 @@
+/*
+
+A match mask is a bitmap with one bit per element of a container: bit i is
+set when element i matched a query. It stores 64 results per machine word,
+so a search that matches millions of elements costs n / 8 bytes instead of
+one iterator (or index) per match. The bits are filled a word at a time
+without branches, which lets the compiler vectorize the comparison loop for
+arithmetic types, and counting/visiting the matches uses popcount and
+count-trailing-zeros.
+
+*/
+
+int main() { return 0; }
@@ -0,0 +1,213 @@
+#ifndef MATCHMASK_H
+#define MATCHMASK_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+// Match mask (one bit per element, 64 elements per word)
+
+class MatchMask {
+private:
+  std::vector<std::uint64_t> words;
+  int size;
+
+  // bit helper functions
+  static inline int popcount(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    for (; word != 0; word &= word - 1)
+      count++;
+
+    return count;
+#endif
+  }
+
+  static inline int lowest_bit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while ((word & 1) == 0) {
+      word >>= 1;
+      bit++;
+    }
+
+    return bit;
+#endif
+  }
+
+public:
+  // constructors
+  inline explicit MatchMask(const int size = 0) : size(size) {
+    if (size < 0)
+      throw std::invalid_argument("Size should not be < 0!");
+
+    this->words.assign((size + 63) / 64, 0);
+  };
+
+  // build from contiguous data and a predicate (branchless, word by word)
+  template <class T, class Fn>
+  static MatchMask build(const T *data, const int size, Fn fn);
+  template <class T>
+  static MatchMask equal(const T *data, const int size, const T &value) {
+    return MatchMask::build(data, size,
+                            [&value](const T &x) { return x == value; });
+  }
+
+  // getters
+  inline int get_size() const { return this->size; }
+  inline const std::vector<std::uint64_t> &get_words() const {
+    return this->words;
+  }
+
+  // bit methods
+  inline bool test(const int &index) const;
+  inline void set(const int &index);
+  inline void reset(const int &index);
+
+  // bool methods
+  inline bool any() const;
+  inline bool none() const { return !this->any(); }
+
+  // useful methods
+  inline int count() const;
+  inline int first() const;
+  template <class Fn> void for_each(Fn fn) const;
+  inline std::vector<int> to_indices() const;
+
+  // combine masks
+  inline MatchMask operator&(const MatchMask &other) const;
+  inline MatchMask operator|(const MatchMask &other) const;
+
+  // compare methods
+  inline bool operator==(const MatchMask &other) const {
+    return this->size == other.size && this->words == other.words;
+  }
+  inline bool operator!=(const MatchMask &other) const {
+    return !(*this == other);
+  }
+};
+
+// ---------
+// Methods
+// ---------
+
+// Build a mask from a predicate
+template <class T, class Fn>
+MatchMask MatchMask::build(const T *data, const int size, Fn fn) {
+  MatchMask mask(size);
+
+  for (int base = 0; base < size; base += 64) {
+    const int n = std::min(64, size - base);
+    const T *block = data + base;
+
+    std::uint64_t word = 0;
+    for (int j = 0; j < n; j++)
+      word |= static_cast<std::uint64_t>(fn(block[j]) ? 1 : 0) << j;
+
+    mask.words[base / 64] = word;
+  }
+
+  return mask;
+}
+
+// Test bit
+inline bool MatchMask::test(const int &index) const {
+  if (index < 0 || index >= this->size)
+    throw std::out_of_range("Provided index is out of range!");
+
+  return (this->words[index / 64] >> (index % 64)) & 1;
+}
+
+// Set bit
+inline void MatchMask::set(const int &index) {
+  if (index < 0 || index >= this->size)
+    throw std::out_of_range("Provided index is out of range!");
+
+  this->words[index / 64] |= std::uint64_t(1) << (index % 64);
+}
+
+// Reset bit
+inline void MatchMask::reset(const int &index) {
+  if (index < 0 || index >= this->size)
+    throw std::out_of_range("Provided index is out of range!");
+
+  this->words[index / 64] &= ~(std::uint64_t(1) << (index % 64));
+}
+
+// Any bit set
+inline bool MatchMask::any() const {
+  for (std::uint64_t word : this->words) {
+    if (word != 0)
+      return true;
+  }
+
+  return false;
+}
+
+// Count set bits
+inline int MatchMask::count() const {
+  int count = 0;
+  for (std::uint64_t word : this->words)
+    count += MatchMask::popcount(word);
+
+  return count;
+}
+
+// Index of the first set bit (-1 if none)
+inline int MatchMask::first() const {
+  for (int i = 0; i < static_cast<int>(this->words.size()); i++) {
+    if (this->words[i] != 0)
+      return i * 64 + MatchMask::lowest_bit(this->words[i]);
+  }
+
+  return -1;
+}
+
+// Visit every set bit in increasing order
+template <class Fn> void MatchMask::for_each(Fn fn) const {
+  for (int i = 0; i < static_cast<int>(this->words.size()); i++) {
+    for (std::uint64_t word = this->words[i]; word != 0; word &= word - 1)
+      fn(i * 64 + MatchMask::lowest_bit(word));
+  }
+}
+
+// Indexes of all set bits
+inline std::vector<int> MatchMask::to_indices() const {
+  std::vector<int> indices;
+  indices.reserve(this->count());
+  this->for_each([&indices](const int index) { indices.push_back(index); });
+
+  return indices;
+}
+
+// Intersection
+inline MatchMask MatchMask::operator&(const MatchMask &other) const {
+  if (this->size != other.size)
+    throw std::invalid_argument("Masks should be of the same size!");
+
+  MatchMask result(this->size);
+  for (int i = 0; i < static_cast<int>(this->words.size()); i++)
+    result.words[i] = this->words[i] & other.words[i];
+
+  return result;
+}
+
+// Union
+inline MatchMask MatchMask::operator|(const MatchMask &other) const {
+  if (this->size != other.size)
+    throw std::invalid_argument("Masks should be of the same size!");
+
+  MatchMask result(this->size);
+  for (int i = 0; i < static_cast<int>(this->words.size()); i++)
+    result.words[i] = this->words[i] | other.words[i];
+
+  return result;
+}
+
+#endif
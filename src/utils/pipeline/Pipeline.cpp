@@ -0,0 +1,14 @@
+/*
+
+A pipeline is a lazy chain of operations (filter, map, take) over a view of
+contiguous memory. Nothing is computed while the chain is being built: each
+stage only wraps the next one, and a terminal operation (reduce, count,
+for_each, collect) runs all stages fused into a single loop over the source.
+No intermediate arrays are allocated between stages.
+
+Without take(), the stages do not depend on the order of elements, so the
+source can be split into chunks and reduced on several threads.
+
+*/
+
+int main() { return 0; }
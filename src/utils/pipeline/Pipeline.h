@@ -0,0 +1,249 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <ArrayView.h>
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+template <typename T, int N> class DynamicArray;
+
+// Pipeline stages (each stage wraps the sink of the next one)
+
+struct IdentityStage {
+  template <class Sink> inline Sink wrap(Sink sink) const { return sink; }
+};
+
+template <class Prev, class Fn> struct FilterStage {
+  Prev prev;
+  Fn fn;
+
+  template <class Sink> inline auto wrap(Sink sink) const {
+    return prev.wrap([fn = this->fn, sink](const auto &value) mutable {
+      return fn(value) ? sink(value) : true;
+    });
+  }
+};
+
+template <class Prev, class Fn> struct MapStage {
+  Prev prev;
+  Fn fn;
+
+  template <class Sink> inline auto wrap(Sink sink) const {
+    return prev.wrap([fn = this->fn, sink](const auto &value) mutable {
+      return sink(fn(value));
+    });
+  }
+};
+
+template <class Prev> struct TakeStage {
+  Prev prev;
+  int n;
+
+  template <class Sink> inline auto wrap(Sink sink) const {
+    return prev.wrap([n = this->n, taken = 0, sink](const auto &value) mutable {
+      if (taken >= n)
+        return false;
+
+      ++taken;
+      return sink(value) && taken < n;
+    });
+  }
+};
+
+// Lazy pipeline over a read-only view
+
+template <class T, class Out = T, class Stage = IdentityStage> class Pipeline {
+private:
+  ArrayView<const T> source;
+  Stage stage;
+  int limit;
+
+  // run fused stages over [from, to) of the source
+  template <class Sink> void run(int from, int to, Sink sink) const;
+
+public:
+  // constructors
+  inline explicit Pipeline<T, Out, Stage>(const ArrayView<const T> &source,
+                                          const Stage &stage = Stage(),
+                                          const int limit = -1)
+      : source(source), stage(stage), limit(limit){};
+
+  // getters
+  inline const ArrayView<const T> &get_source() const {
+    return this->source;
+  }
+  inline bool is_ordered() const { return this->limit >= 0; }
+
+  // lazy stages
+  template <class Fn>
+  Pipeline<T, Out, FilterStage<Stage, Fn>> filter(Fn fn) const;
+  template <class Fn>
+  Pipeline<T, std::decay_t<std::invoke_result_t<Fn, const Out &>>,
+           MapStage<Stage, Fn>>
+  map(Fn fn) const;
+  Pipeline<T, Out, TakeStage<Stage>> take(const int &n) const;
+
+  // terminal operations
+  template <class U, class Fn> U reduce(U init, Fn fn) const;
+  template <class Fn> void for_each(Fn fn) const;
+  int count() const;
+  DynamicArray<Out, 0> collect() const;
+
+  // chunk-parallel reduce (fn and combine must be associative)
+  template <class U, class Fn, class Combine>
+  U parallel_reduce(U identity, Fn fn, Combine combine,
+                    const int &threads = 0) const;
+};
+
+// ---------
+// Stages
+// ---------
+
+// Keep elements that satisfy the predicate
+template <class T, class Out, class Stage>
+template <class Fn>
+Pipeline<T, Out, FilterStage<Stage, Fn>>
+Pipeline<T, Out, Stage>::filter(Fn fn) const {
+  return Pipeline<T, Out, FilterStage<Stage, Fn>>(
+      this->source, FilterStage<Stage, Fn>{this->stage, fn}, this->limit);
+}
+
+// Transform elements
+template <class T, class Out, class Stage>
+template <class Fn>
+Pipeline<T, std::decay_t<std::invoke_result_t<Fn, const Out &>>,
+         MapStage<Stage, Fn>>
+Pipeline<T, Out, Stage>::map(Fn fn) const {
+  return Pipeline<T, std::decay_t<std::invoke_result_t<Fn, const Out &>>,
+                  MapStage<Stage, Fn>>(
+      this->source, MapStage<Stage, Fn>{this->stage, fn}, this->limit);
+}
+
+// Stop after the first n elements
+template <class T, class Out, class Stage>
+Pipeline<T, Out, TakeStage<Stage>>
+Pipeline<T, Out, Stage>::take(const int &n) const {
+  if (n < 0)
+    throw std::invalid_argument("n should not be < 0!");
+
+  int limit = this->limit < 0 ? n : std::min(this->limit, n);
+  return Pipeline<T, Out, TakeStage<Stage>>(
+      this->source, TakeStage<Stage>{this->stage, n}, limit);
+}
+
+// ---------
+// Terminal operations
+// ---------
+
+// Run stages over a part of the source
+template <class T, class Out, class Stage>
+template <class Sink>
+void Pipeline<T, Out, Stage>::run(int from, int to, Sink sink) const {
+  auto fused = this->stage.wrap(sink);
+  const T *data = this->source.get_data();
+  int stride = this->source.get_stride();
+
+  for (int i = from; i < to; i++) {
+    if (!fused(data[i * stride]))
+      return;
+  }
+}
+
+// Reduce
+template <class T, class Out, class Stage>
+template <class U, class Fn>
+U Pipeline<T, Out, Stage>::reduce(U init, Fn fn) const {
+  this->run(0, this->source.get_size(), [&init, &fn](const Out &value) {
+    init = fn(init, value);
+    return true;
+  });
+
+  return init;
+}
+
+// Call function for every element
+template <class T, class Out, class Stage>
+template <class Fn>
+void Pipeline<T, Out, Stage>::for_each(Fn fn) const {
+  this->run(0, this->source.get_size(), [&fn](const Out &value) {
+    fn(value);
+    return true;
+  });
+}
+
+// Count elements
+template <class T, class Out, class Stage>
+int Pipeline<T, Out, Stage>::count() const {
+  return this->reduce(0, [](int count, const Out &) { return count + 1; });
+}
+
+// Collect elements into an array (single allocation)
+template <class T, class Out, class Stage>
+DynamicArray<Out, 0> Pipeline<T, Out, Stage>::collect() const {
+  int capacity = this->source.get_size();
+  if (this->limit >= 0)
+    capacity = std::min(capacity, this->limit);
+
+  DynamicArray<Out, 0> result(capacity);
+  this->run(0, this->source.get_size(), [&result](const Out &value) {
+    result.push_back(value);
+    return true;
+  });
+
+  return result;
+}
+
+// Reduce chunks of the source on several threads
+template <class T, class Out, class Stage>
+template <class U, class Fn, class Combine>
+U Pipeline<T, Out, Stage>::parallel_reduce(U identity, Fn fn, Combine combine,
+                                           const int &threads) const {
+  if (this->is_ordered())
+    throw std::logic_error("Pipeline with take() cannot run in parallel!");
+
+  int size = this->source.get_size();
+  int count = threads > 0 ? threads
+                          : std::max(1u, std::thread::hardware_concurrency());
+  count = std::max(1, std::min(count, size));
+
+  int chunk = (size + count - 1) / count;
+  std::vector<U> partial(count, identity);
+  std::vector<std::exception_ptr> errors(count);
+  std::vector<std::thread> workers;
+
+  for (int t = 0; t < count; t++) {
+    workers.emplace_back([this, t, chunk, size, &partial, &errors, &fn]() {
+      try {
+        U &acc = partial[t];
+        this->run(t * chunk, std::min(size, (t + 1) * chunk),
+                  [&acc, &fn](const Out &value) {
+                    acc = fn(acc, value);
+                    return true;
+                  });
+      } catch (...) {
+        errors[t] = std::current_exception();
+      }
+    });
+  }
+
+  for (std::thread &worker : workers)
+    worker.join();
+
+  for (std::exception_ptr &error : errors) {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  U result = identity;
+  for (const U &value : partial)
+    result = combine(result, value);
+
+  return result;
+}
+
+#endif
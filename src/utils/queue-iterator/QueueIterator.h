@@ -1,32 +1,37 @@
 #ifndef QUEUEITERATOR_H
 #define QUEUEITERATOR_H
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
 
 template <typename T> struct QueueNode;
 template <typename T> class Queue;
 
-// Queue Iterator (singly linked list)
+// Queue Iterator (singly linked list, forward; end() holds nullptr)
 
 template <class T> class QueueIterator {
 private:
   QueueNode<T> *node;
-  bool found;
 
 public:
+  // iterator traits
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
   // constructors
-  inline QueueIterator<T>(const Queue<T> &queue)
-      : node(queue.get_head()), found(false){};
-  inline QueueIterator<T>(QueueNode<T> *node, const bool found = false)
-      : node(node), found(found){};
-  inline QueueIterator<T>(const QueueIterator<T> &qit, const bool found = false)
-      : node(qit.node), found(found){};
+  inline QueueIterator<T>() : node(nullptr){};
+  inline QueueIterator<T>(const Queue<T> &queue) : node(queue.get_head()){};
+  inline QueueIterator<T>(QueueNode<T> *node) : node(node){};
 
   // getters
   inline QueueNode<T> *get_node() const { return this->node; }
 
-  // increment operator
+  // increment operators
   inline QueueIterator<T> &operator++() {
     if (this->node != nullptr)
       this->node = this->node->next;
@@ -34,18 +39,24 @@ public:
     return *this;
   }
 
+  inline QueueIterator<T> operator++(int) {
+    QueueIterator<T> temp = *this;
+    ++(*this);
+    return temp;
+  }
+
   // get operator
   inline T &operator*() const { return this->node->data; }
   inline T *operator->() const { return &(this->node->data); }
 
-  // adding operation
+  // adding operation (stops at the last node)
   inline QueueIterator<T> operator+(const int &value) const {
     if (value < 0)
       throw std::invalid_argument("Position argument should not be < 0!");
 
     int n = value;
     QueueNode<T> *temp = this->node;
-    while (n-- && temp->next != nullptr)
+    while (n-- && temp != nullptr && temp->next != nullptr)
       temp = temp->next;
 
     return QueueIterator<T>(temp);
@@ -56,13 +67,13 @@ public:
     if (pos < 0)
       throw std::invalid_argument("Position argument should not be < 0!");
 
-    while (pos-- && it.node->next != nullptr)
+    while (pos-- && it.node != nullptr && it.node->next != nullptr)
       it.node = it.node->next;
   };
 
   // equals to
   inline bool operator==(const QueueIterator<T> &other) const {
-    return this->node == other.node && this->found == other.found;
+    return this->node == other.node;
   }
 
   // not equals to
@@ -0,0 +1,174 @@
+#include <ArrayView.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(ArrayViewConstructors, DefaultConstructor) {
+  ArrayView<int> v;
+
+  EXPECT_EQ(v.get_data(), nullptr) << "Should not point anywhere!";
+  EXPECT_EQ(v.get_size(), 0) << "Should be 0 sized!";
+  EXPECT_TRUE(v.is_empty()) << "Should be empty!";
+}
+
+TEST(ArrayViewConstructors, PointerConstructor) {
+  int array[]{1, 2, 3, 4, 5, 6};
+  ArrayView<int> v(array, 6, 2);
+
+  EXPECT_EQ(v.get_data(), array) << "Should point at the array!";
+  EXPECT_EQ(v.get_size(), 6) << "Should be sized 6!";
+  EXPECT_EQ(v.get_stride(), 2) << "Should have stride 2!";
+  EXPECT_FALSE(v.is_contiguous()) << "Strided view is not contiguous!";
+
+  EXPECT_THROW(ArrayView<int>(array, -1), std::invalid_argument)
+      << "Should throw invalid_argument if length is negative!";
+  EXPECT_THROW(ArrayView<int>(array, 3, 0), std::invalid_argument)
+      << "Should throw invalid_argument if stride is not positive!";
+}
+
+TEST(ArrayViewConstructors, ReadOnlyConversion) {
+  int array[]{4, 1, 3};
+  ArrayView<int> v(array, 3);
+  ArrayView<const int> c = v;
+
+  EXPECT_EQ(c.get_data(), array) << "Should point at the array!";
+  EXPECT_EQ(c.to_vector(), std::vector<int>({4, 1, 3})) << "Same elements!";
+  EXPECT_EQ(c.max(), 4) << "Max should be 4!";
+  EXPECT_EQ(c.slice(1, 3).reduce(0), 4) << "Sum of 1, 3 should be 4!";
+  EXPECT_FALSE((std::is_convertible<ArrayView<const int>,
+                                    ArrayView<int>>::value))
+      << "Read-only view should not convert back!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(ArrayViewMethods, At) {
+  int array[]{1, 2, 3, 4, 5};
+  ArrayView<int> v(array, 5);
+
+  EXPECT_EQ(v.at(2), 3) << "3rd element should be 3!";
+  EXPECT_EQ(v[4], 5) << "5th element should be 5!";
+
+  v[0] = 10;
+  EXPECT_EQ(array[0], 10) << "Writes should go to the viewed array!";
+
+  EXPECT_THROW(v.at(5), std::out_of_range)
+      << "Should throw out_of_range if index is out of range!";
+  EXPECT_THROW(ArrayView<int>().at(0), std::length_error)
+      << "Should throw length_error if view is empty!";
+}
+
+TEST(ArrayViewMethods, Slice) {
+  int array[]{1, 2, 3, 4, 5, 6};
+  ArrayView<int> v(array, 6);
+
+  ArrayView<int> s = v.slice(1, 4);
+  EXPECT_EQ(s.get_data(), array + 1) << "Slice should not copy!";
+  EXPECT_EQ(s.to_vector(), std::vector<int>({2, 3, 4}))
+      << "Slice should contain elements [1, 4)!";
+  EXPECT_TRUE(v.slice(2, 2).is_empty()) << "Empty slice should be allowed!";
+
+  EXPECT_THROW(v.slice(-1, 2), std::out_of_range)
+      << "Should throw out_of_range if index is out of range!";
+  EXPECT_THROW(v.slice(0, 7), std::out_of_range)
+      << "Should throw out_of_range if index is out of range!";
+  EXPECT_THROW(v.slice(3, 2), std::invalid_argument)
+      << "Should throw invalid_argument if range is reversed!";
+}
+
+TEST(ArrayViewMethods, Strided) {
+  int array[]{1, 2, 3, 4, 5, 6, 7};
+  ArrayView<int> v(array, 7);
+
+  ArrayView<int> s = v.strided(3);
+  EXPECT_EQ(s.to_vector(), std::vector<int>({1, 4, 7}))
+      << "Should contain every 3rd element!";
+  EXPECT_EQ(s.slice(1, 3).to_vector(), std::vector<int>({4, 7}))
+      << "Slicing should keep the stride!";
+
+  EXPECT_THROW(v.strided(0), std::invalid_argument)
+      << "Should throw invalid_argument if step is not positive!";
+}
+
+TEST(ArrayViewMethods, ToString) {
+  int array[]{1, 2, 3};
+  ArrayView<int> v(array, 3);
+
+  EXPECT_EQ(v.to_string(), "1, 2, 3.") << "Should be formatted as an array!";
+  EXPECT_THROW(ArrayView<int>().to_string(), std::length_error)
+      << "Should throw length_error if view is empty!";
+}
+
+// ----------
+// Algorithms test
+// ----------
+
+TEST(ArrayViewAlgorithms, FindCountContains) {
+  int array[]{1, 2, 3, 2, 1, 2};
+  ArrayView<int> v(array, 6);
+
+  EXPECT_EQ(v.find(3), 2) << "3 should be at index 2!";
+  EXPECT_EQ(v.find(10), -1) << "Should return -1 if nothing was found!";
+  EXPECT_EQ(v.slice(3, 6).find(2), 0)
+      << "Index should be relative to the slice!";
+  EXPECT_EQ(v.count(2), 3) << "2 should occur 3 times!";
+  EXPECT_EQ(v.strided(2).count(2), 0) << "Even indexes do not contain 2!";
+  EXPECT_EQ(v.count_if([](int x) { return x > 1; }), 4)
+      << "4 elements should be > 1!";
+  EXPECT_TRUE(v.contains(3)) << "Should contain 3!";
+  EXPECT_FALSE(v.slice(3, 6).contains(3)) << "Slice should not contain 3!";
+}
+
+TEST(ArrayViewAlgorithms, ReduceMinMax) {
+  int array[]{5, 1, 9, 3, 7};
+  ArrayView<int> v(array, 5);
+
+  EXPECT_EQ(v.reduce(0), 25) << "Sum should be 25!";
+  EXPECT_EQ(v.slice(1, 3).reduce(1, [](int a, int b) { return a * b; }), 9)
+      << "Product of the slice should be 9!";
+  EXPECT_EQ(v.max(), 9) << "Max should be 9!";
+  EXPECT_EQ(v.min(), 1) << "Min should be 1!";
+  EXPECT_EQ(v.slice(2, 5).min(), 3) << "Min of the slice should be 3!";
+  EXPECT_EQ(v.strided(2).max(), 9) << "Max of the strided view should be 9!";
+
+  EXPECT_THROW(v.slice(0, 0).max(), std::length_error)
+      << "Should throw length_error if view is empty!";
+  EXPECT_THROW(v.slice(0, 0).min(), std::length_error)
+      << "Should throw length_error if view is empty!";
+}
+
+TEST(ArrayViewAlgorithms, Sort) {
+  int array[]{9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+  ArrayView<int> v(array, 10);
+
+  v.slice(2, 7).sort();
+  EXPECT_EQ(v.to_vector(), std::vector<int>({9, 8, 3, 4, 5, 6, 7, 2, 1, 0}))
+      << "Only the slice should be sorted!";
+
+  v.strided(2).sort(std::greater<int>());
+  EXPECT_EQ(v.strided(2).to_vector(), std::vector<int>({9, 7, 5, 3, 1}))
+      << "Strided elements should be sorted descending!";
+
+  std::string words[]{"delta", "alpha", "charlie", "bravo"};
+  ArrayView<std::string>(words, 4).sort();
+  EXPECT_EQ(words[0], "alpha") << "Strings should be sorted!";
+  EXPECT_EQ(words[3], "delta") << "Strings should be sorted!";
+}
+
+TEST(ArrayViewAlgorithms, Reverse) {
+  int array[]{1, 2, 3, 4, 5};
+  ArrayView<int> v(array, 5);
+
+  v.slice(1, 5).reverse();
+  EXPECT_EQ(v.to_vector(), std::vector<int>({1, 5, 4, 3, 2}))
+      << "Only the slice should be reversed!";
+}
@@ -0,0 +1,109 @@
+#include <EpochReclamation.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// counts the retired objects that were freed
+std::atomic<int> epoch_freed(0);
+
+struct EpochCounted {
+  ~EpochCounted() { epoch_freed++; }
+};
+
+// ----------
+// Methods test
+// ----------
+
+TEST(EpochReclamationMethods, GuardDefersFreeing) {
+  EpochDomain domain;
+  epoch_freed = 0;
+
+  {
+    EpochGuard guard(domain);
+    for (int i = 0; i < 10; i++)
+      domain.retire(new EpochCounted());
+
+    for (int i = 0; i < 5; i++)
+      domain.collect();
+
+    EXPECT_EQ(domain.get_waiting(), 10) << "Nothing freed inside a guard!";
+    EXPECT_EQ(epoch_freed.load(), 0) << "Nothing freed inside a guard!";
+    EXPECT_LE(domain.get_epoch(), 2u) << "Epoch moves at most once!";
+  }
+
+  for (int i = 0; i < 3; i++)
+    domain.collect();
+
+  EXPECT_EQ(domain.get_waiting(), 0) << "Everything freed after the guard!";
+  EXPECT_EQ(epoch_freed.load(), 10) << "Everything freed after the guard!";
+}
+
+TEST(EpochReclamationMethods, OtherThreadGuard) {
+  EpochDomain domain;
+  epoch_freed = 0;
+  std::atomic<bool> entered(false), release(false);
+
+  std::thread reader([&]() {
+    EpochGuard guard(domain);
+    entered.store(true);
+    while (!release.load())
+      std::this_thread::yield();
+  });
+
+  while (!entered.load())
+    std::this_thread::yield();
+
+  domain.retire(new EpochCounted());
+  for (int i = 0; i < 5; i++)
+    domain.collect();
+
+  EXPECT_EQ(epoch_freed.load(), 0) << "A reader may still see the node!";
+
+  release.store(true);
+  reader.join();
+  for (int i = 0; i < 3; i++)
+    domain.collect();
+
+  EXPECT_EQ(epoch_freed.load(), 1) << "Freed once the reader left!";
+}
+
+TEST(EpochReclamationMethods, SlotsGrow) {
+  EpochDomain domain;
+  epoch_freed = 0;
+  std::vector<std::unique_ptr<EpochGuard>> guards;
+
+  // more guards than one block of slots, a fixed table would spin forever
+  for (int i = 0; i < 2 * EpochDomain::slots + 1; i++)
+    guards.emplace_back(new EpochGuard(domain));
+
+  EXPECT_EQ(domain.get_slots(), 3 * EpochDomain::slots)
+      << "Two more blocks should be linked in!";
+
+  // only the guard in the last block is left
+  guards.erase(guards.begin(), guards.end() - 1);
+  domain.retire(new EpochCounted());
+  for (int i = 0; i < 3; i++)
+    domain.collect();
+
+  EXPECT_EQ(epoch_freed.load(), 0) << "Guards in grown blocks count too!";
+
+  guards.clear();
+  for (int i = 0; i < 3; i++)
+    domain.collect();
+
+  EXPECT_EQ(epoch_freed.load(), 1) << "Freed once every guard left!";
+}
+
+TEST(EpochReclamationMethods, DestructorFrees) {
+  epoch_freed = 0;
+  {
+    EpochDomain domain;
+    for (int i = 0; i < 3; i++)
+      domain.retire(new EpochCounted());
+  }
+
+  EXPECT_EQ(epoch_freed.load(), 3) << "Destructor should free the rest!";
+}
@@ -1,7 +1,9 @@
 #include <Iterator.h>
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 
 // ----------
 // Constructors test
@@ -12,14 +14,16 @@ TEST(IteratorConstructors, ArrayBasedConstructor) {
   int *int_array = new int[size]{1, 2, 3};
   Iterator<int> it1(int_array, size);
 
-  EXPECT_EQ(it1.get_index(), index) << "Index should be equal: " << index;
+  EXPECT_EQ(it1.get_pointer(), int_array + index)
+      << "Should point at index: " << index;
   for (int i = 0; i < 3; i++)
-    EXPECT_EQ(it1.get_iterable()[i], int_array[i])
-        << "Values of array should be equal!";
+    EXPECT_EQ(it1[i], int_array[i]) << "Values of array should be equal!";
 
   index = -99;
-  EXPECT_THROW(Iterator<int> it2(int_array, index), std::out_of_range)
-      << "Should throw out_of_range because index is negative!";
+  if (Iterator<int>::is_checked) {
+    EXPECT_THROW(Iterator<int> it2(int_array, index), std::out_of_range)
+        << "Should throw out_of_range because index is negative!";
+  }
 }
 
 TEST(IteratorConstructors, CopyConstructor) {
@@ -28,17 +32,17 @@ TEST(IteratorConstructors, CopyConstructor) {
   Iterator<int> it1(int_array, size);
 
   Iterator<int> it2(it1);
-  EXPECT_EQ(it2.get_index(), it1.get_index())
-      << "Indexes should be equal: " << it1.get_index();
+  EXPECT_TRUE(it2 == it1) << "Copies should point at the same element!";
 
   for (int i = 0; i < size; i++)
-    EXPECT_EQ(it2.get_iterable()[i], it1.get_iterable()[i])
-        << "Values should be equal!";
+    EXPECT_EQ(it2[i], it1[i]) << "Values should be equal!";
 
   index = -99;
-  EXPECT_THROW(Iterator<int> it4(Iterator<int>(int_array, size, index)),
-               std::out_of_range)
-      << "Should throw out_of_range because index is negative!";
+  if (Iterator<int>::is_checked) {
+    EXPECT_THROW(Iterator<int> it4(Iterator<int>(int_array, size, index)),
+                 std::out_of_range)
+        << "Should throw out_of_range because index is negative!";
+  }
 }
 
 // ----------
@@ -48,7 +52,7 @@ TEST(IteratorConstructors, CopyConstructor) {
 TEST(IteratorGetters, GetIterable) {
   int size = 3;
   int *int_array = new int[size]{1, 2, 3};
-  Iterator<int> it(int_array, size);
+  Iterator<int, true> it(int_array, size);
 
   EXPECT_EQ(it.get_iterable(), int_array) << "Should return int array!";
 }
@@ -56,11 +60,19 @@ TEST(IteratorGetters, GetIterable) {
 TEST(IteratorGetters, GetIndex) {
   int size = 3;
   int *int_array = new int[size]{1, 2, 3};
-  Iterator<int> it(int_array, size, 2);
+  Iterator<int, true> it(int_array, size, 2);
 
   EXPECT_EQ(it.get_index(), 2) << "Should return index 2!";
 }
 
+TEST(IteratorGetters, GetPointer) {
+  int size = 3;
+  int *int_array = new int[size]{1, 2, 3};
+  Iterator<int> it(int_array, size, 2);
+
+  EXPECT_EQ(it.get_pointer(), int_array + 2) << "Should point at index 2!";
+}
+
 // ----------
 // Methods test
 // ----------
@@ -71,7 +83,8 @@ TEST(IteratorMethods, IncrementOperator) {
   Iterator<int> it(int_array, size);
   ++it;
 
-  EXPECT_EQ(it.get_index(), 1) << "Should be at 2nd element!";
+  EXPECT_EQ(it - Iterator<int>(int_array, size), 1)
+      << "Should be at 2nd element!";
 }
 
 TEST(IteratorMethods, DecrementOperator) {
@@ -80,7 +93,8 @@ TEST(IteratorMethods, DecrementOperator) {
   Iterator<int> it(int_array, size, size);
   --it;
 
-  EXPECT_EQ(it.get_index(), 2) << "Should be at 2nd element!";
+  EXPECT_EQ(it - Iterator<int>(int_array, size), 2)
+      << "Should be at 2nd element!";
 }
 
 TEST(IteratorMethods, DereferenceOperator) {
@@ -121,9 +135,12 @@ TEST(IteratorMethods, AdditionOperator) {
   Iterator<int> it(int_array, size, 1);
   auto it2 = it + 2;
 
-  EXPECT_EQ(it2.get_index(), 3) << "Index should be 3!";
-  EXPECT_THROW(it + (-2), std::out_of_range)
-      << "Should throw out_of_range exception!";
+  EXPECT_EQ(it2 - Iterator<int>(int_array, size), 3) << "Index should be 3!";
+  EXPECT_EQ(*it2, 4) << "Should be at 4th element!";
+  if (Iterator<int>::is_checked) {
+    EXPECT_THROW(it + (-2), std::out_of_range)
+        << "Should throw out_of_range exception!";
+  }
 }
 
 TEST(IteratorMethods, SubtractionOperator) {
@@ -132,28 +149,55 @@ TEST(IteratorMethods, SubtractionOperator) {
   Iterator<int> it(int_array, size, 3);
   auto it2 = it - 2;
 
-  EXPECT_EQ(it2.get_index(), 1) << "Should be at 2nd element!";
-  EXPECT_THROW(it - 4, std::out_of_range)
-      << "Should throw out_of_range exception!";
+  EXPECT_EQ(it2 - Iterator<int>(int_array, size), 1)
+      << "Should be at 2nd element!";
+  EXPECT_EQ(*it2, 2) << "Should be at 2nd element!";
+  if (Iterator<int>::is_checked) {
+    EXPECT_THROW(it - 4, std::out_of_range)
+        << "Should throw out_of_range exception!";
+  }
 }
 
 TEST(IteratorMethods, Advance) {
   int size = 3;
   int *int_array = new int[size]{10, 20, 30};
-  Iterator<int> it(int_array, size);
+  Iterator<int, true> it(int_array, size);
 
-  Iterator<int>::advance(it, 2);
+  Iterator<int, true>::advance(it, 2);
   EXPECT_EQ(it.get_index(), size - 1)
-      << "Iterator should be pointing at the end!";
+      << "Iterator should be pointing at the last element!";
 
-  Iterator<int>::advance(it, 5);
-  EXPECT_EQ(it.get_index(), size - 1)
-      << "Iterator should still be pointing at the end!";
+  Iterator<int, true>::advance(it, 5);
+  EXPECT_EQ(it.get_index(), size)
+      << "Iterator should stop at the end (one past the last element)!";
 
-  Iterator<int>::advance(it, -10);
+  Iterator<int, true>::advance(it, -10);
   EXPECT_EQ(it.get_index(), 0) << "Iterator should be at the beginning!";
 }
 
+TEST(IteratorMethods, RandomAccess) {
+  int int_array[] = {10, 20, 30, 40};
+  Iterator<int> begin(int_array, 4), end(int_array, 4, 4);
+
+  static_assert(std::is_same<std::iterator_traits<Iterator<int>>::
+                                 iterator_category,
+                             std::random_access_iterator_tag>::value,
+                "Iterator should be random access!");
+
+  EXPECT_EQ(end - begin, 4) << "Difference should be 4!";
+  EXPECT_EQ(begin[2], 30) << "Subscript should return 3rd element!";
+  EXPECT_EQ(*(2 + begin), 30) << "n + it should work like it + n!";
+
+  Iterator<int> it = begin++;
+  EXPECT_EQ(*it, 10) << "Postfix should return the old value!";
+  EXPECT_EQ(*begin, 20) << "Postfix should increment!";
+
+  it += 3;
+  it -= 1;
+  EXPECT_EQ(*it, 30) << "Compound assignment should move the iterator!";
+  EXPECT_EQ(*std::prev(end), 40) << "std::prev(end) should be the last!";
+}
+
 // ----------
 // Compare test
 // ----------
@@ -196,3 +240,35 @@ TEST(IteratorCompare, GreaterThan) {
   EXPECT_TRUE(it1 >= it2)
       << "Iterator it1 should be greater or equal than it2!";
 }
+
+// ----------
+// Checking policy test
+// ----------
+
+TEST(IteratorPolicy, DefaultPolicy) {
+#ifdef NDEBUG
+  EXPECT_FALSE(Iterator<int>::is_checked) << "Release should be unchecked!";
+#else
+  EXPECT_TRUE(Iterator<int>::is_checked) << "Debug should be checked!";
+#endif
+}
+
+TEST(IteratorPolicy, CheckedAndUnchecked) {
+  int size = 3;
+  int int_array[] = {1, 2, 3};
+  Iterator<int, true> checked(int_array, size, 2);
+  Iterator<int, false> unchecked(int_array, size, 2);
+
+  EXPECT_THROW(checked + 2, std::out_of_range)
+      << "Checked iterator should throw out_of_range exception!";
+  EXPECT_EQ(sizeof(unchecked), sizeof(int *))
+      << "Unchecked iterator should be a bare pointer!";
+  EXPECT_EQ(unchecked.get_pointer(), checked.get_pointer())
+      << "Both should point at the same element!";
+
+  int sum = 0;
+  for (Iterator<int, false> it(int_array, size); it != unchecked + 1; ++it)
+    sum += *it;
+
+  EXPECT_EQ(sum, 6) << "Unchecked iterator should visit every element!";
+}
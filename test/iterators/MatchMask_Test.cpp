@@ -0,0 +1,56 @@
+#include <MatchMask.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(MatchMaskConstructors, SizeConstructor) {
+  MatchMask mask(130);
+
+  EXPECT_EQ(mask.get_size(), 130) << "Size should be 130!";
+  EXPECT_EQ(mask.get_words().size(), 3) << "130 bits should take 3 words!";
+  EXPECT_TRUE(mask.none()) << "No bit should be set!";
+  EXPECT_THROW(MatchMask(-1), std::invalid_argument)
+      << "Size should not be negative!";
+}
+
+TEST(MatchMaskConstructors, Build) {
+  std::vector<int> vec(200);
+  for (int i = 0; i < 200; i++)
+    vec[i] = i % 3;
+
+  MatchMask mask = MatchMask::equal(vec.data(), 200, 0);
+  MatchMask odd = MatchMask::build(vec.data(), 200,
+                                   [](int x) { return x % 2 == 1; });
+
+  EXPECT_EQ(mask.count(), 67) << "Every 3rd element should match!";
+  EXPECT_TRUE(mask.test(198) && !mask.test(199)) << "198 should match!";
+  EXPECT_EQ(odd.count(), 67) << "Every element equal to 1 should match!";
+  EXPECT_EQ((mask & odd).count(), 0) << "Masks should not intersect!";
+  EXPECT_EQ((mask | odd).count(), 134) << "Union should have 134 bits!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(MatchMaskMethods, SetAndVisit) {
+  MatchMask mask(100);
+  mask.set(3);
+  mask.set(64);
+  mask.set(99);
+  mask.reset(3);
+
+  EXPECT_EQ(mask.first(), 64) << "First set bit should be 64!";
+  EXPECT_EQ(mask.to_indices(), std::vector<int>({64, 99}))
+      << "Indexes should be in increasing order!";
+  EXPECT_THROW(mask.set(100), std::out_of_range) << "Should check index!";
+  EXPECT_THROW(mask.test(-1), std::out_of_range) << "Should check index!";
+  EXPECT_THROW(mask & MatchMask(5), std::invalid_argument)
+      << "Masks should be of the same size!";
+  EXPECT_EQ(MatchMask(10).first(), -1) << "Should be -1 if nothing is set!";
+}
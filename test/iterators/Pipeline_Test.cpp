@@ -0,0 +1,116 @@
+#include <DynamicArray.h>
+#include <Pipeline.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ----------
+// Stages test
+// ----------
+
+TEST(PipelineStages, Filter) {
+  DynamicArray<int> d(std::vector<int>{1, 2, 3, 4, 5, 6});
+
+  DynamicArray<int> even =
+      d.pipe().filter([](int x) { return x % 2 == 0; }).collect();
+  EXPECT_EQ(even.to_vector(), std::vector<int>({2, 4, 6}))
+      << "Should keep only even elements!";
+
+  DynamicArray<int> none = d.pipe().filter([](int x) { return x > 10; }).collect();
+  EXPECT_TRUE(none.is_empty()) << "Should be empty if nothing matched!";
+}
+
+TEST(PipelineStages, Map) {
+  DynamicArray<int> d(std::vector<int>{1, 2, 3});
+
+  DynamicArray<std::string> strings =
+      d.pipe().map([](int x) { return std::to_string(x * 10); }).collect();
+  EXPECT_EQ(strings.to_vector(), std::vector<std::string>({"10", "20", "30"}))
+      << "Should map elements to another type!";
+}
+
+TEST(PipelineStages, Take) {
+  DynamicArray<int> d(std::vector<int>{1, 2, 3, 4, 5, 6});
+  int calls = 0;
+
+  DynamicArray<int> first = d.pipe()
+                                .filter([&calls](int x) {
+                                  ++calls;
+                                  return x % 2 == 1;
+                                })
+                                .take(2)
+                                .collect();
+  EXPECT_EQ(first.to_vector(), std::vector<int>({1, 3}))
+      << "Should take the first 2 odd elements!";
+  EXPECT_EQ(calls, 3) << "Should stop reading the source after 2 matches!";
+  EXPECT_EQ(first.get_capacity(), 2) << "Should allocate only for 2 elements!";
+
+  EXPECT_EQ(d.pipe().take(0).count(), 0) << "take(0) should produce nothing!";
+  EXPECT_EQ(d.pipe().take(100).count(), 6) << "Should stop at the source end!";
+  EXPECT_THROW(d.pipe().take(-1), std::invalid_argument)
+      << "Should throw invalid_argument if n is negative!";
+}
+
+// ----------
+// Terminal operations test
+// ----------
+
+TEST(PipelineTerminal, ReduceMatchesEagerChain) {
+  DynamicArray<int> d(std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8});
+  auto odd = [](int x) { return x % 2 == 1; };
+  auto square = [](int x) { return x * x; };
+  auto sum = [](int a, int b) { return a + b; };
+
+  int eager = d.filter(odd).apply(square).reduce(0, sum);
+  int lazy = d.pipe().filter(odd).map(square).reduce(0, sum);
+
+  EXPECT_EQ(lazy, eager) << "Lazy pipeline should match the eager chain!";
+  EXPECT_EQ(DynamicArray<int>().pipe().reduce(5, sum), 5)
+      << "Empty source should return init!";
+}
+
+TEST(PipelineTerminal, CountAndForEach) {
+  DynamicArray<int> d(std::vector<int>{3, 1, 4, 1, 5});
+
+  EXPECT_EQ(d.pipe().filter([](int x) { return x == 1; }).count(), 2)
+      << "1 should occur 2 times!";
+
+  std::vector<int> seen;
+  d.pipe().map([](int x) { return -x; }).for_each([&seen](int x) {
+    seen.push_back(x);
+  });
+  EXPECT_EQ(seen, std::vector<int>({-3, -1, -4, -1, -5}))
+      << "Should visit every element in order!";
+}
+
+TEST(PipelineTerminal, OverSlice) {
+  DynamicArray<int> d(std::vector<int>{1, 2, 3, 4, 5, 6});
+
+  int sum = Pipeline<int>(d.slice(2, 5)).reduce(0, std::plus<int>());
+  EXPECT_EQ(sum, 12) << "Should only read the slice!";
+}
+
+TEST(PipelineTerminal, ParallelReduce) {
+  std::vector<int> vec(10001);
+  for (int i = 0; i < (int)vec.size(); i++)
+    vec[i] = i;
+
+  DynamicArray<int> d(vec);
+  auto pipeline = d.pipe().filter([](int x) { return x % 3 == 0; }).map(
+      [](int x) { return (long long)x; });
+
+  long long sequential = pipeline.reduce(0LL, std::plus<long long>());
+  for (int threads : {1, 2, 3, 8}) {
+    long long parallel = pipeline.parallel_reduce(
+        0LL, std::plus<long long>(), std::plus<long long>(), threads);
+    EXPECT_EQ(parallel, sequential)
+        << "Parallel result should not depend on thread count!";
+  }
+
+  EXPECT_THROW(pipeline.take(3).parallel_reduce(0LL, std::plus<long long>(),
+                                                std::plus<long long>()),
+               std::logic_error)
+      << "Should throw logic_error if pipeline contains take()!";
+}
@@ -0,0 +1,85 @@
+#include <BucketQueue.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(BucketQueueConstructors, Constructors) {
+  BucketQueue<int, int> q(10);
+
+  EXPECT_TRUE(q.is_empty()) << "Should be empty!";
+  EXPECT_EQ(q.get_spread(), 10) << "Spread should be 10!";
+  EXPECT_THROW((BucketQueue<int, int>(-1)), std::invalid_argument)
+      << "Negative spread!";
+  EXPECT_THROW(q.pop(), std::length_error) << "Bucket queue is empty!";
+  EXPECT_THROW(q.top(), std::length_error) << "Bucket queue is empty!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(BucketQueueMethods, DijkstraLikeTrace) {
+  // every pushed key is the popped key + a weight in [0, 7]
+  BucketQueue<unsigned int, int> q(7);
+  std::vector<unsigned int> popped;
+
+  q.push(0, 0);
+  for (int i = 1; popped.size() < 500; i++) {
+    std::pair<unsigned int, int> top = q.pop();
+    popped.push_back(top.first);
+
+    q.push(top.first + (i * 5) % 8, i);
+    if (i % 3 == 0)
+      q.push(top.first + (i * 3) % 8, -i);
+  }
+
+  EXPECT_TRUE(std::is_sorted(popped.begin(), popped.end()))
+      << "Keys should come out in non-decreasing order!";
+}
+
+TEST(BucketQueueMethods, Window) {
+  BucketQueue<int, char> q(4);
+
+  q.push(100, 'a'); // empty queue: the window jumps to 100
+  q.push(104, 'b');
+  q.push(102, 'c');
+
+  EXPECT_EQ(q.get_current_key(), 100) << "Current key should be 100!";
+  EXPECT_THROW(q.push(105, 'x'), std::out_of_range) << "Out of the window!";
+  EXPECT_THROW(q.push(99, 'x'), std::invalid_argument) << "Below current!";
+
+  EXPECT_EQ(q.pop(), std::make_pair(100, 'a')) << "Should pop 100!";
+  EXPECT_EQ(q.top(), std::make_pair(102, 'c')) << "Top should be 102!";
+
+  q.push(106, 'd'); // slides over empty 100, 101 and wraps around
+  EXPECT_EQ(q.pop().second, 'c') << "Should pop 'c'!";
+  EXPECT_EQ(q.pop().second, 'b') << "Should pop 'b'!";
+  EXPECT_EQ(q.pop(), std::make_pair(106, 'd')) << "Should pop 106!";
+
+  q.push(107, 'e');
+  q.clear();
+  EXPECT_TRUE(q.is_empty()) << "Should be empty after clear!";
+}
+
+TEST(BucketQueueMethods, PushAfterTop) {
+  BucketQueue<int, char> q(200);
+
+  q.push(5, 'a');
+  EXPECT_EQ(q.pop().first, 5) << "Should pop 5!";
+
+  q.push(100, 'b');
+  EXPECT_EQ(q.top().first, 100) << "Top should be 100!";
+  EXPECT_EQ(q.get_current_key(), 5) << "Top should not move the current key!";
+
+  EXPECT_NO_THROW(q.push(50, 'c')) << "50 is above the current key!";
+  EXPECT_EQ(q.top(), std::make_pair(50, 'c')) << "Top should be 50!";
+  EXPECT_EQ(q.pop().first, 50) << "Should pop 50!";
+  EXPECT_EQ(q.pop().first, 100) << "Should pop 100!";
+}
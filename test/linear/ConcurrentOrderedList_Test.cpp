@@ -0,0 +1,156 @@
+#include <ConcurrentOrderedList.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(ConcurrentOrderedListConstructors, DefaultConstructor) {
+  ConcurrentOrderedList<int> l;
+
+  EXPECT_TRUE(l.is_empty()) << "Should be empty!";
+  EXPECT_EQ(l.get_length(), 0) << "Length should be 0!";
+  EXPECT_TRUE(l.to_vector().empty()) << "Should have no values!";
+  EXPECT_FALSE(l.contains(0)) << "Should contain nothing!";
+}
+
+TEST(ConcurrentOrderedListConstructors, Comparator) {
+  ConcurrentOrderedList<int, std::greater<int>> l;
+  for (int i : {2, 5, 1, 4, 3})
+    l.insert(i);
+
+  EXPECT_EQ(l.to_vector(), std::vector<int>({5, 4, 3, 2, 1}))
+      << "Values should follow the comparator!";
+  EXPECT_TRUE(l.remove(3) && !l.contains(3)) << "Should remove by comp!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(ConcurrentOrderedListMethods, SingleThread) {
+  ConcurrentOrderedList<std::string> l;
+
+  EXPECT_TRUE(l.insert("b")) << "New value should be inserted!";
+  EXPECT_TRUE(l.insert("c")) << "New value should be inserted!";
+  EXPECT_TRUE(l.insert("a")) << "New value should be inserted!";
+  EXPECT_FALSE(l.insert("b")) << "Existing value should not be inserted!";
+  EXPECT_EQ(l.get_length(), 3) << "Length should be 3!";
+  EXPECT_EQ(l.to_vector(), std::vector<std::string>({"a", "b", "c"}))
+      << "Should be sorted!";
+
+  EXPECT_TRUE(l.remove("b")) << "Should remove the value!";
+  EXPECT_FALSE(l.remove("b")) << "Should not remove it twice!";
+  EXPECT_FALSE(l.remove("z")) << "Should not remove a missing value!";
+  EXPECT_FALSE(l.contains("b")) << "Value should be gone!";
+  EXPECT_TRUE(l.contains("a") && l.contains("c")) << "Others should stay!";
+
+  EXPECT_TRUE(l.insert("b")) << "Value should be inserted again!";
+  EXPECT_EQ(l.to_vector(), std::vector<std::string>({"a", "b", "c"}))
+      << "Should be sorted again!";
+
+  l.clear();
+  EXPECT_TRUE(l.is_empty() && l.to_vector().empty()) << "Should be empty!";
+}
+
+TEST(ConcurrentOrderedListMethods, Reclamation) {
+  ConcurrentOrderedList<int> l;
+  for (int round = 0; round < 10; round++) {
+    for (int i = 0; i < 100; i++)
+      l.insert(i);
+    for (int i = 0; i < 100; i++)
+      l.remove(i);
+  }
+
+  EXPECT_TRUE(l.is_empty()) << "Should be empty!";
+  EXPECT_LT(l.get_domain().get_waiting(), 3 * EpochDomain::collect_every)
+      << "Removed nodes should be freed while the list is used!";
+
+  l.insert(1);
+  l.remove(1);
+  l.clear();
+  EXPECT_EQ(l.get_domain().get_waiting(), 0)
+      << "Clear should free every retired node!";
+}
+
+TEST(ConcurrentOrderedListMethods, ConcurrentInsert) {
+  const int threads = 4, per_thread = 500;
+  ConcurrentOrderedList<int> l;
+  std::vector<std::thread> pool;
+
+  // interleaved values, so threads keep inserting next to each other
+  for (int t = 0; t < threads; t++)
+    pool.emplace_back([&l, t]() {
+      for (int i = 0; i < per_thread; i++)
+        l.insert(i * threads + t);
+    });
+
+  for (std::thread &thread : pool)
+    thread.join();
+
+  std::vector<int> expected(threads * per_thread);
+  for (int i = 0; i < threads * per_thread; i++)
+    expected[i] = i;
+
+  EXPECT_EQ(l.get_length(), threads * per_thread) << "Every value inserted!";
+  EXPECT_EQ(l.to_vector(), expected) << "Should be sorted and complete!";
+}
+
+TEST(ConcurrentOrderedListMethods, ConcurrentMixed) {
+  const int values = 1000;
+  ConcurrentOrderedList<int> l;
+  for (int i = 0; i < values; i++)
+    l.insert(i);
+
+  std::atomic<bool> done(false);
+  std::atomic<int> wrong(0), removed(0), churn(0);
+  std::vector<std::thread> pool;
+
+  // two removers race on the odd values (each is removed by exactly one)
+  for (int t = 0; t < 2; t++)
+    pool.emplace_back([&]() {
+      for (int i = 1; i < values; i += 2)
+        removed += l.remove(i);
+    });
+
+  // values above the range are inserted and removed over and over, so
+  // nodes keep being retired while the readers walk past them
+  pool.emplace_back([&]() {
+    for (int round = 0; round < 20; round++)
+      for (int i = values; i < values + 50; i++)
+        churn += l.insert(i) - l.remove(i);
+  });
+
+  // multiples of 4 are never touched, readers must always see them
+  for (int t = 0; t < 2; t++)
+    pool.emplace_back([&]() {
+      while (!done.load()) {
+        for (int i = 0; i < values; i += 40)
+          if (!l.contains(i))
+            wrong++;
+      }
+    });
+
+  pool[0].join();
+  pool[1].join();
+  pool[2].join();
+  done.store(true);
+  pool[3].join();
+  pool[4].join();
+
+  std::vector<int> expected;
+  for (int i = 0; i < values; i += 2)
+    expected.push_back(i);
+
+  EXPECT_EQ(wrong.load(), 0) << "Untouched values should always be found!";
+  EXPECT_EQ(removed.load(), values / 2) << "Each odd value removed once!";
+  EXPECT_EQ(churn.load(), 0) << "Every churned value should be removed!";
+  EXPECT_EQ(l.get_length(), values / 2) << "Length should match!";
+  EXPECT_EQ(l.to_vector(), expected) << "Even values should be left!";
+}
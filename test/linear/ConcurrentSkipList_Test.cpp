@@ -0,0 +1,127 @@
+#include <ConcurrentSkipList.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// ----------
+// Methods test
+// ----------
+
+TEST(ConcurrentSkipListMethods, SingleThread) {
+  ConcurrentSkipList<int, std::string> s;
+
+  EXPECT_TRUE(s.is_empty()) << "Should be empty!";
+  EXPECT_TRUE(s.insert(2, "b")) << "New key should be inserted!";
+  EXPECT_TRUE(s.insert(1, "a")) << "New key should be inserted!";
+  EXPECT_TRUE(s.insert(3, "c")) << "New key should be inserted!";
+  EXPECT_FALSE(s.insert(2, "x")) << "Existing key should not be replaced!";
+
+  std::string value;
+  EXPECT_TRUE(s.find(2, value) && value == "b") << "Should find the value!";
+  EXPECT_FALSE(s.find(4, value)) << "Should not find a missing key!";
+  EXPECT_EQ(s.get_length(), 3) << "Length should be 3!";
+
+  EXPECT_TRUE(s.remove(2)) << "Should remove the key!";
+  EXPECT_FALSE(s.remove(2)) << "Should not remove it twice!";
+  EXPECT_FALSE(s.contains(2)) << "Key should be gone!";
+  EXPECT_EQ(s.to_vector(),
+            (std::vector<std::pair<int, std::string>>{{1, "a"}, {3, "c"}}))
+      << "Should be sorted!";
+
+  EXPECT_EQ(s.get_retired(), 1) << "Removed node should wait for reclaim!";
+  s.reclaim();
+  EXPECT_EQ(s.get_retired(), 0) << "Reclaim should free it!";
+  EXPECT_TRUE(s.insert(2, "again")) << "Key should be inserted again!";
+  EXPECT_TRUE(s.find(2, value) && value == "again") << "New value!";
+
+  s.clear();
+  EXPECT_TRUE(s.is_empty() && s.to_vector().empty()) << "Should be empty!";
+}
+
+TEST(ConcurrentSkipListMethods, ConcurrentInsert) {
+  const int threads = 4, per_thread = 5000;
+  ConcurrentSkipList<int, int> s;
+  std::vector<std::thread> pool;
+
+  // interleaved keys, so threads keep inserting next to each other
+  for (int t = 0; t < threads; t++)
+    pool.emplace_back([&s, t]() {
+      for (int i = 0; i < per_thread; i++)
+        s.insert(i * threads + t, t);
+    });
+
+  for (std::thread &thread : pool)
+    thread.join();
+
+  EXPECT_EQ(s.get_length(), threads * per_thread) << "Every key inserted!";
+
+  int expected = 0;
+  bool ordered = true;
+  s.for_each([&](const int &key, const int &value) {
+    ordered &= key == expected && value == expected % threads;
+    expected++;
+  });
+
+  EXPECT_TRUE(ordered) << "Keys should be sorted and complete!";
+}
+
+TEST(ConcurrentSkipListMethods, ConcurrentMixed) {
+  const int keys = 4000;
+  ConcurrentSkipList<int, int> s;
+  for (int i = 0; i < keys; i++)
+    s.insert(i, i);
+
+  std::atomic<bool> done(false);
+  std::atomic<int> wrong(0), removed(0);
+  std::vector<std::thread> pool;
+
+  // two removers race on the odd keys (each key is removed by exactly one)
+  for (int t = 0; t < 2; t++)
+    pool.emplace_back([&]() {
+      for (int i = 1; i < keys; i += 2)
+        removed += s.remove(i);
+    });
+
+  // even keys are never touched, readers must always see them
+  for (int t = 0; t < 2; t++)
+    pool.emplace_back([&]() {
+      while (!done.load()) {
+        for (int i = 0; i < keys; i += 64) {
+          int value = -1;
+          if (!s.find(i, value) || value != i)
+            wrong++;
+        }
+      }
+    });
+
+  // an inserter adds keys above the range meanwhile
+  pool.emplace_back([&]() {
+    for (int i = keys; i < 2 * keys; i++)
+      s.insert(i, i);
+  });
+
+  pool[0].join();
+  pool[1].join();
+  pool[4].join();
+  done.store(true);
+  pool[2].join();
+  pool[3].join();
+
+  EXPECT_EQ(wrong.load(), 0) << "Untouched keys should always be found!";
+  EXPECT_EQ(removed.load(), keys / 2) << "Each odd key removed once!";
+  EXPECT_EQ(s.get_length(), keys + keys / 2) << "Length should match!";
+
+  s.reclaim();
+  std::vector<std::pair<int, int>> vec = s.to_vector();
+  bool valid = vec.size() == static_cast<size_t>(keys + keys / 2);
+  for (size_t i = 0; valid && i < vec.size(); i++) {
+    int key = static_cast<int>(i < keys / 2 ? i * 2 : i + keys / 2);
+    valid = vec[i].first == key && vec[i].second == key;
+  }
+
+  EXPECT_TRUE(valid) << "Even keys and the new keys should be left!";
+}
@@ -0,0 +1,105 @@
+#include <Deque.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(DequeConstructors, Constructors) {
+  Deque<int> d1;
+  Deque<int> d2(5);
+  Deque<int> d3(std::vector<int>{1, 2, 3});
+  Deque<int> d4(d3);
+
+  EXPECT_TRUE(d1.is_empty()) << "Should be empty!";
+  EXPECT_EQ(d1.get_capacity(), 8) << "Default capacity should be 8!";
+  EXPECT_EQ(d2.get_capacity(), 8) << "Capacity should round up to 8!";
+  EXPECT_EQ(d3.to_vector(), std::vector<int>({1, 2, 3})) << "Wrong elements!";
+  EXPECT_TRUE(d3 == d4) << "Copy should be equal!";
+
+  d4.push_back(4);
+  EXPECT_EQ(d3.get_size(), 3) << "Copy should be deep!";
+
+  d1 = d4;
+  EXPECT_EQ(d1.to_string(), "1, 2, 3, 4.") << "Wrong string after assign!";
+  EXPECT_THROW(Deque<int>(-1), std::invalid_argument) << "Negative capacity!";
+  EXPECT_THROW(Deque<int>((1 << 30) + 1), std::length_error)
+      << "Capacity above 2^30 cannot be rounded to an int power of two!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(DequeMethods, PushAndPop) {
+  Deque<int> d(4);
+
+  d.push_back(2);
+  d.push_back(3);
+  d.push_front(1);
+  d.push_front(0);
+
+  EXPECT_TRUE(d.is_full()) << "Should be full!";
+  EXPECT_EQ(d.front(), 0) << "Front should be 0!";
+  EXPECT_EQ(d.back(), 3) << "Back should be 3!";
+  EXPECT_EQ(d.pop_front(), 0) << "Should pop 0 from the front!";
+  EXPECT_EQ(d.pop_back(), 3) << "Should pop 3 from the back!";
+  EXPECT_EQ(d.to_vector(), std::vector<int>({1, 2})) << "Wrong elements!";
+
+  d.pop_back();
+  d.pop_back();
+  EXPECT_THROW(d.pop_back(), std::length_error) << "Deque is empty!";
+  EXPECT_THROW(d.pop_front(), std::length_error) << "Deque is empty!";
+  EXPECT_THROW(d.front(), std::length_error) << "Deque is empty!";
+  EXPECT_THROW(d.back(), std::length_error) << "Deque is empty!";
+}
+
+TEST(DequeMethods, WrapAroundAndGrow) {
+  Deque<int> d(4);
+
+  // move the head around the end of the buffer several times
+  for (int i = 0; i < 10; i++) {
+    d.push_back(i);
+    d.push_back(i + 100);
+    EXPECT_EQ(d.pop_front(), i) << "Wrong front after wrapping!";
+    EXPECT_EQ(d.pop_front(), i + 100) << "Wrong front after wrapping!";
+  }
+  EXPECT_EQ(d.get_capacity(), 4) << "Should not grow!";
+
+  d.push_back(1);
+  d.push_back(2);
+  d.push_front(0);
+  d.push_front(-1);
+  d.push_back(3);
+
+  EXPECT_EQ(d.get_capacity(), 8) << "Capacity should double!";
+  EXPECT_EQ(d.to_vector(), std::vector<int>({-1, 0, 1, 2, 3}))
+      << "Order should survive growing!";
+
+  d.reserve(20);
+  EXPECT_EQ(d.get_capacity(), 32) << "Capacity should round up to 32!";
+  EXPECT_EQ(d.to_vector(), std::vector<int>({-1, 0, 1, 2, 3}))
+      << "Order should survive reserve!";
+}
+
+TEST(DequeMethods, Access) {
+  Deque<std::string> d;
+  d.push_back("b");
+  d.push_back("c");
+  d.push_front("a");
+
+  EXPECT_EQ(d.at(0), "a") << "First should be 'a'!";
+  EXPECT_EQ(d[2], "c") << "Last should be 'c'!";
+  EXPECT_TRUE(d.contains("b")) << "Should contain 'b'!";
+  EXPECT_FALSE(d.contains("d")) << "Should not contain 'd'!";
+  EXPECT_THROW(d.at(3), std::out_of_range) << "Index is out of range!";
+  EXPECT_THROW(d.at(-1), std::out_of_range) << "Index is out of range!";
+
+  d.clear();
+  EXPECT_TRUE(d.is_empty()) << "Should be empty after clear!";
+  EXPECT_THROW(d.to_string(), std::length_error) << "Deque is empty!";
+}
@@ -2,14 +2,17 @@
 #include <Iterator.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cctype>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
+#include <iterator>
 #include <numeric>
 #include <stdexcept>
 #include <string>
 #include <sys/errno.h>
+#include <utility>
 #include <vector>
 
 // ----------
@@ -390,7 +393,7 @@ TEST(DynamicArrayModify, EraseRange) {
   EXPECT_THROW(d.erase_range(it + 2, it + 1), std::invalid_argument)
       << "it1 should be less than it2!";
 
-  d.erase_range(it + 1, it + 3);
+  d.erase_range(it + 1, it + 4);
   size -= range;
 
   EXPECT_EQ(d.get_size(), size)
@@ -398,8 +401,8 @@ TEST(DynamicArrayModify, EraseRange) {
 
   EXPECT_TRUE(d.contains(*(d.begin())))
       << "First element should be in array: " << *(d.begin());
-  EXPECT_TRUE(d.contains(*(d.end())))
-      << "First element should be in array: " << *(d.end());
+  EXPECT_TRUE(d.contains(*(d.end() - 1)))
+      << "Last element should be in array: " << *(d.end() - 1);
 
   EXPECT_FALSE(d.contains(2)) << "Deleted element (2) should not be in array !";
   EXPECT_FALSE(d.contains(3)) << " Deleted element(3) should not be in array !";
@@ -461,7 +464,7 @@ TEST(DynamicArrayIterators, IteratorBegin) {
   Iterator<char> it = d.begin();
 
   EXPECT_EQ(*it, 'a') << "First element should be equal to 'a'.";
-  EXPECT_EQ(it.get_index(), 0) << "Index should be 0!";
+  EXPECT_EQ(it - d.begin(), 0) << "Index should be 0!";
 }
 
 TEST(DynamicArrayIterators, IteratorEnd) {
@@ -473,9 +476,33 @@ TEST(DynamicArrayIterators, IteratorEnd) {
 
   Iterator<char> it = d.end();
 
-  EXPECT_EQ(*it, 'c') << "Last element should be equal to 'c'.";
-  EXPECT_EQ(it.get_index(), d.get_size() - 1)
-      << "Index should be " << d.get_size() - 1 << ".";
+  EXPECT_EQ(*(it - 1), 'c') << "Last element should be equal to 'c'.";
+  EXPECT_EQ(it - d.begin(), d.get_size())
+      << "Index should be one past the last element: " << d.get_size() << ".";
+  if (Iterator<char>::is_checked) {
+    EXPECT_THROW(*it, std::out_of_range)
+        << "end() should not be dereferenced!";
+  }
+}
+
+TEST(DynamicArrayIterators, StdAlgorithms) {
+  DynamicArray<int> d(std::vector<int>{5, 3, 9, 1, 7});
+
+  std::sort(d.begin(), d.end());
+  EXPECT_EQ(d.to_vector(), std::vector<int>({1, 3, 5, 7, 9}))
+      << "std::sort should sort the array!";
+
+  Iterator<int> it = std::lower_bound(d.begin(), d.end(), 6);
+  EXPECT_EQ(*it, 7) << "std::lower_bound should find 7!";
+  EXPECT_EQ(std::distance(d.begin(), d.end()), d.get_size())
+      << "Distance should be equal to the size!";
+  EXPECT_EQ(std::accumulate(d.begin(), d.end(), 0), 25)
+      << "Sum should be 25!";
+
+  std::vector<int> reversed(std::make_reverse_iterator(d.end()),
+                            std::make_reverse_iterator(d.begin()));
+  EXPECT_EQ(reversed, std::vector<int>({9, 7, 5, 3, 1}))
+      << "Reverse iterators should walk backwards!";
 }
 
 // ----------
@@ -560,7 +587,7 @@ TEST(DynamicArrayMethods, Find) {
 
   Iterator<int> f = d.find(1);
   EXPECT_EQ(*f, *(d.begin())) << "Iterator should point at index 0!";
-  EXPECT_EQ((d.find(5) - 1).get_index(), 3)
+  EXPECT_EQ(d.find(5) - 1 - d.begin(), 3)
       << "Should point to the previous index of the found element at the send.";
   EXPECT_EQ(d.find(99), d.end())
       << "Should point to the end if element was not found!";
@@ -578,7 +605,7 @@ TEST(DynamicArrayMethods, FindAll) {
   std::vector<Iterator<int>> f = d.find_all(2);
 
   for (int i = 0; i < f.size(); i++) {
-    EXPECT_EQ(f[i].get_index(), iterators[i].get_index())
+    EXPECT_EQ(f[i] - d.begin(), iterators[i] - d.begin())
         << "Indexes of found iterators should be equal!";
     EXPECT_EQ(*(f[i]), *(iterators[i]))
         << "Values of found iterators should be equal!";
@@ -602,7 +629,7 @@ TEST(DynamicArrayMethods, FindIf) {
   std::vector<Iterator<int>> f = d.find_if([](int x) { return x % 2 == 0; });
 
   for (int i = 0; i < f.size(); i++) {
-    EXPECT_EQ(f[i].get_index(), iterators[i].get_index())
+    EXPECT_EQ(f[i] - d.begin(), iterators[i] - d.begin())
         << "Indexes of found iterators should be equal!";
     EXPECT_EQ(*(f[i]), *(iterators[i]))
         << "Values of found iterators should be equal!";
@@ -617,6 +644,28 @@ TEST(DynamicArrayMethods, FindIf) {
       << "Should throw length_error if array is empty!";
 }
 
+TEST(DynamicArrayMethods, CompactFind) {
+  DynamicArray<int> d(std::vector<int>{1, 2, 1, 3, 1, 4});
+
+  EXPECT_EQ(d.find_all_indices(1), std::vector<int>({0, 2, 4}))
+      << "Should return indexes of all 1s!";
+  EXPECT_EQ(d.find_if_indices([](int x) { return x > 2; }),
+            std::vector<int>({3, 5}))
+      << "Should return indexes of elements > 2!";
+  EXPECT_EQ(d.match_mask(1).to_indices(), d.find_all_indices(1))
+      << "Mask and indexes should describe the same matches!";
+  EXPECT_EQ(d.match_mask_if([](int x) { return x % 2 == 0; }).count(), 2)
+      << "Two even elements should match!";
+
+  int sum = 0;
+  d.for_each_match(1, [&sum](const int index, const int &) { sum += index; });
+  EXPECT_EQ(sum, 6) << "Visitor should see indexes 0, 2 and 4!";
+
+  d.erase_range(d.begin(), d.end());
+  EXPECT_THROW(d.match_mask(1), std::length_error)
+      << "Should throw length_error if array is empty!";
+}
+
 TEST(DynamicArrayMethods, ReplaceOccurence) {
   int *int_array = new int[]{1, 2, 3, 4, 5};
   DynamicArray<int> d(5, int_array);
@@ -946,7 +995,7 @@ TEST(DynamicArrayUsefulFunctions, ReversePartial) {
   EXPECT_THROW(d.reverse_partial(it + 3, it + 1), std::invalid_argument)
       << "it1 should be less than it2!";
 
-  d.reverse_partial(it + 1, it + 3);
+  d.reverse_partial(it + 1, it + 4);
   for (int i = 0; i < d.get_size(); i++)
     EXPECT_EQ(d[i], expected[i])
         << "Values of array and expected should be equal!";
@@ -1272,14 +1321,14 @@ TEST(DynamicArraySome, Distinct) {
   std::vector<char> vec{'a', 'b', 'c', 'c', 'b', 'd', 'a'};
   DynamicArray<char> d(vec);
 
-  Iterator<char> it = d.end();
-  Iterator<char> dist = d.distinct(), expected = it - 1;
+  Iterator<const char> it = d.end();
+  Iterator<const char> dist = d.distinct(), expected = it - 2;
 
-  EXPECT_EQ(dist.get_index(), expected.get_index())
+  EXPECT_EQ(dist - d.begin(), expected - d.begin())
       << "Indexes of found distinct and expected distinct should be equal!";
   EXPECT_EQ(*dist, *expected)
       << "Values of found distinct and expected distinct should be equal!";
-  EXPECT_EQ(dist, Iterator<char>(expected, true)) << "Iterators must be equal!";
+  EXPECT_EQ(dist, expected) << "Iterators must be equal!";
 
   d.erase_all('d');
   dist = d.distinct();
@@ -1296,10 +1345,10 @@ TEST(DynamicArraySome, KthDistinct) {
   std::vector<std::string> vec{"aaa", "aa", "a"};
   DynamicArray<std::string> d(vec);
 
-  Iterator<std::string> it = d.begin();
-  Iterator<std::string> kth = d.kth_distinct(2);
+  Iterator<const std::string> it = d.begin();
+  Iterator<const std::string> kth = d.kth_distinct(2);
 
-  EXPECT_EQ(kth, Iterator<std::string>(it + 1, true))
+  EXPECT_EQ(kth, it + 1)
       << "2nd distinct element should be pointing to the "
          "2nd element of an array!";
 
@@ -1326,3 +1375,155 @@ TEST(DynamicArraySome, TopKFrequent) {
   EXPECT_THROW(topk = d.top_k_frequent(3), std::length_error)
       << "Should throw length_error if array is empty!";
 }
+
+// ----------
+// Copy-on-write test
+// ----------
+
+TEST(DynamicArrayCopyOnWrite, DeepCopyByDefault) {
+  DynamicArray<int> d1(std::vector<int>{1, 2, 3});
+  DynamicArray<int> d2(d1);
+
+  EXPECT_FALSE(d1.is_copy_on_write()) << "Copy-on-write should be opt-in!";
+  EXPECT_NE(std::as_const(d1).get_array(), std::as_const(d2).get_array())
+      << "Copies should not share the buffer by default!";
+  EXPECT_EQ(d1.use_count(), 1) << "Buffer should have a single owner!";
+}
+
+TEST(DynamicArrayCopyOnWrite, CopiesShareBuffer) {
+  DynamicArray<int> d1(std::vector<int>{1, 2, 3});
+  d1.set_copy_on_write(true);
+
+  DynamicArray<int> d2(d1);
+  DynamicArray<int> d3;
+  d3 = d1;
+
+  EXPECT_TRUE(d2.is_copy_on_write()) << "Copies should inherit the mode!";
+  EXPECT_EQ(std::as_const(d1).get_array(), std::as_const(d2).get_array()) << "Copy should share the buffer!";
+  EXPECT_EQ(std::as_const(d1).get_array(), std::as_const(d3).get_array())
+      << "Assigned array should share the buffer!";
+  EXPECT_EQ(d1.use_count(), 3) << "Buffer should have 3 owners!";
+  EXPECT_TRUE(d1 == d2 && d1 == d3) << "Values should be equal!";
+}
+
+TEST(DynamicArrayCopyOnWrite, DetachOnWrite) {
+  DynamicArray<int> d1(std::vector<int>{3, 1, 2});
+  d1.set_copy_on_write(true);
+  DynamicArray<int> d2(d1);
+
+  d2.replace(d2.begin(), 10);
+  EXPECT_NE(std::as_const(d1).get_array(), std::as_const(d2).get_array())
+      << "Mutated copy should get its own buffer!";
+  EXPECT_EQ(d1[0], 3) << "Original should not be modified!";
+  EXPECT_EQ(d2[0], 10) << "Copy should be modified!";
+  EXPECT_EQ(d1.use_count(), 1) << "Original should be the only owner again!";
+
+  DynamicArray<int> d3(d1);
+  d3.merge_sort();
+  EXPECT_EQ(d1.to_vector(), std::vector<int>({3, 1, 2}))
+      << "Sorting a copy should not sort the original!";
+  EXPECT_EQ(d3.to_vector(), std::vector<int>({1, 2, 3}))
+      << "Copy should be sorted!";
+
+  DynamicArray<int> d4(d1);
+  d4.resize(10);
+  d4.push_back(4);
+  EXPECT_EQ(d1.get_size(), 3) << "Original size should not change!";
+  EXPECT_EQ(d4.get_size(), 4) << "Copy should grow!";
+}
+
+TEST(DynamicArrayCopyOnWrite, MutableIterators) {
+  DynamicArray<int> d1(std::vector<int>{3, 1, 2});
+  d1.set_copy_on_write(true);
+
+  DynamicArray<int> d2(d1);
+  std::sort(d2.begin(), d2.end());
+  EXPECT_EQ(d1.to_vector(), std::vector<int>({3, 1, 2}))
+      << "Sorting a copy through its iterators should not sort the original!";
+  EXPECT_EQ(d2.to_vector(), std::vector<int>({1, 2, 3}))
+      << "Copy should be sorted!";
+
+  DynamicArray<int> d3(d1);
+  const DynamicArray<int> &shared = d3;
+  EXPECT_EQ(shared.find(1).get_pointer(), std::as_const(d1).get_array() + 1)
+      << "Const find should share the buffer!";
+
+  *d3.find(1) = 10;
+  d3.get_array()[0] = 30;
+  EXPECT_EQ(d1.to_vector(), std::vector<int>({3, 1, 2}))
+      << "Writing through find or get_array should not reach the original!";
+  EXPECT_EQ(d3.to_vector(), std::vector<int>({30, 10, 2}))
+      << "Copy should be modified!";
+}
+
+TEST(DynamicArrayCopyOnWrite, EraseAllAndIf) {
+  DynamicArray<int> d1(std::vector<int>{1, 2, 1, 3, 1});
+  d1.set_copy_on_write(true);
+
+  DynamicArray<int> d2(d1);
+  d2.erase_all(1);
+  EXPECT_EQ(d2.to_vector(), std::vector<int>({2, 3}))
+      << "All 1s should be erased from the copy!";
+  EXPECT_EQ(d1.to_vector(), std::vector<int>({1, 2, 1, 3, 1}))
+      << "Original should not be modified!";
+
+  DynamicArray<int> d3(d1);
+  d3.erase_if([](int x) { return x != 1; });
+  EXPECT_EQ(d3.to_vector(), std::vector<int>({1, 1, 1}))
+      << "Elements other than 1 should be erased from the copy!";
+  EXPECT_EQ(d1.to_vector(), std::vector<int>({1, 2, 1, 3, 1}))
+      << "Original should not be modified!";
+}
+
+TEST(DynamicArrayCopyOnWrite, Disable) {
+  DynamicArray<int> d1(std::vector<int>{1, 2, 3});
+  d1.set_copy_on_write(true);
+  DynamicArray<int> d2(d1);
+
+  d2.set_copy_on_write(false);
+  EXPECT_NE(std::as_const(d1).get_array(), std::as_const(d2).get_array())
+      << "Disabling should detach from the shared buffer!";
+
+  DynamicArray<int> d3(d2);
+  EXPECT_NE(std::as_const(d2).get_array(), std::as_const(d3).get_array())
+      << "Copies should be deep again after disabling!";
+}
+
+// ----------
+// Views test
+// ----------
+
+TEST(DynamicArrayViews, ViewAndSlice) {
+  DynamicArray<int> d(std::vector<int>{4, 3, 2, 1});
+
+  ArrayView<int> v = d.view();
+  EXPECT_EQ(v.get_data(), std::as_const(d).get_array()) << "View should not copy!";
+  EXPECT_EQ(v.get_size(), d.get_size()) << "View should cover the array!";
+
+  d.slice(0, 3).sort();
+  EXPECT_EQ(d.to_vector(), std::vector<int>({2, 3, 4, 1}))
+      << "Sorting a slice should sort the array window!";
+  EXPECT_EQ(d.slice(1, 4).max(), 4) << "Max of the window should be 4!";
+
+  EXPECT_THROW(d.slice(0, 5), std::out_of_range)
+      << "Should throw out_of_range if slice is out of range!";
+}
+
+TEST(DynamicArrayViews, CopyOnWriteViews) {
+  DynamicArray<int> d1(std::vector<int>{3, 1, 2});
+  d1.set_copy_on_write(true);
+  DynamicArray<int> d2(d1);
+
+  const DynamicArray<int> &shared = d2;
+  ArrayView<const int> read = shared.view();
+  EXPECT_EQ(read.get_data(), std::as_const(d1).get_array()) << "Reading should share!";
+  EXPECT_EQ(shared.slice(1, 3).reduce(0), 3) << "Sum of 1, 2 should be 3!";
+
+  d2.slice(0, 3).sort();
+  EXPECT_NE(std::as_const(d1).get_array(), std::as_const(d2).get_array())
+      << "Mutable view should detach the buffer!";
+  EXPECT_EQ(d1.to_vector(), std::vector<int>({3, 1, 2}))
+      << "Original should not be sorted!";
+  EXPECT_EQ(d2.to_vector(), std::vector<int>({1, 2, 3}))
+      << "Copy should be sorted!";
+}
@@ -0,0 +1,106 @@
+#include <IndexedPriorityQueue.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(IndexedPriorityQueueConstructors, Constructors) {
+  IndexedPriorityQueue<int> q1(5);
+
+  q1.push(3, 30);
+  q1.push(1, 10);
+
+  IndexedPriorityQueue<int> q2(q1);
+  q2.update(1, 50);
+
+  EXPECT_EQ(q1.get_capacity(), 5) << "Capacity should be 5!";
+  EXPECT_EQ(q1.top_id(), 3) << "Copy should be deep!";
+  EXPECT_EQ(q2.top_id(), 1) << "Copy should have the new key!";
+
+  q1 = q2;
+  EXPECT_EQ(q1.top_key(), 50) << "Wrong top after assign!";
+  EXPECT_THROW(IndexedPriorityQueue<int>(-1), std::invalid_argument)
+      << "Negative capacity!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(IndexedPriorityQueueMethods, PushUpdateAndPop) {
+  IndexedPriorityQueue<int, std::greater<int>, 4> q(10);
+
+  for (int id = 0; id < 10; id++)
+    q.push(id, 100 - id);
+
+  EXPECT_EQ(q.top_id(), 9) << "Smallest key belongs to 9!";
+
+  q.update(0, 1);  // decrease-key
+  q.update(9, 200); // increase-key
+  EXPECT_EQ(q.top_id(), 0) << "Decreased key should go to the top!";
+  EXPECT_EQ(q.key_of(9), 200) << "Key of 9 should be 200!";
+
+  q.erase(8);
+  EXPECT_FALSE(q.contains(8)) << "8 should be erased!";
+
+  std::vector<int> order;
+  while (!q.is_empty())
+    order.push_back(q.pop());
+
+  EXPECT_EQ(order, std::vector<int>({0, 7, 6, 5, 4, 3, 2, 1, 9}))
+      << "Wrong pop order!";
+}
+
+TEST(IndexedPriorityQueueMethods, Errors) {
+  IndexedPriorityQueue<int> q(3);
+
+  q.push(0, 1);
+  EXPECT_THROW(q.push(0, 2), std::invalid_argument) << "Already queued!";
+  EXPECT_THROW(q.push(3, 2), std::out_of_range) << "Id out of range!";
+  EXPECT_THROW(q.update(1, 2), std::invalid_argument) << "Not queued!";
+  EXPECT_THROW(q.key_of(-1), std::out_of_range) << "Id out of range!";
+
+  q.push_or_update(0, 5);
+  q.push_or_update(2, 7);
+  EXPECT_EQ(q.top_id(), 2) << "Top should be 2!";
+
+  q.clear();
+  EXPECT_FALSE(q.contains(0)) << "Should be empty after clear!";
+  EXPECT_THROW(q.pop(), std::length_error) << "Priority queue is empty!";
+  EXPECT_THROW(q.top_key(), std::length_error) << "Priority queue is empty!";
+}
+
+TEST(IndexedPriorityQueueMethods, Dijkstra) {
+  // edges: (from, to, weight)
+  std::vector<std::vector<std::pair<int, int>>> graph(5);
+  graph[0] = {{1, 4}, {2, 1}};
+  graph[2] = {{1, 2}, {3, 5}};
+  graph[1] = {{3, 1}};
+  graph[3] = {{4, 3}};
+
+  const int inf = std::numeric_limits<int>::max();
+  std::vector<int> dist(5, inf);
+  IndexedPriorityQueue<int, std::greater<int>> q(5);
+
+  dist[0] = 0;
+  q.push(0, 0);
+  while (!q.is_empty()) {
+    int u = q.pop();
+    for (auto [v, w] : graph[u]) {
+      if (dist[u] + w < dist[v]) {
+        dist[v] = dist[u] + w;
+        q.push_or_update(v, dist[v]);
+      }
+    }
+  }
+
+  EXPECT_EQ(dist, std::vector<int>({0, 3, 1, 4, 7}))
+      << "Wrong shortest distances!";
+}
@@ -0,0 +1,267 @@
+#include <IntrusiveList.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// Element on two lists at once (all tasks and the ready ones)
+struct Task {
+  int id;
+  IntrusiveListHook<Task> all;
+  IntrusiveListHook<Task> ready;
+  Task(int id = 0) : id(id){};
+};
+
+using TaskList = IntrusiveList<Task, &Task::all>;
+using ReadyList = IntrusiveList<Task, &Task::ready>;
+
+template <class List> std::vector<int> list_ids(const List &l) {
+  std::vector<int> vec;
+  for (const Task &task : l)
+    vec.push_back(task.id);
+
+  return vec;
+}
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(IntrusiveListConstructors, DefaultConstructor) {
+  TaskList l;
+
+  EXPECT_TRUE(l.is_empty()) << "Should be empty!";
+  EXPECT_EQ(l.get_head(), nullptr) << "Head should be null!";
+  EXPECT_EQ(l.get_tail(), nullptr) << "Tail should be null!";
+  EXPECT_EQ(l.get_length(), 0) << "Length should be 0!";
+  EXPECT_TRUE(l.begin() == l.end()) << "begin() should be end()!";
+}
+
+TEST(IntrusiveListConstructors, DestructorUnlinks) {
+  Task a(1), b(2);
+  {
+    TaskList l;
+    l.push_end(a);
+    l.push_end(b);
+  }
+
+  EXPECT_FALSE(TaskList::is_linked(a) || TaskList::is_linked(b))
+      << "Elements should be unlinked when the list is destroyed!";
+}
+
+TEST(IntrusiveListConstructors, CopyDoesNotLink) {
+  Task a(1);
+  TaskList l;
+  l.push_end(a);
+
+  Task copy = a;
+  EXPECT_FALSE(TaskList::is_linked(copy)) << "Copy should not be linked!";
+  EXPECT_EQ(copy.id, 1) << "Copy should keep the data!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(IntrusiveListMethods, Push) {
+  std::vector<Task> tasks{0, 1, 2, 3, 4};
+  TaskList l;
+
+  l.push_end(tasks[2]);
+  l.push_begin(tasks[0]);
+  l.push_after(tasks[0], tasks[1]);
+  l.push_end(tasks[4]);
+  l.push_before(tasks[4], tasks[3]);
+
+  EXPECT_EQ(list_ids(l), std::vector<int>({0, 1, 2, 3, 4}))
+      << "Order should match!";
+  EXPECT_EQ(l.get_head(), &tasks[0]) << "Head should be the element itself!";
+  EXPECT_EQ(l.get_tail(), &tasks[4]) << "Tail should be the element itself!";
+  EXPECT_EQ(l.get_length(), 5) << "Length should be 5!";
+
+  EXPECT_THROW(l.push_end(tasks[1]), std::invalid_argument)
+      << "Should throw if the element is already linked!";
+
+  Task free(9);
+  EXPECT_THROW(l.push_after(free, tasks[0]), std::invalid_argument)
+      << "Should throw if the node is not linked!";
+}
+
+TEST(IntrusiveListMethods, PushIndex) {
+  std::vector<Task> tasks{0, 1, 2, 3};
+  TaskList l;
+
+  l.push_index(0, tasks[1]);
+  l.push_index(1, tasks[3]);
+  l.push_index(0, tasks[0]);
+  l.push_index(2, tasks[2]);
+
+  EXPECT_EQ(list_ids(l), std::vector<int>({0, 1, 2, 3}))
+      << "Order should match!";
+  EXPECT_EQ(l.get_node_by_index(3), &tasks[3]) << "Should find by index!";
+  EXPECT_THROW(l.push_index(6, tasks[0]), std::out_of_range)
+      << "Should throw out_of_range!";
+}
+
+TEST(IntrusiveListMethods, Remove) {
+  std::vector<Task> tasks{0, 1, 2, 3, 4, 5};
+  TaskList l;
+  for (Task &task : tasks)
+    l.push_end(task);
+
+  EXPECT_EQ(&l.remove_begin(), &tasks[0]) << "Should return the head!";
+  EXPECT_EQ(&l.remove_end(), &tasks[5]) << "Should return the tail!";
+  l.remove_node(tasks[2]);
+  EXPECT_EQ(&l.remove_index(1), &tasks[3]) << "Should return index 1!";
+
+  EXPECT_EQ(list_ids(l), std::vector<int>({1, 4})) << "Order should match!";
+  EXPECT_FALSE(TaskList::is_linked(tasks[2])) << "Hook should be reset!";
+  EXPECT_THROW(l.remove_node(tasks[2]), std::invalid_argument)
+      << "Should throw if the node is not linked!";
+
+  l.push_begin(tasks[2]);
+  EXPECT_EQ(list_ids(l), std::vector<int>({2, 1, 4})) << "Should link again!";
+
+  EXPECT_EQ(l.remove_if([](const Task &task) { return task.id != 1; }), 2)
+      << "Should remove two elements!";
+  EXPECT_EQ(list_ids(l), std::vector<int>({1})) << "Only 1 should be left!";
+  EXPECT_EQ(l.get_tail(), &tasks[1]) << "Head should be the tail!";
+
+  l.remove_end();
+  EXPECT_TRUE(l.is_empty()) << "Should be empty!";
+  EXPECT_THROW(l.remove_begin(), std::length_error)
+      << "Should throw length_error if list is empty!";
+}
+
+TEST(IntrusiveListMethods, TwoHooks) {
+  std::vector<Task> tasks{0, 1, 2, 3, 4};
+  TaskList all;
+  ReadyList ready;
+
+  for (Task &task : tasks)
+    all.push_end(task);
+
+  ready.push_end(tasks[3]);
+  ready.push_end(tasks[1]);
+  all.remove_node(tasks[3]);
+
+  EXPECT_EQ(list_ids(all), std::vector<int>({0, 1, 2, 4}))
+      << "All should match!";
+  EXPECT_EQ(list_ids(ready), std::vector<int>({3, 1})) << "Ready should match!";
+  EXPECT_TRUE(ReadyList::is_linked(tasks[3]) && !TaskList::is_linked(tasks[3]))
+      << "Hooks should be independent!";
+  EXPECT_TRUE(ready.contains(tasks[1]) && !ready.contains(tasks[0]))
+      << "Contains should check this list only!";
+}
+
+TEST(IntrusiveListMethods, ForeignNode) {
+  std::vector<Task> tasks{0, 1, 2, 3};
+  TaskList l, other;
+
+  l.push_end(tasks[0]);
+  l.push_end(tasks[1]);
+  other.push_end(tasks[2]);
+
+  if (!TaskList::checks_handles)
+    GTEST_SKIP() << "Node membership is trusted in this build!";
+
+  EXPECT_THROW(l.remove_node(tasks[2]), std::invalid_argument)
+      << "Node of another list should be rejected!";
+  EXPECT_THROW(l.push_after(tasks[2], tasks[3]), std::invalid_argument)
+      << "Node of another list should be rejected!";
+  EXPECT_THROW(l.push_before(tasks[2], tasks[3]), std::invalid_argument)
+      << "Node of another list should be rejected!";
+  EXPECT_EQ(other.get_length(), 1) << "Other list should be untouched!";
+  EXPECT_FALSE(TaskList::is_linked(tasks[3])) << "Element should stay free!";
+}
+
+TEST(IntrusiveListMethods, FindAndReverse) {
+  std::vector<Task> tasks{0, 1, 2, 3};
+  TaskList l;
+  for (Task &task : tasks)
+    l.push_end(task);
+
+  EXPECT_EQ(l.find_if([](const Task &task) { return task.id > 1; }), &tasks[2])
+      << "Should find the first match!";
+  EXPECT_EQ(l.find_if([](const Task &task) { return task.id > 5; }), nullptr)
+      << "Should be null without a match!";
+
+  l.reverse();
+  EXPECT_EQ(list_ids(l), std::vector<int>({3, 2, 1, 0}))
+      << "Should be reversed!";
+  EXPECT_EQ(l.get_tail(), &tasks[0]) << "Tail should be the old head!";
+
+  Task fresh(4);
+  l.push_end(fresh);
+  EXPECT_EQ(list_ids(l), std::vector<int>({3, 2, 1, 0, 4}))
+      << "Links should stay valid after reverse!";
+}
+
+TEST(IntrusiveListMethods, MatchesModel) {
+  std::mt19937 rng(5);
+  std::vector<Task> tasks(64);
+  std::vector<int> model;
+  TaskList l;
+
+  for (int i = 0; i < 64; i++)
+    tasks[i].id = i;
+
+  for (int step = 0; step < 5000; step++) {
+    int id = rng() % 64;
+    Task &task = tasks[id];
+
+    if (TaskList::is_linked(task)) {
+      l.remove_node(task);
+      model.erase(std::find(model.begin(), model.end(), id));
+    } else if (rng() % 2 == 0 || model.empty()) {
+      l.push_begin(task);
+      model.insert(model.begin(), id);
+    } else {
+      int index = rng() % model.size();
+      l.push_before(*l.get_node_by_index(index), task);
+      model.insert(model.begin() + index, id);
+    }
+
+    if (step % 500 == 0) {
+      l.reverse();
+      std::reverse(model.begin(), model.end());
+    }
+
+    ASSERT_EQ(l.get_length(), static_cast<int>(model.size()))
+        << "Length should match the model!";
+  }
+
+  EXPECT_EQ(list_ids(l), model) << "List should match the model!";
+
+  std::vector<int> backward;
+  for (auto it = l.end(); it != l.begin();)
+    backward.push_back((--it)->id);
+
+  EXPECT_EQ(backward, std::vector<int>(model.rbegin(), model.rend()))
+      << "Backward links should match the model!";
+}
+
+// ----------
+// Iterators test
+// ----------
+
+TEST(IntrusiveListIterators, Traversal) {
+  std::vector<Task> tasks{1, 2, 3};
+  TaskList l;
+  for (Task &task : tasks)
+    l.push_end(task);
+
+  IntrusiveListIterator<Task, &Task::all> it = l.end();
+  EXPECT_EQ((--it)->id, 3) << "--end() should be the tail!";
+  EXPECT_EQ((--it)->id, 2) << "Should step back!";
+  EXPECT_EQ((--it)->id, 1) << "Should step back!";
+  EXPECT_EQ((--it)->id, 1) << "Should stop at the head!";
+  EXPECT_THROW(*l.end(), std::out_of_range) << "Cannot dereference end()!";
+
+  for (Task &task : l)
+    task.id *= 10;
+
+  EXPECT_EQ(tasks[2].id, 30) << "Iterator should give references!";
+}
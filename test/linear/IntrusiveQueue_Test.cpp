@@ -0,0 +1,186 @@
+#include <IntrusiveQueue.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// Element in two queues at once
+struct Job {
+  int id;
+  IntrusiveQueueHook<Job> pending;
+  IntrusiveQueueHook<Job> retry;
+  Job(int id = 0) : id(id){};
+};
+
+using PendingQueue = IntrusiveQueue<Job, &Job::pending>;
+using RetryQueue = IntrusiveQueue<Job, &Job::retry>;
+
+template <class Q> std::vector<int> queue_ids(const Q &q) {
+  std::vector<int> vec;
+  for (const Job &job : q)
+    vec.push_back(job.id);
+
+  return vec;
+}
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(IntrusiveQueueConstructors, DefaultConstructor) {
+  PendingQueue q;
+
+  EXPECT_TRUE(q.is_empty()) << "Should be empty!";
+  EXPECT_EQ(q.get_head(), nullptr) << "Head should be null!";
+  EXPECT_EQ(q.get_tail(), nullptr) << "Tail should be null!";
+  EXPECT_EQ(q.get_length(), 0) << "Length should be 0!";
+  EXPECT_THROW(q.get_first(), std::length_error) << "Should throw if empty!";
+}
+
+TEST(IntrusiveQueueConstructors, DestructorUnlinks) {
+  Job a(1), b(2);
+  {
+    PendingQueue q;
+    q.enqueue(a);
+    q.enqueue(b);
+  }
+
+  EXPECT_FALSE(PendingQueue::is_linked(a) || PendingQueue::is_linked(b))
+      << "Elements should be unlinked when the queue is destroyed!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(IntrusiveQueueMethods, EnqueueDequeue) {
+  std::vector<Job> jobs{0, 1, 2};
+  PendingQueue q;
+
+  for (Job &job : jobs)
+    q.enqueue(job);
+
+  EXPECT_EQ(queue_ids(q), std::vector<int>({0, 1, 2})) << "Order should match!";
+  EXPECT_EQ(&q.get_first(), &jobs[0]) << "First should be the element!";
+  EXPECT_EQ(&q.get_last(), &jobs[2]) << "Last should be the element!";
+  EXPECT_TRUE(PendingQueue::is_linked(jobs[2])) << "Tail should be linked!";
+  EXPECT_THROW(q.enqueue(jobs[1]), std::invalid_argument)
+      << "Should throw if the element is already linked!";
+
+  EXPECT_EQ(&q.dequeue(), &jobs[0]) << "Should dequeue the first!";
+  EXPECT_FALSE(PendingQueue::is_linked(jobs[0])) << "Hook should be reset!";
+
+  q.enqueue(jobs[0]);
+  EXPECT_EQ(queue_ids(q), std::vector<int>({1, 2, 0})) << "Should link again!";
+
+  q.dequeue();
+  q.dequeue();
+  q.dequeue();
+  EXPECT_TRUE(q.is_empty() && q.get_tail() == nullptr) << "Should be empty!";
+  EXPECT_THROW(q.dequeue(), std::length_error)
+      << "Should throw length_error if queue is empty!";
+}
+
+TEST(IntrusiveQueueMethods, Erase) {
+  std::vector<Job> jobs{0, 1, 2, 3, 4, 5};
+  PendingQueue q;
+  for (Job &job : jobs)
+    q.enqueue(job);
+
+  q.erase(jobs[5]);
+  q.erase(jobs[2]);
+  EXPECT_EQ(queue_ids(q), std::vector<int>({0, 1, 3, 4}))
+      << "Order should match!";
+  EXPECT_EQ(&q.get_last(), &jobs[4]) << "Tail should move back!";
+  EXPECT_THROW(q.erase(jobs[2]), std::invalid_argument)
+      << "Should throw if the element was not found!";
+
+  q.enqueue(jobs[5]);
+  EXPECT_EQ(q.erase_if([](const Job &job) { return job.id % 2 == 1; }), 3)
+      << "Should erase three elements!";
+  EXPECT_EQ(queue_ids(q), std::vector<int>({0, 4})) << "Order should match!";
+  EXPECT_EQ(&q.get_last(), &jobs[4]) << "Tail should match!";
+
+  q.enqueue(jobs[1]);
+  EXPECT_EQ(queue_ids(q), std::vector<int>({0, 4, 1})) << "Tail should link!";
+}
+
+TEST(IntrusiveQueueMethods, TwoHooks) {
+  std::vector<Job> jobs{0, 1, 2, 3};
+  PendingQueue pending;
+  RetryQueue retry;
+
+  for (Job &job : jobs)
+    pending.enqueue(job);
+
+  retry.enqueue(jobs[2]);
+  retry.enqueue(jobs[0]);
+  pending.dequeue();
+
+  EXPECT_EQ(queue_ids(pending), std::vector<int>({1, 2, 3})) << "Should match!";
+  EXPECT_EQ(queue_ids(retry), std::vector<int>({2, 0})) << "Should match!";
+  EXPECT_TRUE(retry.contains(jobs[0]) && !pending.contains(jobs[0]))
+      << "Hooks should be independent!";
+}
+
+TEST(IntrusiveQueueMethods, FindAndReverse) {
+  std::vector<Job> jobs{0, 1, 2, 3};
+  PendingQueue q;
+  for (Job &job : jobs)
+    q.enqueue(job);
+
+  EXPECT_EQ(q.find_if([](const Job &job) { return job.id > 1; }), &jobs[2])
+      << "Should find the first match!";
+  EXPECT_EQ(q.find_if([](const Job &job) { return job.id > 5; }), nullptr)
+      << "Should be null without a match!";
+
+  q.reverse();
+  EXPECT_EQ(queue_ids(q), std::vector<int>({3, 2, 1, 0}))
+      << "Should be reversed!";
+  EXPECT_EQ(&q.dequeue(), &jobs[3]) << "Should dequeue the old tail!";
+
+  Job fresh(4);
+  q.enqueue(fresh);
+  EXPECT_EQ(queue_ids(q), std::vector<int>({2, 1, 0, 4}))
+      << "Links should stay valid after reverse!";
+
+  int sum = 0;
+  q.for_each([&sum](const Job &job) { sum += job.id; });
+  EXPECT_EQ(sum, 7) << "Should visit every element!";
+}
+
+TEST(IntrusiveQueueMethods, MatchesModel) {
+  std::mt19937 rng(9);
+  std::vector<Job> jobs(32);
+  std::vector<int> model;
+  PendingQueue q;
+
+  for (int i = 0; i < 32; i++)
+    jobs[i].id = i;
+
+  for (int step = 0; step < 5000; step++) {
+    int id = rng() % 32;
+
+    if (!PendingQueue::is_linked(jobs[id])) {
+      q.enqueue(jobs[id]);
+      model.push_back(id);
+    } else if (rng() % 2 == 0) {
+      model.erase(model.begin());
+      q.dequeue();
+    } else {
+      q.erase(jobs[id]);
+      for (auto it = model.begin(); it != model.end(); ++it) {
+        if (*it == id) {
+          model.erase(it);
+          break;
+        }
+      }
+    }
+
+    ASSERT_EQ(q.get_length(), static_cast<int>(model.size()))
+        << "Length should match the model!";
+  }
+
+  EXPECT_EQ(queue_ids(q), model) << "Queue should match the model!";
+}
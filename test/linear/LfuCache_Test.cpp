@@ -0,0 +1,117 @@
+#include <LfuCache.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using LfuPairs = std::vector<std::pair<int, std::string>>;
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(LfuCacheConstructors, Constructors) {
+  LfuCache<int, int> c(3);
+
+  EXPECT_TRUE(c.is_empty()) << "Should be empty!";
+  EXPECT_EQ(c.get_capacity(), 3u) << "Capacity should be 3!";
+  EXPECT_EQ(c.get_frequency(1), 0) << "Missing key was never used!";
+  EXPECT_THROW((LfuCache<int, int>(0)), std::invalid_argument)
+      << "Should throw on a zero capacity!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(LfuCacheMethods, Frequencies) {
+  LfuCache<int, std::string> c(3);
+  c.put(1, "a");
+  c.put(2, "b");
+
+  std::string value;
+  EXPECT_TRUE(c.get(1, value) && value == "a") << "Should hit!";
+  EXPECT_TRUE(c.get(1, value)) << "Should hit!";
+  EXPECT_FALSE(c.get(3, value)) << "Should miss!";
+  EXPECT_FALSE(c.put(2, "B")) << "Existing key should be replaced!";
+
+  EXPECT_EQ(c.get_frequency(1), 3) << "Put and two gets!";
+  EXPECT_EQ(c.get_frequency(2), 2) << "Two puts!";
+  EXPECT_EQ(c.to_vector(), LfuPairs({{1, "a"}, {2, "B"}}))
+      << "Most frequently used should be first!";
+  EXPECT_EQ(c.get_stats().hits, 2) << "Two hits!";
+  EXPECT_EQ(c.get_stats().misses, 1) << "One miss!";
+}
+
+TEST(LfuCacheMethods, Eviction) {
+  LfuCache<int, std::string> c(3);
+  std::string value;
+  c.put(1, "a");
+  c.put(2, "b");
+  c.put(3, "c");
+  c.get(1, value);
+  c.get(3, value);
+
+  // 2 was used least
+  c.put(4, "d");
+  EXPECT_FALSE(c.contains(2)) << "Least frequently used should be evicted!";
+
+  // 4 is new, so it goes before the older entries
+  c.put(5, "e");
+  EXPECT_FALSE(c.contains(4)) << "New entry should be evicted first!";
+  EXPECT_EQ(c.to_vector(), LfuPairs({{3, "c"}, {1, "a"}, {5, "e"}}))
+      << "Ties should be ordered by use!";
+
+  // a scan of new keys does not flush the used ones
+  for (int i = 10; i < 20; i++)
+    c.put(i, "x");
+
+  EXPECT_TRUE(c.contains(1) && c.contains(3)) << "Hot keys should stay!";
+  EXPECT_EQ(c.get_stats().evictions, 12) << "Twelve evictions!";
+
+  c.set_capacity(1);
+  EXPECT_EQ(c.to_vector(), LfuPairs({{3, "c"}})) << "Should shrink!";
+}
+
+TEST(LfuCacheMethods, Weigher) {
+  LfuCache<int, std::string> c(
+      10, [](const int &, const std::string &s) { return s.size(); });
+  std::string value;
+
+  c.put(1, "aaaa");
+  c.put(2, "bbbb");
+  c.get(2, value);
+  c.put(3, "cc");
+  EXPECT_EQ(c.get_weight(), 10u) << "Everything should fit!";
+
+  // growing the least used entry evicts the others, never itself
+  c.put(1, "aaaaaaaa");
+  EXPECT_EQ(c.to_vector(), LfuPairs({{1, "aaaaaaaa"}}))
+      << "Should evict until the weight fits!";
+  EXPECT_EQ(c.get_weight(), 8u) << "Weight should be 8!";
+  EXPECT_THROW(c.put(5, std::string(11, 'e')), std::invalid_argument)
+      << "Should throw on an entry heavier than the capacity!";
+}
+
+TEST(LfuCacheMethods, EraseAndClear) {
+  LfuCache<int, int> c(4);
+  int value = 0;
+  for (int i = 0; i < 4; i++)
+    c.put(i, i);
+  c.get(2, value);
+
+  EXPECT_TRUE(c.erase(2)) << "Should erase the key!";
+  EXPECT_FALSE(c.erase(2)) << "Should not erase it twice!";
+  EXPECT_EQ(c.get_length(), 3) << "Length should be 3!";
+  EXPECT_EQ(c.get_frequency(2), 0) << "Erased key has no uses!";
+
+  c.put(2, 2);
+  EXPECT_EQ(c.get_frequency(2), 1) << "Key should start over!";
+
+  c.clear();
+  EXPECT_TRUE(c.is_empty() && c.get_weight() == 0) << "Should be empty!";
+  c.put(1, 1);
+  EXPECT_TRUE(c.get(1, value) && value == 1) << "Should work after clear!";
+}
@@ -2,9 +2,13 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 // ----------
@@ -183,8 +187,10 @@ TEST(LinkedListModify, PushAfter) {
   }
 
   ListNode<double> wrong(100.0);
-  EXPECT_THROW(l.push_after(&wrong, 50.0), std::invalid_argument)
-      << "Should throw invalid_argument if node was not found in the list!";
+  if (LinkedList<double>::checks_handles) {
+    EXPECT_THROW(l.push_after(&wrong, 50.0), std::invalid_argument)
+        << "Should throw invalid_argument if node was not found in the list!";
+  }
 
   node = nullptr;
   EXPECT_THROW(l.push_after(node, 50.0), std::invalid_argument)
@@ -220,8 +226,10 @@ TEST(LinkedListModify, PushBefore) {
   }
 
   ListNode<char> wrong('d');
-  EXPECT_THROW(l.push_before(&wrong, 'z'), std::invalid_argument)
-      << "Should throw invalid_argument if node was not found in the list!";
+  if (LinkedList<char>::checks_handles) {
+    EXPECT_THROW(l.push_before(&wrong, 'z'), std::invalid_argument)
+        << "Should throw invalid_argument if node was not found in the list!";
+  }
 
   node = nullptr;
   EXPECT_THROW(l.push_before(node, 'z'), std::invalid_argument)
@@ -247,7 +255,10 @@ TEST(LinkedListModify, PushIndex) {
   index = 7;
   l.push_index(index, 200);
 
-  std::vector<int> expected{100, 5, 6, 7, 8, 50, 9, 10, 200};
+  index = 9;
+  l.push_index(index, 300);
+
+  std::vector<int> expected{100, 5, 6, 7, 8, 50, 9, 200, 10, 300};
 
   index = 0;
   ListNode<int> *temp = l.get_head();
@@ -338,6 +349,86 @@ TEST(LinkedListModify, PushVector) {
       << "Should throw length_error if list is empty!";
 }
 
+TEST(LinkedListModify, PushRange) {
+  LinkedList<int> l;
+
+  std::istringstream input("3 4 5");
+  l.push_range(0, std::istream_iterator<int>(input),
+               std::istream_iterator<int>()); // single-pass input range
+
+  std::vector<int> front{1, 2}, back{6, 7};
+  l.push_range(0, front.begin(), front.end());
+  l.push_range(l.get_length(), back.begin(), back.end());
+
+  std::vector<int> empty;
+  l.push_range(2, empty.begin(), empty.end());
+
+  EXPECT_EQ(l.to_vector(), std::vector<int>({1, 2, 3, 4, 5, 6, 7}))
+      << "Ranges should be linked at their indexes!";
+  EXPECT_EQ(l.get_length(), 7) << "Length should be 7!";
+  EXPECT_EQ(l.get_tail()->data, 7) << "Tail should be 7!";
+  EXPECT_EQ(l.to_vector(false), std::vector<int>({7, 6, 5, 4, 3, 2, 1}))
+      << "Prev links should be consistent!";
+
+  EXPECT_THROW(l.push_range(8, back.begin(), back.end()), std::out_of_range)
+      << "Should throw out_of_range if provided index is not valid!";
+}
+
+TEST(LinkedListModify, Splice) {
+  LinkedList<int> l(std::vector<int>{1, 5});
+  LinkedList<int> other(std::vector<int>{2, 3, 4});
+  LinkedList<int> empty;
+
+  l.splice(l.begin() + 1, other);
+  EXPECT_EQ(l.to_vector(), std::vector<int>({1, 2, 3, 4, 5}))
+      << "Whole list should be moved before pos!";
+  EXPECT_TRUE(other.is_empty()) << "Other list should be empty!";
+  EXPECT_EQ(l.get_length(), 5) << "Length should be 5!";
+
+  empty.splice(empty.end(), l);
+  EXPECT_EQ(empty.to_vector(false), std::vector<int>({5, 4, 3, 2, 1}))
+      << "Splice into an empty list!";
+
+  EXPECT_THROW(empty.splice(empty.begin(), empty), std::invalid_argument)
+      << "Should throw invalid_argument if list is spliced into itself!";
+}
+
+TEST(LinkedListModify, SpliceRange) {
+  LinkedList<char> l(std::vector<char>{'a', 'e'});
+  LinkedList<char> other(std::vector<char>{'x', 'b', 'c', 'd', 'y'});
+
+  l.splice(l.begin() + 1, other, other.begin() + 1, other.begin() + 4);
+  EXPECT_EQ(l.to_vector(), std::vector<char>({'a', 'b', 'c', 'd', 'e'}))
+      << "Range should be moved before pos!";
+  EXPECT_EQ(other.to_vector(), std::vector<char>({'x', 'y'}))
+      << "Range should be cut out of the other list!";
+  EXPECT_EQ(l.get_length(), 5) << "Length should be 5!";
+  EXPECT_EQ(other.get_length(), 2) << "Other length should be 2!";
+
+  // tail of the other list to the end
+  l.splice(l.end(), other, other.begin() + 1, other.end());
+  EXPECT_EQ(l.get_tail()->data, 'y') << "Tail should be 'y'!";
+  EXPECT_EQ(other.get_tail()->data, 'x') << "Other tail should be 'x'!";
+
+  // inside one list: move [d, e) to the front
+  l.splice(l.begin(), l, l.begin() + 3, l.begin() + 4);
+  EXPECT_EQ(l.to_vector(), std::vector<char>({'d', 'a', 'b', 'c', 'e', 'y'}))
+      << "Range should move inside the list!";
+  EXPECT_EQ(l.to_vector(false),
+            std::vector<char>({'y', 'e', 'c', 'b', 'a', 'd'}))
+      << "Prev links should be consistent!";
+
+  l.splice(l.begin() + 1, l, l.begin() + 1, l.begin() + 3);
+  EXPECT_EQ(l.get_length(), 6) << "Splicing in place changes nothing!";
+
+  EXPECT_THROW(l.splice(l.begin() + 2, l, l.begin() + 1, l.begin() + 4),
+               std::invalid_argument)
+      << "Should throw invalid_argument if pos is inside the range!";
+  EXPECT_THROW(l.splice(l.begin(), other, other.end(), other.begin()),
+               std::invalid_argument)
+      << "Should throw invalid_argument if range starts at end()!";
+}
+
 TEST(LinkedListModify, RemoveEnd) {
   LinkedList<int> l;
 
@@ -366,6 +457,29 @@ TEST(LinkedListModify, RemoveEnd) {
       << "Should throw length_error if list is empty!";
 }
 
+TEST(LinkedListModify, TrustedHandles) {
+  LinkedList<int> l(std::vector<int>{1, 2, 3});
+  LinkedList<int> other(std::vector<int>{4, 5});
+
+  l.relink_trusted(l.get_head(), l, l.get_tail());
+  EXPECT_EQ(l.to_vector(), std::vector<int>({3, 1, 2})) << "Tail to front!";
+  l.relink_trusted(l.get_head(), l, l.get_head());
+  EXPECT_EQ(l.to_vector(), std::vector<int>({3, 1, 2})) << "Already there!";
+
+  l.relink_trusted(nullptr, other, other.get_head());
+  EXPECT_EQ(l.to_vector(false), std::vector<int>({4, 2, 1, 3}))
+      << "Node of the other list to the end!";
+  EXPECT_EQ(other.get_length(), 1) << "Other length should be 1!";
+
+  l.insert_trusted(l.get_head()->next, 7);
+  l.unlink_trusted(l.get_tail());
+  EXPECT_EQ(l.to_vector(), std::vector<int>({3, 7, 1, 2})) << "Should be 3712!";
+  EXPECT_EQ(l.get_length(), 4) << "Length should be 4!";
+
+  EXPECT_THROW(l.unlink_trusted(nullptr), std::invalid_argument)
+      << "Should throw invalid_argument if node is null!";
+}
+
 TEST(LinkedListModify, RemoveBegin) {
   LinkedList<int> l;
 
@@ -421,8 +535,10 @@ TEST(LinkedListModify, RemoveNode) {
   }
 
   ListNode<int> wrong(100);
-  EXPECT_THROW(l.remove_node(&wrong), std::invalid_argument)
-      << "Should throw invalid_argument if node was not found!";
+  if (LinkedList<int>::checks_handles) {
+    EXPECT_THROW(l.remove_node(&wrong), std::invalid_argument)
+        << "Should throw invalid_argument if node was not found!";
+  }
 
   EXPECT_THROW(l.remove_node(nullptr), std::invalid_argument)
       << "Should throw invalid_argument if node is equal to nullptr.";
@@ -584,7 +700,27 @@ TEST(LinkedListIterators, IteratorEnd) {
   LinkedList<int> l(vec);
 
   ListIterator<int> lit = l.end();
-  EXPECT_EQ(*lit, 1) << "End iterator should be pointing at the last element!";
+  EXPECT_EQ(lit.get_node(), nullptr) << "End iterator should be past the tail!";
+  EXPECT_EQ(*(--lit), 1) << "--end() should be pointing at the last element!";
+}
+
+TEST(LinkedListIterators, StdAlgorithms) {
+  std::vector<int> vec{1, 2, 3, 4, 5};
+  LinkedList<int> l(vec);
+
+  static_assert(std::is_same<std::iterator_traits<ListIterator<int>>::
+                                 iterator_category,
+                             std::bidirectional_iterator_tag>::value,
+                "ListIterator should be bidirectional!");
+
+  EXPECT_EQ(std::distance(l.begin(), l.end()), l.get_length())
+      << "Distance should be equal to the length!";
+  EXPECT_EQ(*std::find(l.begin(), l.end(), 3), 3) << "std::find should find 3!";
+  EXPECT_EQ(*std::prev(l.end()), 5) << "std::prev(end()) should be the tail!";
+
+  std::reverse(l.begin(), l.end());
+  EXPECT_EQ(l.to_vector(), std::vector<int>({5, 4, 3, 2, 1}))
+      << "std::reverse should reverse the list!";
 }
 
 // ----------
@@ -613,6 +749,43 @@ TEST(LinkedListMethods, EqualOperator) {
   }
 }
 
+TEST(LinkedListMethods, Owns) {
+  LinkedList<char> l(std::vector<char>{'a', 'b', 'c'});
+  LinkedList<char> other(std::vector<char>{'a', 'b', 'c'});
+  ListNode<char> node('b');
+
+  EXPECT_TRUE(l.owns(l.get_head()->next)) << "Node is linked in the list!";
+  EXPECT_FALSE(l.owns(&node)) << "Equal value is not the same node!";
+  EXPECT_FALSE(l.owns(other.get_tail())) << "Node of another list!";
+  EXPECT_FALSE(l.owns(nullptr)) << "Null is never linked!";
+}
+
+TEST(LinkedListPolicy, DefaultPolicy) {
+#ifdef NDEBUG
+  EXPECT_FALSE(LinkedList<int>::checks_handles)
+      << "Release should trust node handles!";
+#else
+  EXPECT_TRUE(LinkedList<int>::checks_handles)
+      << "Debug should check node handles!";
+#endif
+}
+
+TEST(LinkedListPolicy, ForeignHandle) {
+  LinkedList<int> l(std::vector<int>{1, 2, 3});
+  LinkedList<int> other(std::vector<int>{1, 2, 3});
+
+  if (!LinkedList<int>::checks_handles)
+    GTEST_SKIP() << "Node handles are trusted in this build!";
+
+  EXPECT_THROW(l.remove_node(other.get_head()), std::invalid_argument)
+      << "Node of another list should be rejected!";
+  EXPECT_THROW(l.remove_after(other.get_head()), std::invalid_argument)
+      << "Node of another list should be rejected!";
+  EXPECT_THROW(l.remove_before(other.get_tail()), std::invalid_argument)
+      << "Node of another list should be rejected!";
+  EXPECT_EQ(other.get_length(), 3) << "Other list should be untouched!";
+}
+
 TEST(LinkedListMethods, Contains) {
   std::vector<char> vec{'a', 'b', 'c', 'd', 'e'};
   LinkedList<char> l(vec.begin(), vec.end());
@@ -710,6 +883,200 @@ TEST(LinkedListMethods, GetNode) {
       << "Should throw length_error if list is empty!";
 }
 
+TEST(LinkedListMethods, CursorSequentialAccess) {
+  std::vector<int> vec(100);
+  for (int i = 0; i < 100; ++i)
+    vec[i] = i * 3;
+
+  LinkedList<int> l(vec);
+
+  for (int i = 0; i < 100; ++i)
+    EXPECT_EQ(l.get_node_by_index(i)->data, vec[i])
+        << "Forward walk should match the vector!";
+
+  for (int i = 99; i >= 0; i -= 7)
+    EXPECT_EQ(l.get_node_by_index(i)->data, vec[i])
+        << "Backward walk should match the vector!";
+
+  EXPECT_THROW(l.get_node_by_index(100), std::out_of_range)
+      << "Should throw out_of_range past the end!";
+}
+
+TEST(LinkedListMethods, CursorPushMiddle) {
+  LinkedList<int> l;
+  std::vector<int> model;
+
+  for (int i = 0; i < 200; ++i) {
+    int index = model.size() < 2 ? static_cast<int>(model.size())
+                                 : (static_cast<int>(model.size()) - 1) / 2 + 1;
+    model.insert(model.begin() + index, i);
+    l.push_middle(i);
+
+    if (i % 50 == 0)
+      l.get_node_by_index(static_cast<int>(model.size()) - 1);
+  }
+
+  EXPECT_EQ(l.to_vector(), model) << "push_middle should match the model!";
+  EXPECT_EQ(l.get_tail()->data, model.back()) << "Tail should be correct!";
+}
+
+TEST(LinkedListMethods, CursorInvalidation) {
+  std::vector<int> model{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  LinkedList<int> l(model), other(std::vector<int>{100, 101, 102});
+
+  auto check = [&](const std::string &step) {
+    ASSERT_EQ(l.get_length(), static_cast<int>(model.size())) << step << "!";
+    for (int i = 0; i < l.get_length(); ++i)
+      EXPECT_EQ(l.get_node_by_index(i)->data, model[i]) << step << "!";
+    for (int i = l.get_length() - 1; i >= 0; i -= 3)
+      EXPECT_EQ(l.get_node_by_index(i)->data, model[i]) << step << "!";
+  };
+
+  l.get_node_by_index(5);
+  l.push_begin(-1);
+  model.insert(model.begin(), -1);
+  check("push_begin");
+
+  l.get_node_by_index(6);
+  l.remove_index(6);
+  model.erase(model.begin() + 6);
+  check("remove_index on the finger");
+
+  l.get_node_by_index(8);
+  l.remove_begin();
+  model.erase(model.begin());
+  check("remove_begin");
+
+  l.get_node_by_index(4);
+  l.push_after(l.get_node_by_index(2), 50);
+  model.insert(model.begin() + 3, 50);
+  check("push_after");
+
+  l.get_node_by_index(6);
+  l.push_before(l.get_head(), 60);
+  model.insert(model.begin(), 60);
+  check("push_before");
+
+  l.push_end(7);
+  l.get_node_by_index(5);
+  l.remove_all(7);
+  model.erase(std::remove(model.begin(), model.end(), 7), model.end());
+  check("remove_all");
+
+  l.get_node_by_index(3);
+  l.remove_if([](int x) { return x % 3 == 0; });
+  model.erase(std::remove_if(model.begin(), model.end(),
+                             [](int x) { return x % 3 == 0; }),
+              model.end());
+  check("remove_if");
+
+  l.get_node_by_index(2);
+  other.get_node_by_index(1);
+  l.splice(l.begin() + 1, other);
+  model.insert(model.begin() + 1, {100, 101, 102});
+  check("splice");
+  EXPECT_TRUE(other.is_empty()) << "Other list should be empty!";
+
+  other.push_end(1);
+  EXPECT_EQ(other.get_node_by_index(0)->data, 1)
+      << "Emptied list should not keep stale cursors!";
+
+  l.get_node_by_index(l.get_length() - 1);
+  l.remove_end();
+  model.pop_back();
+  check("remove_end");
+
+  l.get_node_by_index(1);
+  l.push_middle(77);
+  model.insert(model.begin() + (static_cast<int>(model.size()) - 1) / 2 + 1,
+               77);
+  check("push_middle");
+
+  l.clear();
+  model.clear();
+  l.push_end(5);
+  model.push_back(5);
+  check("clear");
+}
+
+TEST(LinkedListMethods, Sort) {
+  std::vector<int> vec{5, -3, 9, 0, 2, 2, 7, -8, 1, 4, 6};
+  LinkedList<int> l(vec);
+  ListNode<int> *nine = l.get_node_by_value(9);
+
+  l.sort();
+  std::sort(vec.begin(), vec.end());
+
+  EXPECT_EQ(l.to_vector(), vec) << "List should be sorted!";
+  EXPECT_EQ(l.to_vector(false), std::vector<int>(vec.rbegin(), vec.rend()))
+      << "Prev links should be restored!";
+  EXPECT_EQ(l.get_tail()->data, 9) << "Tail should be the largest element!";
+  EXPECT_EQ(l.get_tail(), nine) << "Nodes should be relinked, not copied!";
+  EXPECT_EQ(l.get_node_by_index(5)->data, vec[5])
+      << "Index access should see the new order!";
+
+  l.sort(std::greater<int>());
+  std::reverse(vec.begin(), vec.end());
+  EXPECT_EQ(l.to_vector(), vec) << "Should sort with a custom comparator!";
+
+  l.push_end(-100);
+  EXPECT_EQ(l.get_tail()->data, -100) << "Tail should stay consistent!";
+
+  LinkedList<int> empty, single(std::vector<int>{1});
+  empty.sort();
+  single.sort();
+  EXPECT_TRUE(empty.is_empty()) << "Empty list should stay empty!";
+  EXPECT_EQ(single.get_head(), single.get_tail()) << "Single node list!";
+}
+
+TEST(LinkedListMethods, SortIsStable) {
+  std::vector<std::string> vec;
+  for (int i = 0; i < 100; i++)
+    vec.push_back(std::string(1, 'a' + i % 5) + std::to_string(i));
+
+  LinkedList<std::string> l(vec);
+  auto by_letter = [](const std::string &a, const std::string &b) {
+    return a[0] < b[0];
+  };
+
+  l.sort(by_letter);
+  std::stable_sort(vec.begin(), vec.end(), by_letter);
+
+  EXPECT_EQ(l.to_vector(), vec) << "Equal keys should keep their order!";
+}
+
+TEST(LinkedListMethods, Merge) {
+  LinkedList<int> l1(std::vector<int>{1, 3, 5, 7}),
+      l2(std::vector<int>{0, 3, 4, 8, 9});
+  ListNode<int> *three = l1.get_node_by_index(1);
+
+  l1.merge(l2);
+
+  EXPECT_EQ(l1.to_vector(), std::vector<int>({0, 1, 3, 3, 4, 5, 7, 8, 9}))
+      << "Lists should be merged in order!";
+  EXPECT_EQ(l1.get_node_by_index(2), three)
+      << "On ties the node of this list should go first!";
+  EXPECT_EQ(l1.to_vector(false),
+            std::vector<int>({9, 8, 7, 5, 4, 3, 3, 1, 0}))
+      << "Prev links should be consistent!";
+  EXPECT_EQ(l1.get_length(), 9) << "Length should be 9!";
+  EXPECT_TRUE(l2.is_empty()) << "Other list should be empty!";
+  EXPECT_EQ(l2.get_tail(), nullptr) << "Other tail should be nullptr!";
+
+  LinkedList<int> empty;
+  empty.merge(l1);
+  EXPECT_EQ(empty.get_length(), 9) << "Empty list should take all nodes!";
+  EXPECT_EQ(empty.get_tail()->data, 9) << "Tail should be 9!";
+
+  empty.merge(empty);
+  EXPECT_EQ(empty.get_length(), 9) << "Merging with itself does nothing!";
+
+  LinkedList<int> desc(std::vector<int>{10, 6, 2}), other(std::vector<int>{7});
+  desc.merge(other, std::greater<int>());
+  EXPECT_EQ(desc.to_vector(), std::vector<int>({10, 7, 6, 2}))
+      << "Should merge with a custom comparator!";
+}
+
 // ----------
 // Compare test
 // ----------
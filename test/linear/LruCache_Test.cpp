@@ -0,0 +1,120 @@
+#include <LruCache.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using LruPairs = std::vector<std::pair<int, std::string>>;
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(LruCacheConstructors, Constructors) {
+  LruCache<int, int> c(3);
+
+  EXPECT_TRUE(c.is_empty()) << "Should be empty!";
+  EXPECT_EQ(c.get_capacity(), 3u) << "Capacity should be 3!";
+  EXPECT_EQ(c.get_weight(), 0u) << "Weight should be 0!";
+  EXPECT_THROW((LruCache<int, int>(0)), std::invalid_argument)
+      << "Should throw on a zero capacity!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(LruCacheMethods, GetAndPut) {
+  LruCache<int, std::string> c(3);
+
+  EXPECT_TRUE(c.put(1, "a")) << "New key should be added!";
+  EXPECT_TRUE(c.put(2, "b")) << "New key should be added!";
+  EXPECT_FALSE(c.put(1, "A")) << "Existing key should be replaced!";
+
+  std::string value;
+  EXPECT_TRUE(c.get(1, value) && value == "A") << "Should hit the new value!";
+  EXPECT_FALSE(c.get(3, value)) << "Should miss a missing key!";
+  EXPECT_EQ(c.get_length(), 2) << "Length should be 2!";
+  EXPECT_EQ(c.to_vector(), LruPairs({{1, "A"}, {2, "b"}}))
+      << "Most recently used should be first!";
+
+  EXPECT_EQ(c.get_stats().hits, 1) << "One hit!";
+  EXPECT_EQ(c.get_stats().misses, 1) << "One miss!";
+  EXPECT_DOUBLE_EQ(c.get_stats().hit_ratio(), 0.5) << "Half were hits!";
+}
+
+TEST(LruCacheMethods, Eviction) {
+  LruCache<int, std::string> c(3);
+  c.put(1, "a");
+  c.put(2, "b");
+  c.put(3, "c");
+
+  std::string value;
+  c.get(1, value);
+  c.put(4, "d");
+
+  EXPECT_FALSE(c.contains(2)) << "Least recently used should be evicted!";
+  EXPECT_EQ(c.to_vector(), LruPairs({{4, "d"}, {1, "a"}, {3, "c"}}))
+      << "Order of use should match!";
+  EXPECT_EQ(c.get_stats().evictions, 1) << "One eviction!";
+
+  c.put(3, "C");
+  c.put(5, "e");
+  EXPECT_EQ(c.to_vector(), LruPairs({{5, "e"}, {3, "C"}, {4, "d"}}))
+      << "Replacing should count as a use!";
+
+  c.set_capacity(1);
+  EXPECT_EQ(c.to_vector(), LruPairs({{5, "e"}})) << "Should shrink!";
+  EXPECT_EQ(c.get_stats().evictions, 4) << "Four evictions!";
+
+  c.reset_stats();
+  EXPECT_EQ(c.get_stats().evictions, 0) << "Counters should be reset!";
+}
+
+TEST(LruCacheMethods, Weigher) {
+  LruCache<int, std::string> c(
+      10, [](const int &, const std::string &s) { return s.size(); });
+
+  c.put(1, "aaaa");
+  c.put(2, "bbbb");
+  EXPECT_EQ(c.get_weight(), 8u) << "Weight should be 8!";
+
+  c.put(3, "cc");
+  EXPECT_EQ(c.get_weight(), 10u) << "Weight should be 10!";
+  EXPECT_EQ(c.get_length(), 3) << "Everything should fit!";
+
+  c.put(4, "ddddd");
+  EXPECT_EQ(c.to_vector(), LruPairs({{4, "ddddd"}, {3, "cc"}}))
+      << "Should evict until the weight fits!";
+  EXPECT_EQ(c.get_weight(), 7u) << "Weight should be 7!";
+
+  c.put(3, "cccccc");
+  EXPECT_EQ(c.to_vector(), LruPairs({{3, "cccccc"}})) << "Heavier value!";
+  EXPECT_THROW(c.put(5, std::string(11, 'e')), std::invalid_argument)
+      << "Should throw on an entry heavier than the capacity!";
+}
+
+TEST(LruCacheMethods, EraseAndClear) {
+  LruCache<int, int> c(4);
+  for (int i = 0; i < 4; i++)
+    c.put(i, i * i);
+
+  EXPECT_TRUE(c.erase(2)) << "Should erase the key!";
+  EXPECT_FALSE(c.erase(2)) << "Should not erase it twice!";
+  EXPECT_EQ(c.get_length(), 3) << "Length should be 3!";
+  EXPECT_EQ(c.get_weight(), 3u) << "Weight should be 3!";
+
+  c.put(4, 16);
+  c.put(5, 25);
+  EXPECT_FALSE(c.contains(0)) << "0 should be evicted!";
+  EXPECT_EQ(c.get_stats().evictions, 1) << "Erasing is not an eviction!";
+
+  c.clear();
+  EXPECT_TRUE(c.is_empty() && c.get_weight() == 0) << "Should be empty!";
+
+  int value = 0;
+  c.put(1, 1);
+  EXPECT_TRUE(c.get(1, value) && value == 1) << "Should work after clear!";
+}
@@ -0,0 +1,79 @@
+#include <MinMaxStack.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(MinMaxStackConstructors, Constructors) {
+  MinMaxStack<int> s1;
+  MinMaxStack<int> s2(std::vector<int>{3, 1, 4, 1, 5});
+
+  EXPECT_TRUE(s1.is_empty()) << "Should be empty!";
+  EXPECT_EQ(s1.get_capacity(), 10) << "Default capacity should be 10!";
+  EXPECT_EQ(s2.get_size(), 5) << "Size should be 5!";
+  EXPECT_EQ(s2.min(), 1) << "Min should be 1!";
+  EXPECT_EQ(s2.max(), 5) << "Max should be 5!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(MinMaxStackMethods, PushAndPop) {
+  MinMaxStack<int> s(8);
+  std::vector<int> values{5, 3, 7, 3, 9, 1};
+  std::vector<int> mins{5, 3, 3, 3, 3, 1}, maxs{5, 5, 7, 7, 9, 9};
+
+  for (int i = 0; i < static_cast<int>(values.size()); i++) {
+    s.push(values[i]);
+    EXPECT_EQ(s.min(), mins[i]) << "Wrong min after push #" << i;
+    EXPECT_EQ(s.max(), maxs[i]) << "Wrong max after push #" << i;
+  }
+
+  for (int i = static_cast<int>(values.size()) - 1; i > 0; i--) {
+    EXPECT_EQ(s.pop(), values[i]) << "Should pop in LIFO order!";
+    EXPECT_EQ(s.min(), mins[i - 1]) << "Wrong min after pop #" << i;
+    EXPECT_EQ(s.max(), maxs[i - 1]) << "Wrong max after pop #" << i;
+  }
+
+  s.pop();
+  EXPECT_THROW(s.min(), std::underflow_error) << "Stack underflow!";
+  EXPECT_THROW(s.pop(), std::underflow_error) << "Stack underflow!";
+}
+
+TEST(MinMaxStackMethods, CustomComparator) {
+  auto by_length = [](const std::string &a, const std::string &b) {
+    return a.size() < b.size();
+  };
+  MinMaxStack<std::string, decltype(by_length)> s(4, by_length);
+
+  s.push("abc");
+  s.push("a");
+  s.push("abcde");
+
+  EXPECT_EQ(s.min(), "a") << "Shortest string should be 'a'!";
+  EXPECT_EQ(s.max(), "abcde") << "Longest string should be 'abcde'!";
+
+  MinMaxStack<int, std::greater<int>> reversed(4);
+  reversed.push(1);
+  reversed.push(2);
+  EXPECT_EQ(reversed.min(), 2) << "Order should be reversed!";
+}
+
+TEST(MinMaxStackMethods, Resize) {
+  MinMaxStack<int> s(1);
+  s.push(2);
+  EXPECT_THROW(s.push(1), std::overflow_error) << "Stack overflow!";
+
+  s.resize(4);
+  s.push(1);
+  EXPECT_EQ(s.get_capacity(), 4) << "Capacity should be 4!";
+  EXPECT_EQ(s.min(), 1) << "Min should be 1!";
+  EXPECT_EQ(s.to_vector(), std::vector<int>({2, 1})) << "Values should stay!";
+}
@@ -0,0 +1,45 @@
+#include <DynamicArray.h>
+#include <MonotonicStack.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+// ----------
+// Methods test
+// ----------
+
+TEST(MonotonicStackMethods, Push) {
+  MonotonicStack<int> s(2);
+
+  EXPECT_EQ(s.push(3), 0) << "Nothing should be popped!";
+  EXPECT_EQ(s.push(5), 0) << "Nothing should be popped!";
+  EXPECT_EQ(s.push(7), 0) << "Stack should grow past its capacity!";
+  EXPECT_EQ(s.push(4), 2) << "5 and 7 should be popped!";
+  EXPECT_EQ(s.to_vector(), std::vector<int>({3, 4})) << "Should be increasing!";
+
+  MonotonicStack<int, std::greater<int>> d;
+  d.push(3);
+  d.push(5);
+  EXPECT_EQ(d.to_vector(), std::vector<int>({5})) << "Should be decreasing!";
+  EXPECT_EQ(d.pop(), 5) << "Should pop 5!";
+  EXPECT_THROW(d.pop(), std::underflow_error) << "Stack underflow!";
+}
+
+TEST(MonotonicStackMethods, NextAndPrevious) {
+  DynamicArray<int> d(std::vector<int>{2, 1, 2, 4, 3});
+
+  EXPECT_EQ(MonotonicStack<int>::next_greater(d).to_vector(),
+            std::vector<int>({3, 2, 3, -1, -1}))
+      << "Wrong next greater indexes!";
+  EXPECT_EQ(MonotonicStack<int>::next_smaller(d).to_vector(),
+            std::vector<int>({1, -1, -1, 4, -1}))
+      << "Wrong next smaller indexes!";
+  EXPECT_EQ(MonotonicStack<int>::previous_greater(d).to_vector(),
+            std::vector<int>({-1, 0, -1, -1, 3}))
+      << "Wrong previous greater indexes!";
+  EXPECT_EQ(MonotonicStack<int>::previous_smaller(d).to_vector(),
+            std::vector<int>({-1, -1, 1, 2, 2}))
+      << "Wrong previous smaller indexes!";
+}
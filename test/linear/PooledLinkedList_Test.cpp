@@ -0,0 +1,262 @@
+#include <PooledLinkedList.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using Index = PooledLinkedList<int>::Index;
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(PooledLinkedListConstructors, DefaultConstructor) {
+  PooledLinkedList<int> l;
+
+  EXPECT_TRUE(l.is_empty()) << "Should be empty!";
+  EXPECT_EQ(l.get_head(), PooledLinkedList<int>::null) << "Head should be null!";
+  EXPECT_EQ(l.get_tail(), PooledLinkedList<int>::null) << "Tail should be null!";
+  EXPECT_EQ(l.get_capacity(), 0u) << "Pool should be empty!";
+  EXPECT_TRUE(l.is_compact()) << "Empty list should be compact!";
+  EXPECT_TRUE(l.begin() == l.end()) << "begin() should be end()!";
+}
+
+TEST(PooledLinkedListConstructors, Constructors) {
+  std::vector<int> vec{1, 2, 3, 4, 5};
+  PooledLinkedList<int> l1(vec), l2(vec.begin(), vec.end()), l3(4, 9);
+  PooledLinkedList<int> l4(l1);
+
+  EXPECT_EQ(l1.to_vector(), vec) << "Should keep the order of the vector!";
+  EXPECT_TRUE(l1 == l2 && l1 == l4) << "Lists should be equal!";
+  EXPECT_EQ(l3.to_vector(), std::vector<int>(4, 9)) << "Should be filled!";
+  EXPECT_TRUE(l1.is_compact()) << "Built by push_end, should be compact!";
+
+  l4 = l3;
+  EXPECT_TRUE(l4 == l3 && l4 != l1) << "Should be a copy of l3!";
+
+  l3.push_end(1);
+  EXPECT_EQ(l4.get_length(), 4u) << "Copy should not share the pool!";
+}
+
+TEST(PooledLinkedListConstructors, LinkSize) {
+  EXPECT_EQ(sizeof(PooledNode<int>), 12u)
+      << "Node of int should be 4 bytes of data and two 32-bit links!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(PooledLinkedListMethods, PushAndHandles) {
+  PooledLinkedList<std::string> l;
+  Index b = l.push_end("b");
+  Index a = l.push_begin("a");
+  Index d = l.push_end("d");
+  Index c = l.push_after(b, "c");
+  l.push_before(a, "_");
+
+  EXPECT_EQ(l.to_string(), "_ <-> a <-> b <-> c <-> d")
+      << "Order should be kept!";
+  EXPECT_EQ(l.data(c), "c") << "Handle should point to its element!";
+  EXPECT_EQ(l.next(b), c) << "Next of b should be c!";
+  EXPECT_EQ(l.prev(d), c) << "Prev of d should be c!";
+  EXPECT_FALSE(l.is_compact()) << "Inserting inside breaks the order!";
+
+  EXPECT_THROW(l.push_after(100, "x"), std::invalid_argument)
+      << "Should throw on a slot outside the pool!";
+  EXPECT_THROW(l.push_after(PooledLinkedList<std::string>::null, "x"),
+               std::invalid_argument)
+      << "Should throw on the null index!";
+}
+
+TEST(PooledLinkedListMethods, PushIndex) {
+  PooledLinkedList<int> l(std::vector<int>{0, 1, 2, 3});
+
+  l.push_index(2, 10);
+  l.push_index(0, 20);
+  l.push_index(6, 30);
+
+  EXPECT_EQ(l.to_vector(), std::vector<int>({20, 0, 1, 10, 2, 3, 30}))
+      << "Elements should be inserted by index!";
+  EXPECT_THROW(l.push_index(8, 0), std::out_of_range)
+      << "Should throw out_of_range!";
+}
+
+TEST(PooledLinkedListMethods, FreeListReuse) {
+  PooledLinkedList<int> l(std::vector<int>{0, 1, 2, 3, 4, 5});
+  Index one = l.get_node_by_index(1), three = l.get_node_by_index(3);
+
+  l.remove_node(one);
+  l.remove_node(three);
+
+  EXPECT_EQ(l.get_free_count(), 2u) << "Two slots should be free!";
+  EXPECT_EQ(l.get_capacity(), 6u) << "Pool should not shrink!";
+  EXPECT_FALSE(l.owns(one)) << "Removed slot should not be owned!";
+  EXPECT_THROW(l.remove_node(one), std::invalid_argument)
+      << "Removing a free slot should throw!";
+
+  Index a = l.push_end(6), b = l.push_end(7);
+  EXPECT_TRUE((a == one && b == three) || (a == three && b == one))
+      << "Free slots should be reused!";
+  EXPECT_TRUE(l.owns(one)) << "A reused slot is owned again!";
+  EXPECT_EQ(l.get_capacity(), 6u) << "Pool should not grow!";
+  EXPECT_EQ(l.get_free_count(), 0u) << "No slot should be free!";
+  EXPECT_EQ(l.to_vector(), std::vector<int>({0, 2, 4, 5, 6, 7}))
+      << "Order should be kept!";
+}
+
+TEST(PooledLinkedListMethods, Remove) {
+  PooledLinkedList<int> l(std::vector<int>{1, 2, 3, 2, 4, 5, 2, 6});
+
+  l.remove_begin();
+  l.remove_end();
+  l.remove_index(2);
+  l.remove_value(4);
+
+  EXPECT_EQ(l.to_vector(), std::vector<int>({2, 3, 5, 2})) << "Should match!";
+
+  l.remove_all(2);
+  EXPECT_EQ(l.to_vector(), std::vector<int>({3, 5})) << "All 2 removed!";
+  EXPECT_THROW(l.remove_all(2), std::invalid_argument)
+      << "Should throw if value was not found!";
+
+  l.remove_if([](int x) { return x > 0; });
+  EXPECT_TRUE(l.is_empty()) << "Everything should be removed!";
+  EXPECT_EQ(l.get_capacity(), 0u) << "Empty list should drop its pool!";
+  EXPECT_TRUE(l.is_compact()) << "Empty list should be compact!";
+  EXPECT_THROW(l.remove_begin(), std::length_error)
+      << "Should throw length_error if list is empty!";
+}
+
+TEST(PooledLinkedListMethods, RemoveEndKeepsCompact) {
+  PooledLinkedList<int> l(std::vector<int>{1, 2, 3, 4});
+
+  l.remove_end();
+  l.push_end(5);
+
+  EXPECT_TRUE(l.is_compact()) << "Pops at the end keep the pool in order!";
+  EXPECT_EQ(l.get_free_count(), 0u) << "No slot should be free!";
+  EXPECT_EQ(l.get_node_by_index(3), 3u) << "Position 3 should be slot 3!";
+}
+
+TEST(PooledLinkedListMethods, Compact) {
+  PooledLinkedList<int> l;
+  for (int i = 0; i < 10; i++)
+    l.push_begin(i);
+  for (int i = 0; i < 10; i += 2)
+    l.remove_value(i);
+
+  EXPECT_FALSE(l.is_compact()) << "List should be fragmented!";
+  std::vector<int> before = l.to_vector();
+
+  l.compact();
+
+  EXPECT_TRUE(l.is_compact()) << "List should be compact!";
+  EXPECT_EQ(l.to_vector(), before) << "Order should be kept!";
+  EXPECT_EQ(l.to_vector(false),
+            std::vector<int>(before.rbegin(), before.rend()))
+      << "Backward links should be rewritten!";
+  EXPECT_EQ(l.get_capacity(), 5u) << "Free slots should be dropped!";
+  EXPECT_EQ(l.get_free_count(), 0u) << "No slot should be free!";
+
+  for (Index i = 0; i < l.get_length(); i++)
+    EXPECT_EQ(l.get_node_by_index(i), i) << "Position should be the slot!";
+
+  l.push_index(1, 100);
+  EXPECT_FALSE(l.is_compact()) << "Insertion inside breaks the order!";
+  EXPECT_EQ(l.data(l.get_node_by_index(1)), 100) << "Should walk again!";
+}
+
+TEST(PooledLinkedListMethods, MatchesModel) {
+  std::mt19937 rng(11);
+  PooledLinkedList<int> l;
+  std::vector<int> model;
+
+  for (int step = 0; step < 5000; step++) {
+    Index n = static_cast<Index>(model.size());
+    switch (rng() % 6) {
+    case 0:
+    case 1: {
+      Index index = rng() % (n + 1);
+      l.push_index(index, step);
+      model.insert(model.begin() + index, step);
+      break;
+    }
+    case 2:
+    case 3:
+      if (n > 0) {
+        Index index = rng() % n;
+        l.remove_index(index);
+        model.erase(model.begin() + index);
+      }
+      break;
+    case 4:
+      l.push_end(step);
+      model.push_back(step);
+      break;
+    default:
+      if (step % 50 == 0)
+        l.compact();
+      break;
+    }
+
+    ASSERT_EQ(l.get_length() + l.get_free_count(), l.get_capacity())
+        << "Every slot should be used or free!";
+  }
+
+  EXPECT_EQ(l.to_vector(), model) << "List should match the model!";
+  EXPECT_EQ(l.to_vector(false), std::vector<int>(model.rbegin(), model.rend()))
+      << "Backward links should match the model!";
+}
+
+TEST(PooledLinkedListMethods, Find) {
+  PooledLinkedList<int> l(std::vector<int>{5, 6, 7, 8});
+  l.push_begin(4);
+
+  EXPECT_EQ(l.data(l.get_node_by_value(7)), 7) << "Should find 7!";
+  EXPECT_THROW(l.get_node_by_value(100), std::invalid_argument)
+      << "Should throw if value was not found!";
+  EXPECT_TRUE(l.contains(4)) << "Should contain 4!";
+  EXPECT_FALSE(l.contains(9)) << "Should not contain 9!";
+  EXPECT_THROW(l.get_node_by_index(5), std::out_of_range)
+      << "Should throw out_of_range!";
+}
+
+TEST(PooledLinkedListMethods, ToString) {
+  PooledLinkedList<int> l(std::vector<int>{1, 2, 3});
+
+  EXPECT_EQ(l.to_string(), "1 <-> 2 <-> 3") << "String should match!";
+  EXPECT_EQ(l.to_string(false), "3 <-> 2 <-> 1") << "String should match!";
+
+  l.clear();
+  EXPECT_THROW(l.to_string(), std::length_error)
+      << "Should throw length_error if list is empty!";
+}
+
+// ----------
+// Iterators test
+// ----------
+
+TEST(PooledLinkedListIterators, Traversal) {
+  PooledLinkedList<int> l(std::vector<int>{2, 3, 4});
+  l.push_begin(1);
+
+  std::vector<int> forward(l.begin(), l.end());
+  EXPECT_EQ(forward, std::vector<int>({1, 2, 3, 4})) << "Should match!";
+
+  std::vector<int> backward;
+  PooledListIterator<int> it = l.end();
+  while (it != l.begin())
+    backward.push_back(*--it);
+
+  EXPECT_EQ(backward, std::vector<int>({4, 3, 2, 1})) << "Should match!";
+  EXPECT_THROW(*l.end(), std::out_of_range) << "Cannot dereference end()!";
+
+  *l.begin() = 10;
+  EXPECT_EQ(*std::max_element(l.begin(), l.end()), 10)
+      << "Iterator should give references!";
+}
@@ -0,0 +1,118 @@
+#include <DynamicArray.h>
+#include <PriorityQueue.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(PriorityQueueConstructors, Constructors) {
+  PriorityQueue<int> q1;
+  PriorityQueue<int> q2(std::vector<int>{3, 1, 4, 1, 5, 9, 2, 6});
+  PriorityQueue<int> q3(DynamicArray<int>(std::vector<int>{7, 3, 8}));
+  PriorityQueue<int> q4(q2);
+
+  EXPECT_TRUE(q1.is_empty()) << "Should be empty!";
+  EXPECT_EQ(q1.get_capacity(), 10) << "Default capacity should be 10!";
+  EXPECT_EQ(q2.top(), 9) << "Top should be 9!";
+  EXPECT_EQ(q3.top(), 8) << "Top should be 8!";
+  EXPECT_EQ(q4.to_sorted_vector(), q2.to_sorted_vector())
+      << "Copy should be equal!";
+
+  q4.pop();
+  EXPECT_EQ(q2.get_size(), 8) << "Copy should be deep!";
+
+  q1 = q3;
+  EXPECT_EQ(q1.to_sorted_vector(), std::vector<int>({8, 7, 3}))
+      << "Wrong elements after assign!";
+  EXPECT_THROW(PriorityQueue<int>(-1), std::invalid_argument)
+      << "Negative capacity!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+template <int Arity> void check_heap_sort() {
+  std::vector<int> values;
+  for (int i = 0; i < 1000; i++)
+    values.push_back((i * 7919) % 1013 - 500);
+
+  PriorityQueue<int, std::less<int>, Arity> q(4);
+  for (int value : values)
+    q.push(value);
+
+  std::vector<int> expected = values;
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+  EXPECT_EQ(q.to_sorted_vector(), expected)
+      << "Wrong pop order for arity " << Arity;
+
+  PriorityQueue<int, std::less<int>, Arity> heapified(values);
+  EXPECT_EQ(heapified.to_sorted_vector(), expected)
+      << "Wrong pop order after heapify for arity " << Arity;
+}
+
+TEST(PriorityQueueMethods, Arity) {
+  check_heap_sort<2>();
+  check_heap_sort<3>();
+  check_heap_sort<4>();
+  check_heap_sort<8>();
+
+  EXPECT_EQ((PriorityQueue<int, std::less<int>, 4>::get_arity()), 4)
+      << "Arity should be 4!";
+}
+
+TEST(PriorityQueueMethods, PushAndPop) {
+  PriorityQueue<int, std::greater<int>> q(1);
+
+  q.push(5);
+  q.push(2);
+  q.push(8);
+  q.push(2);
+
+  EXPECT_EQ(q.get_size(), 4) << "Size should be 4!";
+  EXPECT_EQ(q.top(), 2) << "Min-heap top should be 2!";
+  EXPECT_EQ(q.pop(), 2) << "Should pop 2!";
+  EXPECT_EQ(q.pop(), 2) << "Should pop 2 again!";
+  EXPECT_EQ(q.pop(), 5) << "Should pop 5!";
+  EXPECT_EQ(q.pop(), 8) << "Should pop 8!";
+
+  EXPECT_THROW(q.pop(), std::length_error) << "Priority queue is empty!";
+  EXPECT_THROW(q.top(), std::length_error) << "Priority queue is empty!";
+  EXPECT_THROW(q.pop_push(1), std::length_error) << "Priority queue is empty!";
+}
+
+TEST(PriorityQueueMethods, PushRangeAndPopPush) {
+  PriorityQueue<std::string> q;
+
+  q.push("m");
+  q.push_range(std::vector<std::string>{"a", "z", "q"}); // heapify path
+  q.push_range(std::vector<std::string>{"b"});           // sift up path
+
+  EXPECT_EQ(q.to_sorted_vector(),
+            std::vector<std::string>({"z", "q", "m", "b", "a"}))
+      << "Wrong pop order after push_range!";
+
+  EXPECT_EQ(q.pop_push("c"), "z") << "Should return the old top!";
+  EXPECT_EQ(q.top(), "q") << "New top should be 'q'!";
+  EXPECT_EQ(q.pop_push("x"), "q") << "Should return the old top!";
+  EXPECT_EQ(q.top(), "x") << "Pushed value can become the top!";
+
+  std::istringstream words("k d y");
+  q.push_range(std::istream_iterator<std::string>(words),
+               std::istream_iterator<std::string>()); // single pass
+  EXPECT_EQ(q.get_size(), 8) << "Every streamed word should be pushed!";
+  EXPECT_EQ(q.top(), "y") << "Streamed word can become the top!";
+
+  q.clear();
+  EXPECT_TRUE(q.is_empty()) << "Should be empty after clear!";
+}
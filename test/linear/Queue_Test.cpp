@@ -2,9 +2,13 @@
 #include <QueueIterator.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 // ----------
@@ -225,7 +229,7 @@ TEST(QueueModify, EraseIterator) {
   std::vector<std::string> vec{"a", "ab", "abc", "abcd", "abcde"};
   Queue<std::string> q(vec.begin(), vec.end());
 
-  QueueIterator<std::string> qit = q.end();
+  QueueIterator<std::string> qit = q.begin() + 4;
   q.erase(qit);
 
   EXPECT_EQ(q.get_length(), vec.size() - 1)
@@ -293,7 +297,25 @@ TEST(QueueIterators, IteratorEnd) {
   Queue<int> q(vec);
 
   QueueIterator<int> qit = q.end();
-  EXPECT_EQ(*qit, 25) << "End iterator should be pointing at the last element!";
+  EXPECT_EQ(qit.get_node(), nullptr) << "End iterator should be past the tail!";
+  EXPECT_EQ(*(q.begin() + 4), 25) << "Last element should be 25!";
+}
+
+TEST(QueueIterators, StdAlgorithms) {
+  std::vector<int> vec{3, 1, 4, 1, 5};
+  Queue<int> q(vec);
+
+  static_assert(std::is_same<std::iterator_traits<QueueIterator<int>>::
+                                 iterator_category,
+                             std::forward_iterator_tag>::value,
+                "QueueIterator should be forward!");
+
+  EXPECT_EQ(std::distance(q.begin(), q.end()), q.get_length())
+      << "Distance should be equal to the length!";
+  EXPECT_EQ(std::count(q.begin(), q.end(), 1), 2) << "Should count two 1s!";
+  EXPECT_EQ(*std::max_element(q.begin(), q.end()), 5) << "Max should be 5!";
+  EXPECT_EQ(std::vector<int>(q.begin(), q.end()), vec)
+      << "Vector built from iterators should be equal!";
 }
 
 // ----------
@@ -338,7 +360,7 @@ TEST(QueueMethods, At) {
   EXPECT_EQ(q.at(index)->data, *(q.begin())) << "First element should be 1!";
 
   index = 4;
-  EXPECT_EQ(q[index]->data, *(q.end())) << "Last element should be 5!";
+  EXPECT_EQ(q[index]->data, q.get_tail()->data) << "Last element should be 5!";
 
   index = 99;
   EXPECT_THROW(q.at(index), std::out_of_range)
@@ -361,7 +383,7 @@ TEST(QueueMethods, Find) {
       << "Values should be equal!";
 
   f = q.find(99.0);
-  EXPECT_EQ(f, q.end()) << "Should point to the last element if not found!";
+  EXPECT_EQ(f, q.end()) << "Should be equal to end() if not found!";
 
   q.clear();
   EXPECT_THROW(f = q.find(1.0), std::length_error)
@@ -372,7 +394,7 @@ TEST(QueueMethods, FindAll) {
   std::vector<char> vec{'a', 'b', 'c', 'a', 'a', 'b'};
   Queue<char> q(vec.begin(), vec.end());
 
-  std::vector<QueueIterator<char>> iterators{q.begin() + 1, q.end()};
+  std::vector<QueueIterator<char>> iterators{q.begin() + 1, q.begin() + 5};
   std::vector<QueueIterator<char>> f = q.find_all('b');
 
   for (int i = 0; i < f.size(); i++) {
@@ -389,6 +411,25 @@ TEST(QueueMethods, FindAll) {
       << "Should throw length_error if queue is empty!";
 }
 
+TEST(QueueMethods, CompactFind) {
+  Queue<int> q(std::vector<int>{5, 1, 5, 2, 5});
+
+  EXPECT_EQ(q.find_all_indices(5), std::vector<int>({0, 2, 4}))
+      << "Should return indexes of all 5s!";
+  EXPECT_EQ(q.find_if_indices([](int x) { return x < 5; }),
+            std::vector<int>({1, 3}))
+      << "Should return indexes of elements < 5!";
+  EXPECT_EQ(q.match_mask(5).count(), 3) << "Three 5s should match!";
+
+  int count = 0;
+  q.for_each_match(5, [&count](const int, int &) { count++; });
+  EXPECT_EQ(count, 3) << "Visitor should be called three times!";
+
+  q.clear();
+  EXPECT_THROW(q.match_mask(5), std::length_error)
+      << "Should throw length_error if queue is empty!";
+}
+
 TEST(QueueMethods, FindIf) {
   std::vector<int> vec{6, 7, 8, 9, 10};
   Queue<int> q(vec.begin(), vec.end());
@@ -586,6 +627,60 @@ TEST(QueueMethods, ToString) {
       << "Should throw length_error if queue is empty!";
 }
 
+TEST(QueueMethods, FingerAccess) {
+  std::vector<int> vec{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  Queue<int> q(vec);
+
+  for (int i = 0; i < 10; ++i)
+    EXPECT_EQ(q.at(i)->data, vec[i]) << "Forward walk should match!";
+
+  for (int i = 9; i >= 0; i -= 4)
+    EXPECT_EQ(q.at(i)->data, vec[i]) << "Backward walk should match!";
+
+  QueueNode<int> *node = q.at(6);
+  EXPECT_EQ(q.get_index(q.at(2)), 2) << "Index of node should be 2!";
+  EXPECT_EQ(q.get_index(node), 6) << "Index of node should be 6!";
+  EXPECT_EQ(q.get_index(q.get_head()), 0) << "Index of head should be 0!";
+
+  QueueNode<int> stranger(5);
+  EXPECT_EQ(q.get_index(&stranger), q.get_length())
+      << "Foreign node should give the length!";
+
+  q.at(4);
+  q.dequeue();
+  q.dequeue();
+  vec.erase(vec.begin(), vec.begin() + 2);
+  for (int i = 0; i < q.get_length(); ++i)
+    EXPECT_EQ(q.at(i)->data, vec[i]) << "Dequeue should shift the finger!";
+
+  q.at(0);
+  q.dequeue();
+  vec.erase(vec.begin());
+  EXPECT_EQ(q.at(0)->data, vec[0]) << "Dequeued finger should be dropped!";
+
+  q.at(3);
+  q.insert(q.begin(), -1);
+  vec.insert(vec.begin(), -1);
+  EXPECT_EQ(q.at(3)->data, vec[3]) << "Insert should drop the finger!";
+
+  q.at(5);
+  q.erase(q.begin());
+  vec.erase(vec.begin());
+  EXPECT_EQ(q.at(5)->data, vec[5]) << "Erase should drop the finger!";
+
+  q.at(2);
+  q.reverse();
+  std::reverse(vec.begin(), vec.end());
+  for (int i = 0; i < q.get_length(); ++i)
+    EXPECT_EQ(q.at(i)->data, vec[i]) << "Reverse should drop the finger!";
+
+  q.at(q.get_length() - 1);
+  q.enqueue(42);
+  vec.push_back(42);
+  EXPECT_EQ(q.at(q.get_length() - 1)->data, 42)
+      << "Enqueue should keep the finger valid!";
+}
+
 // ----------
 // Compare test
 // ----------
@@ -764,6 +859,82 @@ TEST(QueueUsefulFunctions, Filter) {
   }
 }
 
+TEST(QueueUsefulFunctions, Sort) {
+  std::vector<int> vec{4, 1, 3, 9, 7, 1, 0, 5};
+  Queue<int> q(vec);
+
+  q.at(3);
+  q.sort();
+  std::sort(vec.begin(), vec.end());
+
+  EXPECT_EQ(q.to_vector(), vec) << "Queue should be sorted!";
+  EXPECT_EQ(q.at(3)->data, vec[3]) << "Finger should be dropped!";
+  EXPECT_EQ(q.get_head()->data, 0) << "Front should be the smallest element!";
+
+  q.enqueue(-1);
+  EXPECT_EQ(q.to_vector().back(), -1) << "Tail should stay consistent!";
+
+  q.sort(std::greater<int>());
+  EXPECT_EQ(q.dequeue(), 9) << "Front should be the largest element!";
+}
+
+TEST(QueueUsefulFunctions, Merge) {
+  Queue<int> q1(std::vector<int>{1, 4, 6}), q2(std::vector<int>{2, 4, 5, 10});
+  QueueNode<int> *four = q1.at(1);
+
+  q1.merge(q2);
+
+  EXPECT_EQ(q1.to_vector(), std::vector<int>({1, 2, 4, 4, 5, 6, 10}))
+      << "Queues should be merged in order!";
+  EXPECT_EQ(q1.at(2), four) << "On ties the node of this queue goes first!";
+  EXPECT_TRUE(q2.is_empty()) << "Other queue should be empty!";
+
+  q1.enqueue(11);
+  EXPECT_EQ(q1.get_length(), 8) << "Length should be 8!";
+  EXPECT_EQ(q1.to_vector().back(), 11) << "Tail should be consistent!";
+
+  q2.merge(q1);
+  EXPECT_EQ(q2.get_length(), 8) << "Empty queue should take all nodes!";
+  EXPECT_TRUE(q1.is_empty()) << "Other queue should be empty!";
+}
+
+TEST(QueueUsefulFunctions, MergeAfterErase) {
+  Queue<int> q1(std::vector<int>{1, 3, 5}), q2(std::vector<int>{2});
+
+  q1.erase(5);
+  EXPECT_EQ(q1.get_last(), 3) << "Erasing the last node should move the tail!";
+
+  q1.merge(q2);
+  EXPECT_EQ(q1.to_vector(), std::vector<int>({1, 2, 3}))
+      << "Queues should be merged in order!";
+  EXPECT_EQ(q1.get_last(), 3) << "Tail should be the last merged node!";
+
+  Queue<int> q3(std::vector<int>{4, 2, 4}), q4(std::vector<int>{1, 3});
+  q3.erase_all(4);
+  EXPECT_EQ(q3.get_length(), 1) << "Length should be 1!";
+  EXPECT_EQ(q3.get_last(), 2) << "Erasing all should move the tail!";
+
+  q3.dequeue();
+  q3.merge(q4);
+  EXPECT_EQ(q3.to_vector(), std::vector<int>({1, 3}))
+      << "Emptied queue should take all nodes!";
+  EXPECT_EQ(q3.get_last(), 3) << "Tail should be the last merged node!";
+}
+
+TEST(QueueUsefulFunctions, MergeAfterRemoveDuplicates) {
+  Queue<int> q1(std::vector<int>{1, 3, 5, 5}), q2(std::vector<int>{2, 6});
+
+  q1.remove_duplicates();
+  EXPECT_EQ(q1.get_length(), 3) << "Length should be 3!";
+  EXPECT_EQ(q1.get_last(), 5) << "Tail should be the kept 5!";
+
+  q1.merge(q2);
+  EXPECT_EQ(q1.to_vector(), std::vector<int>({1, 2, 3, 5, 6}))
+      << "Queues should be merged in order!";
+  EXPECT_EQ(q1.get_length(), 5) << "Length should be 5!";
+  EXPECT_EQ(q1.get_last(), 6) << "Tail should be the last merged node!";
+}
+
 // ----------
 // Finding min/max test
 // ----------
@@ -0,0 +1,84 @@
+#include <RadixHeap.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(RadixHeapConstructors, Constructors) {
+  RadixHeap<unsigned int, std::string> h;
+
+  EXPECT_TRUE(h.is_empty()) << "Should be empty!";
+  EXPECT_EQ(h.get_last_key(), 0u) << "Last key should be 0!";
+  EXPECT_THROW(h.pop(), std::length_error) << "Radix heap is empty!";
+  EXPECT_THROW(h.top(), std::length_error) << "Radix heap is empty!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(RadixHeapMethods, PopsInKeyOrder) {
+  RadixHeap<std::uint32_t, int> h;
+  std::vector<std::uint32_t> keys;
+
+  for (int i = 0; i < 1000; i++) {
+    keys.push_back((i * 2654435761u) % 100000);
+    h.push(keys.back(), i);
+  }
+
+  std::sort(keys.begin(), keys.end());
+  for (std::uint32_t key : keys)
+    ASSERT_EQ(h.pop().first, key) << "Keys should come out sorted!";
+
+  EXPECT_TRUE(h.is_empty()) << "Should be empty!";
+}
+
+TEST(RadixHeapMethods, Monotone) {
+  RadixHeap<std::uint64_t, char> h;
+
+  h.push(10, 'a');
+  h.push(5, 'b');
+  h.push(1ull << 40, 'c');
+
+  EXPECT_EQ(h.top(), std::make_pair(std::uint64_t(5), 'b')) << "Top is 5!";
+  EXPECT_EQ(h.pop().second, 'b') << "Should pop 'b'!";
+  EXPECT_EQ(h.get_last_key(), 5u) << "Last key should be 5!";
+
+  EXPECT_THROW(h.push(4, 'd'), std::invalid_argument)
+      << "Key should not go below the last popped key!";
+
+  h.push(5, 'e');
+  h.push(7, 'f');
+  EXPECT_EQ(h.pop().second, 'e') << "Equal to the last key is allowed!";
+  EXPECT_EQ(h.pop().second, 'f') << "Should pop 'f'!";
+  EXPECT_EQ(h.pop().second, 'a') << "Should pop 'a'!";
+  EXPECT_EQ(h.pop().first, 1ull << 40) << "Should pop the 2^40 key!";
+
+  h.push(1ull << 41, 'g');
+  h.clear();
+  EXPECT_TRUE(h.is_empty()) << "Should be empty after clear!";
+}
+
+TEST(RadixHeapMethods, PushAfterTop) {
+  RadixHeap<unsigned int, char> h;
+
+  h.push(5, 'a');
+  EXPECT_EQ(h.pop().first, 5u) << "Should pop 5!";
+
+  h.push(100, 'b');
+  EXPECT_EQ(h.top().first, 100u) << "Top should be 100!";
+  EXPECT_EQ(h.get_last_key(), 5u) << "Top should not move the last key!";
+
+  EXPECT_NO_THROW(h.push(50, 'c')) << "50 is above the last popped key!";
+  EXPECT_EQ(h.top().second, 'c') << "Top should be 'c'!";
+  EXPECT_EQ(h.pop().first, 50u) << "Should pop 50!";
+  EXPECT_EQ(h.pop().first, 100u) << "Should pop 100!";
+}
@@ -0,0 +1,98 @@
+#include <SegmentedStack.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(SegmentedStackConstructors, DefaultConstructor) {
+  SegmentedStack<int, 4> s;
+
+  EXPECT_TRUE(s.is_empty()) << "Should be empty!";
+  EXPECT_EQ(s.get_chunk_count(), 0) << "Should not allocate any chunk!";
+  EXPECT_EQ(s.get_chunk_size(), 4) << "Chunk size should be 4!";
+}
+
+TEST(SegmentedStackConstructors, Constructors) {
+  std::vector<int> vec{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  SegmentedStack<int, 4> s1(vec), s2(vec.begin(), vec.end()), s3(5, 7);
+  SegmentedStack<int, 4> s4(s1);
+
+  EXPECT_EQ(s1.to_vector(), vec) << "Should keep the order of the vector!";
+  EXPECT_EQ(s1.get_chunk_count(), 3) << "9 elements should take 3 chunks!";
+  EXPECT_TRUE(s1 == s2 && s1 == s4) << "Stacks should be equal!";
+  EXPECT_EQ(s3.count(7), 5) << "Should be filled with 7!";
+
+  s4 = s3;
+  EXPECT_TRUE(s4 == s3 && s4 != s1) << "Should be a copy of s3!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(SegmentedStackMethods, PushAndPop) {
+  SegmentedStack<int, 4> s;
+  for (int i = 0; i < 10; i++)
+    s.push(i);
+
+  EXPECT_EQ(s.get_size(), 10) << "Size should be 10!";
+  EXPECT_EQ(s.peek(), 9) << "Top should be 9!";
+  EXPECT_EQ(s.bottom(), 0) << "Bottom should be 0!";
+  EXPECT_EQ(s[5], 5) << "Should access by index from the bottom!";
+  EXPECT_THROW(s.at(10), std::out_of_range) << "Should check index!";
+
+  for (int i = 9; i >= 0; i--)
+    EXPECT_EQ(s.pop(), i) << "Should pop in LIFO order!";
+
+  EXPECT_THROW(s.pop(), std::underflow_error) << "Stack underflow!";
+  EXPECT_THROW(s.peek(), std::underflow_error) << "Stack underflow!";
+}
+
+TEST(SegmentedStackMethods, SpareChunk) {
+  SegmentedStack<int, 2> s(std::vector<int>{1, 2});
+  s.push(3);
+  EXPECT_EQ(s.get_chunk_count(), 2) << "Should link a second chunk!";
+
+  s.pop();
+  EXPECT_EQ(s.get_chunk_count(), 1) << "Empty chunk should be unlinked!";
+  EXPECT_TRUE(s.has_spare()) << "Empty chunk should be kept as spare!";
+
+  s.push(4);
+  EXPECT_FALSE(s.has_spare()) << "Spare chunk should be reused!";
+  EXPECT_EQ(s.to_vector(), std::vector<int>({1, 2, 4})) << "Wrong order!";
+}
+
+TEST(SegmentedStackMethods, StableAddresses) {
+  SegmentedStack<std::string, 4> s;
+  std::string *first = &s.push("first");
+
+  for (int i = 0; i < 1000; i++)
+    s.push(std::to_string(i));
+
+  EXPECT_EQ(*first, "first") << "Address of the bottom should not change!";
+  EXPECT_EQ(&s.top(), &s.top()) << "Top reference should be stable!";
+
+  s.top() = "changed";
+  EXPECT_EQ(s.peek(), "changed") << "Top should be modified in place!";
+}
+
+TEST(SegmentedStackMethods, UsefulFunctions) {
+  SegmentedStack<int, 3> s(std::vector<int>{4, 8, 1, 8, 6});
+
+  EXPECT_TRUE(s.contains(6) && !s.contains(5)) << "Should contain 6, not 5!";
+  EXPECT_EQ(s.count(8), 2) << "Should count two 8s!";
+  EXPECT_EQ(s.count_if([](int x) { return x > 4; }), 3) << "Three > 4!";
+  EXPECT_EQ(s.max(), 8) << "Max should be 8!";
+  EXPECT_EQ(s.min(), 1) << "Min should be 1!";
+  EXPECT_EQ(s.to_string(), "6\n---\n8\n---\n1\n---\n8\n---\n4\n")
+      << "Should print from the top to the bottom!";
+
+  s.clear();
+  EXPECT_TRUE(s.is_empty()) << "Should be empty after clear!";
+  EXPECT_THROW(s.max(), std::underflow_error) << "Stack underflow!";
+}
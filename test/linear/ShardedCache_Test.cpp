@@ -0,0 +1,117 @@
+#include <LfuCache.h>
+#include <ShardedCache.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(ShardedCacheConstructors, Constructors) {
+  ShardedCache<int, int> c(64, 8);
+
+  EXPECT_TRUE(c.is_empty()) << "Should be empty!";
+  EXPECT_EQ(c.get_shards(), 8) << "Should have 8 shards!";
+  EXPECT_EQ(c.get_capacity(), 64u) << "Capacity should be 64!";
+  EXPECT_EQ((ShardedCache<int, int>(70, 8).get_capacity()), 70u)
+      << "The remainder should go to the first shards!";
+  EXPECT_THROW((ShardedCache<int, int>(64, 6)), std::invalid_argument)
+      << "Shard count should be a power of two!";
+  EXPECT_THROW((ShardedCache<int, int>(4, 8)), std::invalid_argument)
+      << "Every shard needs some capacity!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(ShardedCacheMethods, SingleThread) {
+  ShardedCache<int, std::string> c(1024, 4);
+  std::string value;
+
+  for (int i = 0; i < 100; i++)
+    EXPECT_TRUE(c.put(i, std::to_string(i))) << "New key should be added!";
+
+  EXPECT_EQ(c.get_length(), 100) << "Length should be 100!";
+  EXPECT_FALSE(c.put(5, "five")) << "Existing key should be replaced!";
+  EXPECT_TRUE(c.get(5, value) && value == "five") << "Should hit!";
+  EXPECT_FALSE(c.get(500, value)) << "Should miss!";
+  EXPECT_TRUE(c.erase(5) && !c.contains(5)) << "Should erase the key!";
+
+  CacheStats stats = c.get_stats();
+  EXPECT_EQ(stats.hits, 1) << "One hit over the shards!";
+  EXPECT_EQ(stats.misses, 1) << "One miss over the shards!";
+
+  c.reset_stats();
+  c.clear();
+  EXPECT_TRUE(c.is_empty()) << "Should be empty!";
+  EXPECT_EQ(c.get_stats().hits, 0) << "Counters should be reset!";
+}
+
+TEST(ShardedCacheMethods, Capacity) {
+  ShardedCache<int, int> c(64, 4);
+  for (int i = 0; i < 1000; i++)
+    c.put(i, i);
+
+  EXPECT_LE(c.get_length(), 64) << "Should stay within the capacity!";
+  EXPECT_EQ(c.get_stats().evictions, 1000 - c.get_length())
+      << "Every other key should be evicted!";
+
+  ShardedCache<int, std::string, std::hash<int>, LfuCache<int, std::string>>
+      weighted(64, 2,
+               [](const int &, const std::string &s) { return s.size(); });
+  for (int i = 0; i < 100; i++)
+    weighted.put(i, "abcd");
+
+  EXPECT_LE(weighted.get_weight(), 64u) << "Weight should fit!";
+  EXPECT_THROW(weighted.put(0, std::string(40, 'a')), std::invalid_argument)
+      << "Entry should not be heavier than its shard!";
+}
+
+// every key lands on one shard with this hash
+struct ShardedConstantHash {
+  std::size_t operator()(const int &) const { return 0; }
+};
+
+TEST(ShardedCacheMethods, CustomHash) {
+  ShardedCache<int, int, ShardedConstantHash> c(8, 4);
+  for (int i = 0; i < 100; i++)
+    c.put(i, i);
+
+  EXPECT_EQ(c.get_length(), 2) << "Only one shard of 2 entries is used!";
+  EXPECT_TRUE(c.contains(99) && c.contains(98)) << "Last keys should stay!";
+}
+
+TEST(ShardedCacheMethods, ConcurrentUse) {
+  const int threads = 4, keys = 2000;
+  ShardedCache<int, int> c(keys, 8);
+  std::atomic<int> wrong(0);
+  std::vector<std::thread> pool;
+
+  // every thread owns the keys equal to its index modulo threads, so the
+  // values it reads back were written by itself
+  for (int t = 0; t < threads; t++)
+    pool.emplace_back([&c, &wrong, t]() {
+      for (int round = 0; round < 5; round++)
+        for (int key = t; key < keys; key += threads) {
+          int value = -1;
+          if (c.get(key, value) && value != key * round)
+            wrong++;
+
+          c.put(key, key * (round + 1));
+        }
+    });
+
+  for (std::thread &thread : pool)
+    thread.join();
+
+  CacheStats stats = c.get_stats();
+  EXPECT_EQ(wrong.load(), 0) << "Hits should read the last value!";
+  EXPECT_EQ(stats.hits + stats.misses, 5 * keys) << "Every get counted!";
+  EXPECT_LE(c.get_length(), keys) << "Should stay within the capacity!";
+}
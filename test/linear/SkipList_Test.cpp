@@ -0,0 +1,189 @@
+#include <SkipList.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using Pairs = std::vector<std::pair<int, std::string>>;
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(SkipListConstructors, DefaultConstructor) {
+  SkipList<int, int> s;
+
+  EXPECT_TRUE(s.is_empty()) << "Should be empty!";
+  EXPECT_EQ(s.get_head(), nullptr) << "Head should be null!";
+  EXPECT_EQ(s.get_tail(), nullptr) << "Tail should be null!";
+  EXPECT_EQ(s.get_height(), 0) << "Height should be 0!";
+  EXPECT_TRUE(s.begin() == s.end()) << "begin() should be end()!";
+}
+
+TEST(SkipListConstructors, Constructors) {
+  Pairs pairs{{3, "c"}, {1, "a"}, {2, "b"}, {1, "z"}};
+  SkipList<int, std::string> s1(pairs), s2(s1);
+
+  EXPECT_EQ(s1.to_vector(), Pairs({{1, "z"}, {2, "b"}, {3, "c"}}))
+      << "Should be sorted and keep the last value of a key!";
+  EXPECT_TRUE(s1 == s2) << "Copy should be equal!";
+  EXPECT_EQ(s2.get_height(), s1.get_height()) << "Copy should keep towers!";
+
+  s2.insert(4, "d");
+  EXPECT_TRUE(s1 != s2) << "Copy should not share nodes!";
+
+  SkipList<int, std::string> s3;
+  s3 = s2;
+  EXPECT_TRUE(s3 == s2) << "Should be a copy of s2!";
+  EXPECT_EQ(s3.get_tail()->key, 4) << "Tail should be copied!";
+}
+
+TEST(SkipListConstructors, Comparator) {
+  SkipList<int, int, std::greater<int>> s;
+  for (int i = 0; i < 5; i++)
+    s.insert(i, i * i);
+
+  EXPECT_EQ(s.get_head()->key, 4) << "Keys should follow the comparator!";
+  EXPECT_EQ(s.lower_bound(2)->value, 4) << "lower_bound follows comp!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(SkipListMethods, InsertAndFind) {
+  SkipList<int, std::string> s;
+
+  EXPECT_TRUE(s.insert(5, "five")) << "New key should be inserted!";
+  EXPECT_TRUE(s.insert(1, "one")) << "New key should be inserted!";
+  EXPECT_FALSE(s.insert(5, "FIVE")) << "Existing key should be updated!";
+
+  EXPECT_EQ(s.get_length(), 2) << "Length should be 2!";
+  EXPECT_EQ(s.at(5), "FIVE") << "Value should be replaced!";
+  EXPECT_TRUE(s.contains(1) && !s.contains(3)) << "Contains should match!";
+  EXPECT_TRUE(s.find(3) == s.end()) << "Missing key should give end()!";
+  EXPECT_EQ(s.find(1)->value, "one") << "Should find the key!";
+  EXPECT_THROW(s.at(3), std::out_of_range) << "Should throw out_of_range!";
+
+  s.at(1) = "uno";
+  EXPECT_EQ(s.find(1)->value, "uno") << "at() should give a reference!";
+}
+
+TEST(SkipListMethods, Bounds) {
+  SkipList<int, int> s;
+  for (int i = 0; i < 100; i += 10)
+    s.insert(i, i);
+
+  EXPECT_EQ(s.lower_bound(30)->key, 30) << "lower_bound of a key!";
+  EXPECT_EQ(s.lower_bound(31)->key, 40) << "lower_bound between keys!";
+  EXPECT_EQ(s.upper_bound(30)->key, 40) << "upper_bound of a key!";
+  EXPECT_EQ(s.upper_bound(-5)->key, 0) << "upper_bound before all keys!";
+  EXPECT_TRUE(s.lower_bound(91) == s.end()) << "Past the last key!";
+
+  std::vector<int> range;
+  for (auto it = s.lower_bound(25); it != s.upper_bound(60); ++it)
+    range.push_back(it->key);
+
+  EXPECT_EQ(range, std::vector<int>({30, 40, 50, 60})) << "Range should match!";
+}
+
+TEST(SkipListMethods, Remove) {
+  SkipList<int, int> s;
+  for (int i = 0; i < 10; i++)
+    s.insert(i, i);
+
+  s.remove(0);
+  s.remove(9);
+  s.remove(5);
+
+  EXPECT_EQ(s.get_length(), 7) << "Length should be 7!";
+  EXPECT_EQ(s.get_head()->key, 1) << "Head should move!";
+  EXPECT_EQ(s.get_tail()->key, 8) << "Tail should move!";
+  EXPECT_EQ(s.get_head()->prev, nullptr) << "Head has no prev!";
+  EXPECT_FALSE(s.contains(5)) << "5 should be removed!";
+  EXPECT_THROW(s.remove(5), std::invalid_argument)
+      << "Should throw if key was not found!";
+
+  for (int i : {1, 2, 3, 4, 6, 7, 8})
+    s.remove(i);
+
+  EXPECT_TRUE(s.is_empty()) << "Should be empty!";
+  EXPECT_EQ(s.get_height(), 0) << "Empty list should have no levels!";
+  EXPECT_EQ(s.get_tail(), nullptr) << "Tail should be null!";
+}
+
+TEST(SkipListMethods, Height) {
+  SkipList<int, int> s;
+  for (int i = 0; i < 100000; i++)
+    s.insert(i, i);
+
+  EXPECT_GE(s.get_height(), 5) << "Towers should grow with the length!";
+  EXPECT_LE(s.get_height(), 16) << "Towers should stay logarithmic!";
+}
+
+TEST(SkipListMethods, MatchesModel) {
+  std::mt19937 rng(3);
+  SkipList<int, int> s;
+  std::map<int, int> model;
+
+  for (int step = 0; step < 20000; step++) {
+    int key = rng() % 500;
+    if (rng() % 3 == 0) {
+      if (model.erase(key))
+        s.remove(key);
+      else
+        EXPECT_THROW(s.remove(key), std::invalid_argument);
+    } else {
+      bool inserted = model.find(key) == model.end();
+      model[key] = step;
+      ASSERT_EQ(s.insert(key, step), inserted) << "Should report new keys!";
+    }
+
+    ASSERT_EQ(s.get_length(), static_cast<int>(model.size()))
+        << "Length should match the model!";
+  }
+
+  std::vector<std::pair<int, int>> pairs(model.begin(), model.end());
+  EXPECT_EQ(s.to_vector(), pairs) << "List should match the model!";
+
+  for (int key = 0; key < 500; key++)
+    ASSERT_EQ(s.contains(key), model.count(key) == 1) << "Should match!";
+
+  s.clear();
+  EXPECT_TRUE(s.is_empty()) << "Should be empty!";
+  s.insert(1, 1);
+  EXPECT_EQ(s.at(1), 1) << "Should work after clear!";
+}
+
+// ----------
+// Iterators test
+// ----------
+
+TEST(SkipListIterators, Traversal) {
+  SkipList<int, int> s;
+  for (int i : {4, 2, 5, 1, 3})
+    s.insert(i, i * 10);
+
+  std::vector<int> forward;
+  for (SkipNode<int, int> &node : s)
+    forward.push_back(node.key);
+
+  EXPECT_EQ(forward, std::vector<int>({1, 2, 3, 4, 5})) << "Should be sorted!";
+
+  std::vector<int> backward;
+  SkipListIterator<int, int> it = s.end();
+  while (it != s.begin())
+    backward.push_back((--it)->value);
+
+  EXPECT_EQ(backward, std::vector<int>({50, 40, 30, 20, 10}))
+      << "Should walk back from end()!";
+  EXPECT_THROW(*s.end(), std::out_of_range) << "Cannot dereference end()!";
+
+  (*s.begin()).value = 7;
+  EXPECT_EQ(s.at(1), 7) << "Iterator should give references!";
+}
@@ -0,0 +1,115 @@
+#include <SlidingWindow.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(SlidingWindowConstructors, Constructors) {
+  SlidingWindow<int> w(3);
+
+  EXPECT_TRUE(w.is_empty()) << "Should be empty!";
+  EXPECT_EQ(w.get_window(), 3) << "Window should be 3!";
+  EXPECT_THROW(SlidingWindow<int>(0), std::invalid_argument)
+      << "Window should be > 0!";
+  EXPECT_THROW(w.min(), std::length_error) << "Window is empty!";
+  EXPECT_THROW(w.max(), std::length_error) << "Window is empty!";
+  EXPECT_THROW(w.mean(), std::length_error) << "Window is empty!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(SlidingWindowMethods, MatchesNaiveScan) {
+  std::vector<int> stream;
+  for (int i = 0; i < 500; i++)
+    stream.push_back((i * 37 + 11) % 23 - (i % 5 == 0 ? 4 : 0));
+
+  for (int size : {1, 2, 5, 16}) {
+    SlidingWindow<int> w(size);
+
+    for (int i = 0; i < static_cast<int>(stream.size()); i++) {
+      w.push(stream[i]);
+
+      auto first = stream.begin() + std::max(0, i - size + 1);
+      auto last = stream.begin() + i + 1;
+
+      ASSERT_EQ(w.min(), *std::min_element(first, last))
+          << "Wrong min at " << i << " for window " << size;
+      ASSERT_EQ(w.max(), *std::max_element(first, last))
+          << "Wrong max at " << i << " for window " << size;
+      ASSERT_EQ(w.sum(), std::accumulate(first, last, 0))
+          << "Wrong sum at " << i << " for window " << size;
+    }
+  }
+}
+
+TEST(SlidingWindowMethods, Duplicates) {
+  SlidingWindow<int> w(3);
+
+  for (int value : {2, 2, 2, 1, 1})
+    w.push(value);
+
+  EXPECT_EQ(w.to_vector(), std::vector<int>({2, 1, 1})) << "Wrong window!";
+  EXPECT_EQ(w.min(), 1) << "Min should be 1!";
+  EXPECT_EQ(w.max(), 2) << "Max should still be 2!";
+
+  w.push(1);
+  EXPECT_EQ(w.max(), 1) << "All 2 should be evicted!";
+  EXPECT_EQ(w.oldest(), 1) << "Oldest should be 1!";
+  EXPECT_EQ(w.newest(), 1) << "Newest should be 1!";
+}
+
+TEST(SlidingWindowMethods, ComparatorAndClear) {
+  SlidingWindow<double, std::greater<double>> w(2);
+
+  w.push(1.5);
+  w.push(4.5);
+  EXPECT_EQ(w.min(), 4.5) << "Reversed order: min is the largest!";
+  EXPECT_EQ(w.max(), 1.5) << "Reversed order: max is the smallest!";
+  EXPECT_DOUBLE_EQ(w.mean(), 3.0) << "Mean should be 3!";
+  EXPECT_TRUE(w.is_full()) << "Should be full!";
+
+  w.clear();
+  EXPECT_TRUE(w.is_empty()) << "Should be empty after clear!";
+  EXPECT_EQ(w.sum(), 0) << "Sum should reset!";
+}
+
+TEST(SlidingWindowMethods, NonFiniteAndDrift) {
+  const double inf = std::numeric_limits<double>::infinity();
+  SlidingWindow<double> w(3);
+
+  w.push(1.0);
+  w.push(std::numeric_limits<double>::quiet_NaN());
+  EXPECT_TRUE(std::isnan(w.sum())) << "NaN in the window makes the sum NaN!";
+
+  w.push(inf);
+  w.push(2.0);
+  w.push(-inf);
+  EXPECT_TRUE(std::isnan(w.sum())) << "Both infinities make the sum NaN!";
+
+  w.push(3.0);
+  EXPECT_EQ(w.sum(), -inf) << "Only -infinity is left in the window!";
+
+  w.push(4.0);
+  w.push(5.0);
+  EXPECT_DOUBLE_EQ(w.sum(), 12.0) << "Sum should be finite again!";
+  EXPECT_DOUBLE_EQ(w.mean(), 4.0) << "Mean should be finite again!";
+
+  // 1e20 swallows the small values while it is in the running total
+  w.clear();
+  w.push(1e20);
+  for (int i = 0; i < 6; i++)
+    w.push(1.0);
+
+  EXPECT_DOUBLE_EQ(w.sum(), 3.0) << "Rounding error should not stay!";
+}
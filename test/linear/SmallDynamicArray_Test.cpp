@@ -0,0 +1,133 @@
+#include <DynamicArray.h>
+#include <Iterator.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(SmallDynamicArrayConstructors, DefaultConstructor) {
+  SmallDynamicArray<int, 8> d;
+
+  EXPECT_EQ(d.get_size(), 0) << "Should be 0 sized!";
+  EXPECT_EQ(d.get_capacity(), 8) << "Should have inline capacity = 8!";
+  EXPECT_TRUE(d.is_inline()) << "Should use the inline buffer!";
+}
+
+TEST(SmallDynamicArrayConstructors, InlineConstructors) {
+  SmallDynamicArray<int, 8> d1(std::vector<int>{1, 2, 3});
+  SmallDynamicArray<std::string, 4> d2(3, "abc");
+  SmallDynamicArray<int, 8> d3(5, 1, 10);
+  SmallDynamicArray<char, 8> d4(std::string("hello"));
+
+  EXPECT_TRUE(d1.is_inline() && d2.is_inline() && d3.is_inline() &&
+              d4.is_inline())
+      << "Small arrays should not allocate!";
+  EXPECT_EQ(d1.to_vector(), std::vector<int>({1, 2, 3}))
+      << "Values should be copied!";
+  EXPECT_EQ(d2[2], "abc") << "Should be filled with 'abc'!";
+  EXPECT_EQ(d4.to_string(), "h, e, l, l, o.") << "Should contain 'hello'!";
+}
+
+TEST(SmallDynamicArrayConstructors, HeapConstructor) {
+  std::vector<int> vec{1, 2, 3, 4, 5};
+  SmallDynamicArray<int, 4> d(vec);
+
+  EXPECT_FALSE(d.is_inline()) << "Array bigger than N should use the heap!";
+  EXPECT_EQ(d.to_vector(), vec) << "Values should be copied!";
+}
+
+TEST(SmallDynamicArrayConstructors, CopyConstructor) {
+  SmallDynamicArray<int, 4> d1(std::vector<int>{1, 2, 3});
+  SmallDynamicArray<int, 4> d2(d1);
+
+  EXPECT_TRUE(d2.is_inline()) << "Copy should use its own inline buffer!";
+  EXPECT_NE(d1.get_array(), d2.get_array()) << "Buffers should differ!";
+  EXPECT_TRUE(d1 == d2) << "Values should be equal!";
+
+  SmallDynamicArray<int, 4> d3;
+  d3 = d1;
+  EXPECT_TRUE(d3.is_inline()) << "Assigned array should stay inline!";
+  EXPECT_TRUE(d1 == d3) << "Values should be equal!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(SmallDynamicArrayMethods, SpillToHeap) {
+  SmallDynamicArray<int, 4> d;
+
+  for (int i = 0; i < 4; i++)
+    d.push_back(i);
+
+  EXPECT_TRUE(d.is_inline()) << "4 elements should fit inline!";
+  int *inline_array = d.get_array();
+
+  d.push_back(4);
+  EXPECT_FALSE(d.is_inline()) << "5th element should spill to the heap!";
+  EXPECT_NE(d.get_array(), inline_array) << "Buffer should change!";
+  EXPECT_EQ(d.get_capacity(), 8) << "Capacity should double!";
+  EXPECT_EQ(d.to_vector(), std::vector<int>({0, 1, 2, 3, 4}))
+      << "Values should be kept when spilling!";
+
+  d.push_begin(-1);
+  d.insert(3, 99);
+  EXPECT_EQ(d.to_vector(), std::vector<int>({-1, 0, 1, 99, 2, 3, 4}))
+      << "Should keep growing on the heap!";
+}
+
+TEST(SmallDynamicArrayMethods, ResizeWithinInline) {
+  SmallDynamicArray<int, 8> d(2);
+  d.push_back(1);
+  d.push_back(2);
+
+  d.resize(6);
+  EXPECT_TRUE(d.is_inline()) << "Resizing within N should stay inline!";
+  EXPECT_EQ(d.get_capacity(), 6) << "Capacity should change to 6!";
+  EXPECT_EQ(d.to_vector(), std::vector<int>({1, 2})) << "Values should stay!";
+}
+
+TEST(SmallDynamicArrayMethods, SameApi) {
+  SmallDynamicArray<int, 16> d(std::vector<int>{5, 3, 1, 4, 2, 3});
+
+  EXPECT_EQ(*d.find(4), 4) << "Should find 4!";
+  EXPECT_EQ(d.find_all(3).size(), 2) << "3 should occur 2 times!";
+
+  d.replace(5, 50);
+  d.merge_sort();
+  EXPECT_EQ(d.to_vector(), std::vector<int>({1, 2, 3, 3, 4, 50}))
+      << "Should be sorted!";
+
+  SmallDynamicArray<int, 16> odd = d.filter([](int x) { return x % 2 == 1; });
+  EXPECT_TRUE(odd.is_inline()) << "Filtered array should stay inline!";
+  EXPECT_EQ(odd.to_vector(), std::vector<int>({1, 3, 3}))
+      << "Should keep odd elements!";
+
+  int sum = 0;
+  for (Iterator<int> it = d.begin(); it != d.end(); ++it)
+    sum += *it;
+  EXPECT_EQ(sum, d.reduce(0)) << "Iterators should cover all elements!";
+}
+
+TEST(SmallDynamicArrayMethods, CopyOnWriteAfterSpill) {
+  SmallDynamicArray<int, 2> d1(std::vector<int>{1, 2});
+  d1.set_copy_on_write(true);
+
+  SmallDynamicArray<int, 2> d2(d1);
+  EXPECT_NE(std::as_const(d1).get_array(), std::as_const(d2).get_array())
+      << "Inline buffers cannot be shared!";
+
+  d1.push_back(3);
+  SmallDynamicArray<int, 2> d3(d1);
+  EXPECT_EQ(std::as_const(d1).get_array(), std::as_const(d3).get_array())
+      << "Heap buffers should be shared in copy-on-write mode!";
+
+  d3.push_back(4);
+  EXPECT_EQ(d1.get_size(), 3) << "Original should not be modified!";
+}
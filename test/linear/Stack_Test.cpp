@@ -2,6 +2,8 @@
 #include <Stack.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
 #include <stdexcept>
 #include <vector>
@@ -273,7 +275,7 @@ TEST(StackModify, EraseRange) {
   EXPECT_THROW(s.erase_range(it + 2, it + 1), std::invalid_argument)
       << "it1 should be less than it2!";
 
-  s.erase_range(it + 1, it + 3);
+  s.erase_range(it + 1, it + 4);
   size -= range;
 
   EXPECT_EQ(s.get_size(), size)
@@ -294,7 +296,7 @@ TEST(StackIterators, IteratorBegin) {
   Iterator<char> it = s.begin();
 
   EXPECT_EQ(*it, 'a') << "First element should be equal to 'c'.";
-  EXPECT_EQ(it.get_index(), 0) << "Index should be 0!";
+  EXPECT_EQ(it - s.begin(), 0) << "Index should be 0!";
 }
 
 TEST(StackIterators, IteratorEnd) {
@@ -306,9 +308,24 @@ TEST(StackIterators, IteratorEnd) {
 
   Iterator<char> it = s.end();
 
-  EXPECT_EQ(*it, 'c') << "Last element should be equal to 'c'.";
-  EXPECT_EQ(it.get_index(), s.get_top())
-      << "Index should be " << s.get_top() << ".";
+  EXPECT_EQ(*(it - 1), 'c') << "Last element should be equal to 'c'.";
+  EXPECT_EQ(it - s.begin(), s.get_size())
+      << "Index should be one past the top: " << s.get_size() << ".";
+  if (Iterator<char>::is_checked) {
+    EXPECT_THROW(*it, std::out_of_range)
+        << "end() should not be dereferenced!";
+  }
+}
+
+TEST(StackIterators, StdAlgorithms) {
+  Stack<int> s(std::vector<int>{4, 2, 8, 6});
+
+  std::sort(s.begin(), s.end(), std::greater<int>());
+  EXPECT_EQ(s.peek(), 2) << "Smallest element should be on top!";
+  EXPECT_TRUE(std::binary_search(s.begin(), s.end(), 6, std::greater<int>()))
+      << "std::binary_search should find 6!";
+  EXPECT_EQ(std::count_if(s.begin(), s.end(), [](int x) { return x > 3; }), 3)
+      << "Three elements should be > 3!";
 }
 
 // ----------
@@ -465,6 +482,24 @@ TEST(StackMethods, Contains) {
   EXPECT_FALSE(s.contains(el)) << "String should not be in the stack!";
 }
 
+TEST(StackMethods, ContainsArithmetic) {
+  // 70 elements: two full blocks of 32 and a tail of 6
+  Stack<int> s(70);
+  for (int i = 0; i < 70; i++)
+    s.push(i * 2);
+
+  for (int i = 0; i < 70; i++)
+    EXPECT_TRUE(s.contains(i * 2)) << "Should find " << i * 2 << "!";
+
+  EXPECT_FALSE(s.contains(1)) << "Odd numbers should not be in the stack!";
+  EXPECT_FALSE(s.contains(140)) << "140 should not be in the stack!";
+
+  Stack<double> d(std::vector<double>{0.5, -1.25, 3.0});
+  EXPECT_TRUE(d.contains(-1.25)) << "Should find -1.25!";
+  EXPECT_FALSE(d.contains(1.25)) << "Should not find 1.25!";
+  EXPECT_FALSE(Stack<int>(4).contains(0)) << "Empty stack has nothing!";
+}
+
 TEST(StackMethods, Find) {
   std::vector<int> vec{1, 3, 5, 7, 9, 11};
   Stack<int> s(vec);
@@ -473,7 +508,7 @@ TEST(StackMethods, Find) {
   Iterator<int> it = s.find(el);
 
   EXPECT_EQ(*it, 1) << "Should be equal to found element!";
-  EXPECT_EQ(it.get_index(), s.begin().get_index())
+  EXPECT_TRUE(it == s.begin())
       << "Iterator should point to the first element!";
 
   el = 11;
@@ -484,7 +519,7 @@ TEST(StackMethods, Find) {
   el = 100;
   it = s.find(el);
 
-  EXPECT_EQ(it.get_index(), s.end().get_index())
+  EXPECT_TRUE(it == s.end())
       << "Should point to the end if not found!";
 
   s.erase_range(s.begin(), s.end());
@@ -523,10 +558,10 @@ TEST(StackMethods, FindIf) {
 
   std::vector<Iterator<std::string>> iterators =
       s.find_if([](std::string str) { return str.size() > 3; });
-  std::vector<Iterator<std::string>> expected{s.end() - 1, s.end()};
+  std::vector<Iterator<std::string>> expected{s.end() - 2, s.end() - 1};
 
   for (int i = 0; i < iterators.size(); i++)
-    EXPECT_EQ(iterators[i].get_index(), expected[i].get_index())
+    EXPECT_TRUE(iterators[i] == expected[i])
         << "Expected iterators and result iterators should be equal!";
 
   iterators = s.find_if([](std::string str) { return str.size() < 2; });
@@ -539,6 +574,25 @@ TEST(StackMethods, FindIf) {
       << "Should throw underflow_error if stack is empty!";
 }
 
+TEST(StackMethods, CompactFind) {
+  Stack<char> s(std::vector<char>{'a', 'b', 'a', 'c'});
+
+  EXPECT_EQ(s.find_all_indices('a'), std::vector<int>({0, 2}))
+      << "Should return indexes of all 'a's!";
+  EXPECT_EQ(s.match_mask_if([](char c) { return c > 'a'; }).to_indices(),
+            std::vector<int>({1, 3}))
+      << "Should mark elements greater than 'a'!";
+
+  std::vector<char> seen;
+  s.for_each_match_if([](char c) { return c != 'a'; },
+                      [&seen](const int, const char &c) { seen.push_back(c); });
+  EXPECT_EQ(seen, std::vector<char>({'b', 'c'})) << "Should visit 'b', 'c'!";
+
+  s.erase_range(s.begin(), s.end());
+  EXPECT_THROW(s.find_all_indices('a'), std::underflow_error)
+      << "Should throw underflow_error if stack is empty!";
+}
+
 TEST(StackMethods, Replace) {
   std::vector<int> vec{1, 2, 3, 4, 5};
   Stack<int> s(vec);
@@ -765,3 +819,19 @@ TEST(StackMinMax, Max) {
                std::underflow_error)
       << "Should throw underflow_error if stack is empty!";
 }
+
+// ----------
+// Views test
+// ----------
+
+TEST(StackViews, ViewAndSlice) {
+  Stack<int> s(std::vector<int>{1, 2, 3, 4});
+
+  ArrayView<int> v = s.view();
+  EXPECT_EQ(v.get_data(), s.get_stack()) << "View should not copy!";
+  EXPECT_EQ(v.get_size(), s.get_size()) << "View should cover the stack!";
+  EXPECT_EQ(v[v.get_size() - 1], s.peek()) << "Last element should be top!";
+
+  EXPECT_EQ(s.slice(2, 4).reduce(0), 7) << "Sum of top 2 should be 7!";
+  EXPECT_EQ(s.slice(0, 2).count(3), 0) << "Bottom 2 should not contain 3!";
+}
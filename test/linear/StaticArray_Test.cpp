@@ -0,0 +1,101 @@
+#include <StaticArray.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Table built and sorted by the compiler
+constexpr StaticArray<int, 8> make_sorted_table() {
+  StaticArray<int, 8> table{5, 3, 8, 1, 4};
+  table.push_back(7);
+  table.push_begin(2);
+  table.sort();
+  return table;
+}
+
+constexpr StaticArray<int, 8> sorted_table = make_sorted_table();
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(StaticArrayConstructors, DefaultConstructor) {
+  constexpr StaticArray<int, 4> s;
+
+  static_assert(s.get_size() == 0 && s.get_capacity() == 4,
+                "Should be evaluated at compile time!");
+  EXPECT_TRUE(s.is_empty()) << "Should be empty!";
+}
+
+TEST(StaticArrayConstructors, FillAndListConstructors) {
+  constexpr StaticArray<int, 4> s1(3, 7);
+  StaticArray<std::string, 4> s2{"a", "b"};
+
+  static_assert(s1.get_size() == 3 && s1[2] == 7, "Should be filled with 7!");
+  EXPECT_EQ(s2.to_vector(), std::vector<std::string>({"a", "b"}))
+      << "Values should be copied!";
+  EXPECT_THROW((StaticArray<int, 2>{1, 2, 3}), std::out_of_range)
+      << "Should not accept more than N elements!";
+  EXPECT_THROW((StaticArray<int, 2>(3, 1)), std::out_of_range)
+      << "Should not accept more than N elements!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(StaticArrayMethods, CompileTimeSort) {
+  static_assert(sorted_table.get_size() == 7, "Should hold 7 elements!");
+  static_assert(sorted_table[0] == 1 && sorted_table[6] == 8,
+                "Should be sorted at compile time!");
+  static_assert(sorted_table.min() == 1 && sorted_table.max() == 8,
+                "Min/max should be evaluated at compile time!");
+  static_assert(sorted_table.find(4) == 3 && sorted_table.find(6) == -1,
+                "Find should be evaluated at compile time!");
+  static_assert(sorted_table.contains(7) && !sorted_table.contains(9),
+                "Contains should be evaluated at compile time!");
+
+  EXPECT_EQ(sorted_table.to_string(), "1, 2, 3, 4, 5, 7, 8.")
+      << "Should be sorted!";
+}
+
+TEST(StaticArrayMethods, InsertAndErase) {
+  StaticArray<int, 4> s{1, 3};
+  s.insert(1, 2);
+  s.push_back(4);
+
+  EXPECT_EQ(s.to_vector(), std::vector<int>({1, 2, 3, 4}))
+      << "Should insert in the middle!";
+  EXPECT_TRUE(s.is_full()) << "Should be full!";
+  EXPECT_THROW(s.push_back(5), std::length_error) << "Should not grow!";
+
+  s.erase_begin();
+  s.erase_back();
+  EXPECT_EQ(s.to_vector(), std::vector<int>({2, 3}))
+      << "Should erase from both ends!";
+  EXPECT_THROW(s.at(2), std::out_of_range) << "Should check index!";
+  EXPECT_THROW(s.insert(5, 1), std::out_of_range) << "Should check index!";
+}
+
+TEST(StaticArrayMethods, UsefulFunctions) {
+  constexpr StaticArray<int, 6> s{1, 2, 2, 3, 4};
+
+  static_assert(s.count(2) == 2, "Should count at compile time!");
+  static_assert(s.count_if([](int x) { return x % 2 == 0; }) == 3,
+                "Should count by predicate at compile time!");
+  static_assert(s.reduce(0, [](int a, int b) { return a + b; }) == 12,
+                "Should reduce at compile time!");
+
+  StaticArray<int, 6> r = s;
+  r.reverse();
+  r.sort(std::greater<int>());
+  EXPECT_EQ(r.to_vector(), std::vector<int>({4, 3, 2, 2, 1}))
+      << "Should be sorted in descending order!";
+  EXPECT_TRUE(r != s) << "Should not be equal!";
+
+  StaticArray<int, 6> empty;
+  EXPECT_THROW(empty.max(), std::length_error) << "Array is empty!";
+  EXPECT_THROW(empty.to_string(), std::length_error) << "Array is empty!";
+}
@@ -0,0 +1,71 @@
+#include <StaticStack.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Stack pushed and popped by the compiler
+constexpr int sum_popped() {
+  StaticStack<int, 4> s;
+  s.push(1);
+  s.push(2);
+  s.push(3);
+
+  int sum = 0;
+  while (!s.is_empty())
+    sum += s.pop();
+
+  return sum;
+}
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(StaticStackConstructors, Constructors) {
+  constexpr StaticStack<int, 4> s1;
+  constexpr StaticStack<int, 4> s2(2, 5);
+  StaticStack<std::string, 3> s3{"a", "b", "c"};
+
+  static_assert(s1.is_empty() && s1.get_top() == -1, "Should be empty!");
+  static_assert(s2.get_size() == 2 && s2.peek() == 5, "Should hold 5s!");
+  EXPECT_EQ(s3.peek(), "c") << "Last element should be on top!";
+  EXPECT_TRUE(s3.is_full()) << "Should be full!";
+  EXPECT_THROW((StaticStack<int, 2>{1, 2, 3}), std::overflow_error)
+      << "Should not accept more than N elements!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(StaticStackMethods, PushAndPop) {
+  static_assert(sum_popped() == 6, "Should be evaluated at compile time!");
+
+  StaticStack<int, 2> s;
+  s.push(1);
+  s.push(2);
+  EXPECT_THROW(s.push(3), std::overflow_error) << "Stack overflow!";
+  EXPECT_EQ(s.pop(), 2) << "Should pop the top!";
+  EXPECT_EQ(s.pop(), 1) << "Should pop the top!";
+  EXPECT_THROW(s.pop(), std::underflow_error) << "Stack underflow!";
+  EXPECT_THROW(s.peek(), std::underflow_error) << "Stack underflow!";
+}
+
+TEST(StaticStackMethods, FindAndMinMax) {
+  constexpr StaticStack<int, 8> s{4, 1, 3, 1};
+
+  static_assert(s.find(3) == 2 && s.find(9) == -1, "Should find index!");
+  static_assert(s.contains(4) && s.count(1) == 2, "Should count 1s!");
+  static_assert(s.min() == 1 && s.max() == 4, "Min/max at compile time!");
+  static_assert(s.bottom() == 4 && s[1] == 1, "Should index from bottom!");
+
+  StaticStack<int, 8> sorted = s;
+  sorted.sort();
+  EXPECT_EQ(sorted.to_vector(), std::vector<int>({1, 1, 3, 4}))
+      << "Should be sorted from bottom to top!";
+  EXPECT_EQ(sorted.to_string(), "1, 1, 3, 4.") << "Should be sorted!";
+  EXPECT_TRUE(sorted != s) << "Should not be equal!";
+  EXPECT_THROW(s.at(4), std::out_of_range) << "Should check index!";
+}
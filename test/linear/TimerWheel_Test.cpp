@@ -0,0 +1,195 @@
+#include <TimerWheel.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(TimerWheelConstructors, Constructors) {
+  TimerWheel<int> w1;
+  TimerWheel<int, 2, 2> w2(100);
+
+  EXPECT_TRUE(w1.is_empty()) << "Should be empty!";
+  EXPECT_EQ(w1.get_now(), 0u) << "Now should be 0!";
+  EXPECT_EQ(w2.get_now(), 100u) << "Now should be 100!";
+  EXPECT_EQ((TimerWheel<int, 6, 6>::get_horizon()), 1ull << 36)
+      << "Horizon should be 2^36!";
+  EXPECT_EQ((TimerWheel<int, 2, 2>::get_horizon()), 16u)
+      << "Horizon should be 16!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(TimerWheelMethods, FiresAtExpiry) {
+  // tiny wheel (4 slots, 2 levels) so cascading and overflow both happen
+  TimerWheel<std::uint64_t, 2, 2> w;
+  std::vector<std::uint64_t> expiries;
+
+  for (int i = 0; i < 300; i++) {
+    expiries.push_back(1 + (i * 7919) % 200);
+    w.schedule(expiries.back(), expiries.back());
+  }
+
+  std::vector<std::uint64_t> fired;
+  for (std::uint64_t t = 1; t <= 200; t++) {
+    w.advance(t, [&](std::uint64_t expiry) {
+      ASSERT_EQ(expiry, t) << "Timer should fire exactly at its expiry!";
+      fired.push_back(expiry);
+    });
+  }
+
+  std::sort(expiries.begin(), expiries.end());
+  EXPECT_EQ(fired, expiries) << "Every timer should fire once!";
+  EXPECT_TRUE(w.is_empty()) << "Should be empty!";
+}
+
+TEST(TimerWheelMethods, BatchAdvance) {
+  TimerWheel<int> w(1000);
+
+  int first_half = 0;
+  for (int i = 0; i < 1000; i++) {
+    int delay = (i * 37) % 5000 + 1;
+    w.schedule_after(delay, delay);
+    first_half += delay <= 2500;
+  }
+  w.schedule(1000ull + (1ull << 40), -1); // beyond the horizon
+
+  std::vector<int> fired = w.advance(1000 + 2500);
+  EXPECT_TRUE(std::is_sorted(fired.begin(), fired.end()))
+      << "A batch should fire in expiry order!";
+  EXPECT_EQ(fired.size(), first_half) << "Timers up to 3500 should fire!";
+  EXPECT_EQ(w.get_now(), 3500u) << "Now should be the target tick!";
+
+  fired = w.advance(1000 + 5000);
+  EXPECT_EQ(fired.size(), 1000 - first_half) << "The rest should fire!";
+  EXPECT_EQ(w.get_size(), 1) << "Far timer should still be pending!";
+
+  fired = w.advance(1000ull + (1ull << 40));
+  EXPECT_EQ(fired, std::vector<int>({-1})) << "Far timer should fire!";
+}
+
+TEST(TimerWheelMethods, Cancel) {
+  TimerWheel<std::string> w;
+
+  TimerHandle<std::string> a = w.schedule(10, "a");
+  TimerHandle<std::string> b = w.schedule(10, "b");
+  TimerHandle<std::string> c = w.schedule(5000, "c");
+
+  w.cancel(b);
+  w.cancel(c);
+  EXPECT_FALSE(w.is_pending(b)) << "Cancelled timer is not pending!";
+  EXPECT_TRUE(w.is_pending(a)) << "Timer 'a' should be pending!";
+  EXPECT_THROW(w.cancel(b), std::invalid_argument) << "Timer is not pending!";
+
+  EXPECT_EQ(w.advance(10000), std::vector<std::string>({"a"}))
+      << "Only 'a' should fire!";
+  EXPECT_FALSE(w.is_pending(a)) << "Fired timer is not pending!";
+  EXPECT_THROW(w.advance(9999), std::invalid_argument)
+      << "Time should not go backwards!";
+}
+
+TEST(TimerWheelMethods, StaleHandle) {
+  TimerWheel<int> w;
+
+  TimerHandle<int> fired = w.schedule(1, 1);
+  w.advance(1);
+
+  // the pool hands the freed node to the next timer
+  TimerHandle<int> next = w.schedule(5, 2);
+  EXPECT_EQ(next.node, fired.node) << "Node should be reused!";
+  EXPECT_FALSE(w.is_pending(fired)) << "Stale handle is not pending!";
+  EXPECT_THROW(w.cancel(fired), std::invalid_argument)
+      << "Stale handle should not cancel the new timer!";
+  EXPECT_TRUE(w.is_pending(next)) << "New timer should stay pending!";
+  EXPECT_EQ(w.advance(5), std::vector<int>({2})) << "New timer should fire!";
+}
+
+TEST(TimerWheelMethods, FiringOrder) {
+  TimerWheel<int> w(100);
+
+  w.schedule(90, 1); // already due
+  w.schedule(50, 2);
+  w.schedule(100, 3);
+  w.schedule(200, 4);
+  w.schedule(150, 5);
+  w.schedule(200, 6);
+
+  EXPECT_EQ(w.advance(180), std::vector<int>({1, 2, 3, 5}))
+      << "Due timers should fire first, in scheduling order!";
+
+  // 4 and 6 share the bucket with these until it cascades at 192
+  w.schedule(200, 7);
+  TimerHandle<int> cancelled = w.schedule(200, 8);
+  w.schedule(200, 9);
+  w.cancel(cancelled);
+
+  EXPECT_EQ(w.advance(200), std::vector<int>({4, 6, 7, 9}))
+      << "Equal expiries should fire in scheduling order!";
+}
+
+TEST(TimerWheelMethods, PastTimers) {
+  TimerWheel<int> w(100);
+
+  for (int i = 0; i < 5; i++)
+    w.schedule(10 * i, i);
+
+  EXPECT_EQ(w.advance(100), std::vector<int>({0, 1, 2, 3, 4}))
+      << "Past timers should fire in scheduling order!";
+}
+
+TEST(TimerWheelMethods, ScheduleWhileFiring) {
+  TimerWheel<int> w;
+  std::vector<int> fired;
+
+  w.schedule(3, 1);
+  w.advance(10, [&](int value) {
+    fired.push_back(value);
+    if (value < 3)
+      w.schedule_after(2, value + 1); // retry two ticks after the firing tick
+  });
+
+  EXPECT_EQ(fired, std::vector<int>({1, 2, 3})) << "Retries should fire!";
+
+  w.schedule(4, 7); // already in the past, fires on the next advance
+  EXPECT_EQ(w.advance(10), std::vector<int>({7})) << "Past timer fires now!";
+
+  w.schedule(50, 8);
+  w.clear();
+  EXPECT_TRUE(w.is_empty()) << "Should be empty after clear!";
+  EXPECT_TRUE(w.advance(100).empty()) << "Nothing should fire after clear!";
+}
+
+TEST(TimerWheelMethods, CancelWhileFiring) {
+  TimerWheel<int> w;
+  std::vector<int> fired;
+
+  w.schedule(5, 1);
+  TimerHandle<int> second = w.schedule(5, 2);
+  TimerHandle<int> third = w.schedule(5, 3);
+
+  // the first callback cancels a sibling timeout of the same batch
+  int count = w.advance(10, [&](int value) {
+    fired.push_back(value);
+    if (value == 1)
+      w.cancel(second);
+  });
+
+  EXPECT_EQ(count, 2) << "Cancelled timer should not fire!";
+  EXPECT_EQ(fired, std::vector<int>({1, 3})) << "Only 1 and 3 should fire!";
+  EXPECT_EQ(w.get_size(), 0) << "Size should be 0!";
+  EXPECT_FALSE(w.is_pending(third)) << "Fired timer is not pending!";
+
+  w.schedule(20, 4);
+  w.schedule(20, 5);
+  EXPECT_EQ(w.advance(30, [&](int) { w.clear(); }), 1)
+      << "Clear from a callback should drop the rest of the batch!";
+  EXPECT_TRUE(w.is_empty()) << "Should be empty after clear!";
+}
@@ -0,0 +1,380 @@
+#include <UnrolledLinkedList.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// No block is empty or over full, and links and counts agree with the list
+template <class T, int B>
+bool blocks_are_valid(const UnrolledLinkedList<T, B> &l) {
+  int total = 0, blocks = 0;
+  for (UnrolledNode<T, B> *node = l.get_head(); node != nullptr;
+       node = node->next) {
+    if (node->count < 1 || node->count > B)
+      return false;
+
+    if (node->next != nullptr && node->next->prev != node)
+      return false;
+
+    total += node->count;
+    blocks++;
+  }
+
+  return total == l.get_length() && blocks == l.get_block_count();
+}
+
+// ----------
+// Constructors test
+// ----------
+
+TEST(UnrolledLinkedListConstructors, DefaultConstructor) {
+  UnrolledLinkedList<int, 4> l;
+
+  EXPECT_TRUE(l.is_empty()) << "Should be empty!";
+  EXPECT_EQ(l.get_head(), nullptr) << "Head should be nullptr!";
+  EXPECT_EQ(l.get_block_count(), 0) << "Should not allocate any block!";
+  EXPECT_EQ(l.get_block_capacity(), 4) << "Block capacity should be 4!";
+  EXPECT_TRUE(l.begin() == l.end()) << "begin() should be end()!";
+
+  UnrolledLinkedList<int> d;
+  EXPECT_EQ(d.get_block_capacity(), unrolled_block_capacity<int>())
+      << "Default block capacity should be sized for ints!";
+  EXPECT_EQ(sizeof(UnrolledNode<int, unrolled_block_capacity<int>()>), 64)
+      << "Default block of ints should fill one cache line!";
+}
+
+TEST(UnrolledLinkedListConstructors, Constructors) {
+  std::vector<int> vec{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  UnrolledLinkedList<int, 4> l1(vec), l2(vec.begin(), vec.end()), l3(5, 7);
+  UnrolledLinkedList<int, 4> l4(l1);
+
+  EXPECT_EQ(l1.to_vector(), vec) << "Should keep the order of the vector!";
+  EXPECT_EQ(l1.get_block_count(), 3) << "9 elements should take 3 blocks!";
+  EXPECT_TRUE(l1 == l2 && l1 == l4) << "Lists should be equal!";
+  EXPECT_EQ(l3.to_vector(), std::vector<int>(5, 7)) << "Should be filled!";
+
+  l4 = l3;
+  EXPECT_TRUE(l4 == l3 && l4 != l1) << "Should be a copy of l3!";
+}
+
+// ----------
+// Methods test
+// ----------
+
+TEST(UnrolledLinkedListMethods, PushEndAndBegin) {
+  UnrolledLinkedList<int, 4> l;
+  for (int i = 0; i < 8; i++)
+    l.push_end(i);
+  for (int i = -1; i >= -8; i--)
+    l.push_begin(i);
+
+  std::vector<int> expected;
+  for (int i = -8; i < 8; i++)
+    expected.push_back(i);
+
+  EXPECT_EQ(l.to_vector(), expected) << "Order should be kept!";
+  EXPECT_EQ(l.get_block_count(), 4)
+      << "Pushing at the ends should keep blocks full!";
+  EXPECT_EQ(l.front(), -8) << "Front should be -8!";
+  EXPECT_EQ(l.back(), 7) << "Back should be 7!";
+  EXPECT_TRUE(blocks_are_valid(l)) << "Blocks should be valid!";
+}
+
+TEST(UnrolledLinkedListMethods, PushIndexSplitsBlocks) {
+  UnrolledLinkedList<int, 4> l(std::vector<int>{0, 1, 2, 3});
+  l.push_index(2, 10);
+
+  EXPECT_EQ(l.to_vector(), std::vector<int>({0, 1, 10, 2, 3}))
+      << "Element should be inserted at index 2!";
+  EXPECT_EQ(l.get_block_count(), 2) << "Full block should be split!";
+
+  l.push_index(5, 20);
+  l.push_index(0, 30);
+  EXPECT_EQ(l.to_vector(), std::vector<int>({30, 0, 1, 10, 2, 3, 20}))
+      << "Ends should work as well!";
+
+  EXPECT_THROW(l.push_index(-1, 0), std::out_of_range)
+      << "Should throw out_of_range!";
+  EXPECT_THROW(l.push_index(8, 0), std::out_of_range)
+      << "Should throw out_of_range!";
+  EXPECT_TRUE(blocks_are_valid(l)) << "Blocks should be valid!";
+}
+
+TEST(UnrolledLinkedListMethods, PushMiddle) {
+  UnrolledLinkedList<int, 4> l;
+  std::vector<int> model;
+
+  for (int i = 0; i < 50; i++) {
+    int index = model.size() < 2 ? static_cast<int>(model.size())
+                                 : (static_cast<int>(model.size()) - 1) / 2 + 1;
+    model.insert(model.begin() + index, i);
+    l.push_middle(i);
+  }
+
+  EXPECT_EQ(l.to_vector(), model) << "push_middle should match the model!";
+  EXPECT_TRUE(blocks_are_valid(l)) << "Blocks should be valid!";
+}
+
+TEST(UnrolledLinkedListMethods, PushRange) {
+  UnrolledLinkedList<int, 4> l(std::vector<int>{0, 1, 2, 3, 4, 5});
+  std::vector<int> vec{10, 11, 12, 13, 14, 15, 16};
+
+  l.push_vector(3, vec);
+  EXPECT_EQ(l.to_vector(),
+            std::vector<int>({0, 1, 2, 10, 11, 12, 13, 14, 15, 16, 3, 4, 5}))
+      << "Range should be inserted at index 3!";
+
+  l.push_range(l.get_length(), vec.begin(), vec.begin() + 2);
+  EXPECT_EQ(l.back(), 11) << "Range should be appended!";
+
+  EXPECT_THROW(l.push_vector(0, std::vector<int>()), std::invalid_argument)
+      << "Should throw invalid_argument on empty vector!";
+  EXPECT_THROW(l.push_range(100, vec.begin(), vec.end()), std::out_of_range)
+      << "Should throw out_of_range!";
+  EXPECT_TRUE(blocks_are_valid(l)) << "Blocks should be valid!";
+}
+
+TEST(UnrolledLinkedListMethods, PushAfterAndBefore) {
+  UnrolledLinkedList<std::string, 4> l(
+      std::vector<std::string>{"a", "b", "c", "d"});
+
+  UnrolledListIterator<std::string, 4> it = l.push_after(l.find("b"), "x");
+  EXPECT_EQ(*it, "x") << "Should return the new element!";
+
+  it = l.push_before(l.find("a"), "y");
+  EXPECT_EQ(*it, "y") << "Should return the new element!";
+
+  l.push_before(l.end(), "z");
+  EXPECT_EQ(l.to_string(), "y <-> a <-> b <-> x <-> c <-> d <-> z")
+      << "Elements should be inserted around the positions!";
+
+  EXPECT_THROW(l.push_after(l.end(), "w"), std::invalid_argument)
+      << "Cannot push after end()!";
+}
+
+TEST(UnrolledLinkedListMethods, Remove) {
+  UnrolledLinkedList<int, 4> l;
+  for (int i = 0; i < 12; i++)
+    l.push_end(i);
+
+  l.remove_begin();
+  l.remove_end();
+  l.remove_index(4);
+  l.remove_value(8);
+
+  EXPECT_EQ(l.to_vector(), std::vector<int>({1, 2, 3, 4, 6, 7, 9, 10}))
+      << "Elements should be removed!";
+  EXPECT_TRUE(blocks_are_valid(l)) << "Blocks should be valid!";
+
+  EXPECT_THROW(l.remove_value(100), std::invalid_argument)
+      << "Should throw if value was not found!";
+  EXPECT_THROW(l.remove_index(8), std::out_of_range)
+      << "Should throw out_of_range!";
+
+  while (!l.is_empty())
+    l.remove_index(l.get_length() / 2);
+
+  EXPECT_EQ(l.get_block_count(), 0) << "All blocks should be freed!";
+  EXPECT_THROW(l.remove_begin(), std::length_error)
+      << "Should throw length_error if list is empty!";
+}
+
+TEST(UnrolledLinkedListMethods, RemoveMergesBlocks) {
+  UnrolledLinkedList<int, 4> l;
+  for (int i = 0; i < 16; i++)
+    l.push_end(i);
+
+  EXPECT_EQ(l.get_block_count(), 4) << "Should take 4 blocks!";
+
+  for (int i = 0; i < 8; i++)
+    l.remove_index(1);
+
+  EXPECT_EQ(l.to_vector(),
+            std::vector<int>({0, 9, 10, 11, 12, 13, 14, 15}))
+      << "Elements should be removed!";
+  EXPECT_LE(l.get_block_count(), 3) << "Sparse blocks should be merged!";
+  EXPECT_TRUE(blocks_are_valid(l)) << "Blocks should be valid!";
+}
+
+TEST(UnrolledLinkedListMethods, RemoveAllAndIf) {
+  UnrolledLinkedList<int, 4> l(
+      std::vector<int>{1, 2, 1, 3, 1, 4, 5, 1, 6, 7, 8, 1});
+
+  l.remove_all(1);
+  EXPECT_EQ(l.to_vector(), std::vector<int>({2, 3, 4, 5, 6, 7, 8}))
+      << "All 1 should be removed!";
+
+  l.remove_if([](int x) { return x % 2 == 0; });
+  EXPECT_EQ(l.to_vector(), std::vector<int>({3, 5, 7}))
+      << "Even elements should be removed!";
+  EXPECT_EQ(l.get_block_count(), 1) << "Blocks should be compacted!";
+
+  EXPECT_THROW(l.remove_all(100), std::invalid_argument)
+      << "Should throw if value was not found!";
+
+  l.remove_if([](int) { return true; });
+  EXPECT_TRUE(l.is_empty()) << "Everything should be removed!";
+  EXPECT_EQ(l.get_head(), nullptr) << "Head should be nullptr!";
+  EXPECT_EQ(l.get_tail(), nullptr) << "Tail should be nullptr!";
+}
+
+TEST(UnrolledLinkedListMethods, EraseWhileIterating) {
+  UnrolledLinkedList<int, 4> l;
+  for (int i = 0; i < 20; i++)
+    l.push_end(i);
+
+  for (UnrolledListIterator<int, 4> it = l.begin(); it != l.end();) {
+    if (*it % 3 == 0)
+      it = l.erase(it);
+    else
+      ++it;
+  }
+
+  std::vector<int> expected;
+  for (int i = 0; i < 20; i++)
+    if (i % 3 != 0)
+      expected.push_back(i);
+
+  EXPECT_EQ(l.to_vector(), expected) << "Multiples of 3 should be erased!";
+  EXPECT_THROW(l.erase(l.end()), std::out_of_range)
+      << "Cannot erase end()!";
+  EXPECT_TRUE(blocks_are_valid(l)) << "Blocks should be valid!";
+}
+
+TEST(UnrolledLinkedListMethods, Find) {
+  UnrolledLinkedList<int, 4> l(std::vector<int>{5, 6, 7, 8, 9, 10, 11});
+
+  EXPECT_EQ(*l.find(9), 9) << "Should find 9!";
+  EXPECT_TRUE(l.find(100) == l.end()) << "Missing value should give end()!";
+  EXPECT_EQ(*l.find_if([](int x) { return x > 9; }), 10)
+      << "First element > 9 is 10!";
+  EXPECT_EQ(l.get_index(9), 4) << "Index of 9 should be 4!";
+  EXPECT_EQ(l.get_index(100), -1) << "Missing value should give -1!";
+  EXPECT_TRUE(l.contains(11)) << "Should contain 11!";
+  EXPECT_FALSE(l.contains(4)) << "Should not contain 4!";
+}
+
+TEST(UnrolledLinkedListMethods, At) {
+  std::vector<int> vec;
+  for (int i = 0; i < 37; i++)
+    vec.push_back(i * i);
+
+  UnrolledLinkedList<int, 4> l(vec);
+  for (int i = 0; i < 37; i++)
+    EXPECT_EQ(l[i], vec[i]) << "Element should match the vector!";
+
+  l.at(3) = -1;
+  EXPECT_EQ(l.at(3), -1) << "at() should return a reference!";
+
+  EXPECT_THROW(l.at(37), std::out_of_range) << "Should throw out_of_range!";
+  EXPECT_THROW(l.at(-1), std::out_of_range) << "Should throw out_of_range!";
+}
+
+TEST(UnrolledLinkedListMethods, ToVectorAndString) {
+  UnrolledLinkedList<int, 4> l(std::vector<int>{1, 2, 3, 4, 5, 6});
+
+  EXPECT_EQ(l.to_vector(false), std::vector<int>({6, 5, 4, 3, 2, 1}))
+      << "Reversed order should be returned!";
+  EXPECT_EQ(l.to_string(), "1 <-> 2 <-> 3 <-> 4 <-> 5 <-> 6")
+      << "String should match!";
+  EXPECT_EQ(l.to_string(false), "6 <-> 5 <-> 4 <-> 3 <-> 2 <-> 1")
+      << "String should match!";
+
+  l.clear();
+  EXPECT_THROW(l.to_string(), std::length_error)
+      << "Should throw length_error if list is empty!";
+}
+
+TEST(UnrolledLinkedListMethods, MatchesModel) {
+  std::mt19937 rng(42);
+  UnrolledLinkedList<int, 8> l;
+  std::vector<int> model;
+
+  for (int step = 0; step < 5000; step++) {
+    int n = static_cast<int>(model.size());
+    switch (rng() % 5) {
+    case 0:
+    case 1: {
+      int index = static_cast<int>(rng() % (n + 1));
+      l.push_index(index, step);
+      model.insert(model.begin() + index, step);
+      break;
+    }
+    case 2:
+      if (n > 0) {
+        int index = static_cast<int>(rng() % n);
+        l.remove_index(index);
+        model.erase(model.begin() + index);
+      }
+      break;
+    case 3:
+      l.push_end(step);
+      model.push_back(step);
+      break;
+    default:
+      if (n > 0) {
+        l.remove_begin();
+        model.erase(model.begin());
+      }
+      break;
+    }
+  }
+
+  EXPECT_EQ(l.to_vector(), model) << "List should match the model!";
+  EXPECT_TRUE(blocks_are_valid(l)) << "Blocks should be valid!";
+}
+
+// ----------
+// Iterators test
+// ----------
+
+TEST(UnrolledLinkedListIterators, Traversal) {
+  std::vector<int> vec{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  UnrolledLinkedList<int, 4> l(vec);
+
+  std::vector<int> forward(l.begin(), l.end());
+  EXPECT_EQ(forward, vec) << "Forward traversal should match!";
+
+  std::vector<int> backward;
+  UnrolledListIterator<int, 4> it = l.end();
+  while (it != l.begin())
+    backward.push_back(*--it);
+
+  std::reverse(vec.begin(), vec.end());
+  EXPECT_EQ(backward, vec) << "Backward traversal should match!";
+}
+
+TEST(UnrolledLinkedListIterators, Arithmetic) {
+  std::vector<int> vec{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  UnrolledLinkedList<int, 4> l(vec);
+
+  EXPECT_EQ(*(l.begin() + 6), 7) << "Should skip blocks!";
+  EXPECT_EQ(*(l.begin() + 100), 10) << "Should stop at the last element!";
+  EXPECT_EQ(*(l.end() - 1), 10) << "end() - 1 should be the last element!";
+  EXPECT_EQ(*(l.end() - 7), 4) << "Should go back across blocks!";
+  EXPECT_EQ(*(l.end() - 100), 1) << "Should stop at the first element!";
+
+  UnrolledListIterator<int, 4> it = l.begin();
+  UnrolledListIterator<int, 4>::advance(it, 5);
+  EXPECT_EQ(*it, 6) << "Should advance to 6!";
+  UnrolledListIterator<int, 4>::advance(it, -3);
+  EXPECT_EQ(*it, 3) << "Should go back to 3!";
+
+  EXPECT_THROW(l.begin() + (-1), std::invalid_argument)
+      << "Should throw invalid_argument!";
+  EXPECT_THROW(*l.end(), std::out_of_range) << "Cannot dereference end()!";
+}
+
+TEST(UnrolledLinkedListIterators, StdAlgorithms) {
+  UnrolledLinkedList<int, 4> l(std::vector<int>{4, 8, 15, 16, 23, 42});
+
+  EXPECT_EQ(std::distance(l.begin(), l.end()), 6) << "Distance should be 6!";
+  EXPECT_EQ(*std::find(l.begin(), l.end(), 23), 23) << "Should find 23!";
+  EXPECT_EQ(std::count_if(l.begin(), l.end(), [](int x) { return x % 2; }),
+            2)
+      << "Two odd elements!";
+}